@@ -0,0 +1,33 @@
+#define _POSIX_C_SOURCE 199309L
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "FblCanTp.h"
+#include "FblCanTpCfg.h"
+void FblMemCpy(void *d, const void *s, UINT16 n){ memcpy(d,s,n); }
+void Bl_MemSet(void *d, UINT8 v, UINT16 n){ memset(d,v,n); }
+static unsigned long ntx;
+UINT8 FblCanSendData(const UINT8 *f, UINT32 id, UINT16 size){ (void)f;(void)id;(void)size; ntx++; return ERR_OK; }
+UINT8 FblCanXlSendData(UINT8 c,const UINT8 *f, UINT32 id, UINT16 size){ (void)c; return FblCanSendData(f,id,size); }
+UINT8 Diag_StartOfReception(UINT16 size){ (void)size; return ERR_OK; }
+UINT8 Diag_CopyRxData(UINT16 size, const UINT8 *buf){ (void)size;(void)buf; return ERR_OK; }
+void Diag_RxIndication(UINT8 t, UINT8 r){ (void)t;(void)r; }
+UINT8 Diag_CopyTxData(UINT16 size, UINT8 *buf){ (void)size;(void)buf; return ERR_OK; }
+void Diag_TxConfirmation(UINT8 r){ (void)r; }
+static double now(void){ struct timespec t; clock_gettime(CLOCK_MONOTONIC,&t); return t.tv_sec*1e9+t.tv_nsec; }
+int main(void){
+    UINT8 ff[8]={0x1F,0xFF,0,0,0,0,0,0}, cf[8]={0}, fc[8]={0x30,0,0,0xCC,0xCC,0xCC,0xCC,0xCC};
+    int r, i, ncf = 585; double t, rx=1e30, tx=1e30; unsigned long n0;
+    FblCanTpColdInit();
+    for(r=0;r<2000;r++){
+        Cantp_RxIndication(FBL_CAN_RX_ID_PHY,8,ff); Cantp_PeriodFunction(); Cantp_PeriodFunction();
+        t=now();
+        for(i=1;i<=ncf;i++){ cf[0]=(UINT8)(0x20|(i&0xF)); Cantp_RxIndication(FBL_CAN_RX_ID_PHY,8,cf); }
+        t=now()-t; if(t<rx) rx=t; Cantp_PeriodFunction(); Cantp_PeriodFunction();
+        (void)Cantp_Transmit(0,4095); Cantp_PeriodFunction(); Cantp_RxIndication(FBL_CAN_RX_ID_PHY,8,fc);
+        n0=ntx; t=now(); for(i=0;i<700;i++) Cantp_PeriodFunction(); t=now()-t; if(t<tx) tx=t;
+    }
+    /*The best run of each direction, the others are disturbed by the host.*/
+    printf("rx %.1f ns/CF  tx %.1f ns/CF (%lu frames)\n", rx/ncf, tx/(ntx-n0), ntx-n0);
+    return 0;
+}
@@ -0,0 +1,15 @@
+#!/bin/sh
+# Usage: pci.sh ON|OFF [compiler flags]
+# Builds img/ on the host with CANTP_FUN_STATIC_PCI_LAYOUT set to ON or OFF,
+# then prints the time per CF of a 4095 bytes reception and transmission.
+# Pass -DENABLE_CANFD=OFF for the classic frames build.
+set -e
+BENCH=$(cd "$(dirname "$0")" && pwd)
+WORK=$(mktemp -d)
+trap 'rm -rf "$WORK"' EXIT
+cp "$BENCH"/../img/*.c "$BENCH"/../img/*.h "$WORK"
+cd "$WORK"
+sed -i "s/STATIC_PCI_LAYOUT     OFF/STATIC_PCI_LAYOUT     $1/" FblCanTpCfg.h
+shift
+${CC:-gcc} -std=c99 -O2 -w -I. -I"$BENCH"/stubs "$@" "$BENCH"/pci.c FblCanTp.c FblCanTpCfg.c -o pci
+./pci
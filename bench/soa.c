@@ -0,0 +1,34 @@
+#define _POSIX_C_SOURCE 199309L
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "FblCanTp.h"
+#include "FblCanTpCfg.h"
+void FblMemCpy(void *d, const void *s, UINT16 n){ memcpy(d,s,n); }
+void Bl_MemSet(void *d, UINT8 v, UINT16 n){ memset(d,v,n); }
+UINT8 FblCanSendData(const UINT8 *f, UINT32 id, UINT16 size){ (void)f;(void)id;(void)size; return ERR_OK; }
+UINT8 FblCanXlSendData(UINT8 c,const UINT8 *f, UINT32 id, UINT16 size){ (void)c; return FblCanSendData(f,id,size); }
+UINT8 Diag_StartOfReception(UINT16 size){ (void)size; return ERR_OK; }
+UINT8 Diag_CopyRxData(UINT16 size, const UINT8 *buf){ (void)size;(void)buf; return ERR_OK; }
+void Diag_RxIndication(UINT8 t, UINT8 r){ (void)t;(void)r; }
+UINT8 Diag_CopyTxData(UINT16 size, UINT8 *buf){ memset(buf,0,size); return ERR_OK; }
+void Diag_TxConfirmation(UINT8 r){ (void)r; }
+#define C(i) { CANTP_TYPE_STANDARD, CANTP_TATYPE_PHYSICAL, 0x100000u+(i), 0x200000u+(i), 70,150,150, 0,0,0,15,0, CANTP_TX_DL_AUTO, CANTP_MAX_DL_DEFAULT }
+const bl_CanTpChannelCfg_t g_CanTpRxChnsCfg[NCH] = {
+#include "cfg.inc"
+};
+const bl_CanTpChannelCfg_t g_CanTpTxChnsCfg[NCH] = {
+#include "cfg.inc"
+};
+static double now(void){ struct timespec t; clock_gettime(CLOCK_MONOTONIC,&t); return t.tv_sec*1e9+t.tv_nsec; }
+static volatile UINT8 sink[1<<22];
+static void flush(void){ unsigned i; for(i=0;i<sizeof sink;i+=64) sink[i]++; }
+int main(void){
+    int k, reps = 200; double t, sweep=0, disp=0; UINT8 sf[8]={0x02,0x3E,0,0,0,0,0,0}; UINT32 seed=1;
+    FblCanTpColdInit();
+    for(k=0;k<reps;k++){ flush(); t=now(); Cantp_PeriodFunction(); sweep+=now()-t; }
+    for(k=0;k<reps;k++){ seed=seed*1103515245u+12345u; flush(); t=now();
+        Cantp_RxIndication(0x100000u+(seed>>8)%NCH,8,sf); disp+=now()-t; Cantp_PeriodFunction(); }
+    printf("%6d channels: sweep %8.1f us  dispatch %8.1f us\n", NCH, sweep/reps/1e3, disp/reps/1e3);
+    return 0;
+}
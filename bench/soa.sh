@@ -0,0 +1,17 @@
+#!/bin/sh
+# Usage: soa.sh CHANNELS ON|OFF
+# Builds img/ on the host with CANTP_FUN_CHANNEL_SOA set to ON or OFF and
+# CHANNELS rx and tx channels, then prints the time of an idle period sweep
+# and of the dispatch of a SF to a random channel, with a cold cache.
+set -e
+N=$1
+BENCH=$(cd "$(dirname "$0")" && pwd)
+WORK=$(mktemp -d)
+trap 'rm -rf "$WORK"' EXIT
+cp "$BENCH"/../img/*.c "$BENCH"/../img/*.h "$WORK"
+cd "$WORK"
+sed -i "s/CHANNEL_SOA           OFF/CHANNEL_SOA           $2/;s/CANTP_NUMBER_OF_RX_CHANNEL      (2)/CANTP_NUMBER_OF_RX_CHANNEL      ($N)/;s/CANTP_NUMBER_OF_TX_CHANNEL      (1)/CANTP_NUMBER_OF_TX_CHANNEL      ($N)/" FblCanTpCfg.h
+i=0
+while [ "$i" -lt "$N" ]; do echo "C($i),"; i=$((i + 1)); done > cfg.inc
+${CC:-gcc} -std=c99 -O2 -w -DNCH="$N" -I. -I"$BENCH"/stubs "$BENCH"/soa.c FblCanTp.c -o soa
+./soa
@@ -0,0 +1,19 @@
+/* Host stub of FblConfig.h for the benchmarks, not used by the target build. */
+#ifndef FBLCONFIG_H
+#define FBLCONFIG_H
+#ifndef ENABLE_CANFD
+#define ENABLE_CANFD ON
+#endif
+#define FBL_CAN_RX_ID_PHY 0x7E0u
+#define FBL_CAN_RX_ID_FUN 0x7DFu
+#define FBL_CAN_TX_ID_PHY 0x7E8u
+#define TPL_TIMER_AR 70
+#define TPL_TIMER_BR 50
+#define TPL_TIMER_CR 150
+#define TPL_TIMER_AS 70
+#define TPL_TIMER_BS 150
+#define TPL_TIMER_CS 50
+#define STMIN_ECU 0u
+#define BS_ECU 0u
+#define CANTP_FILLER_BYTE 0xAAu
+#endif
@@ -0,0 +1,6 @@
+/* Host stub of FblDrvApi.h for the benchmarks, not used by the target build. */
+#ifndef FBLDRVAPI_H
+#define FBLDRVAPI_H
+extern UINT8 FblCanSendData(UINT8 *data, UINT32 id, UINT16 size);
+extern UINT8 FblCanXlSendData(UINT8 ctrl, UINT8 *data, UINT32 id, UINT16 size);
+#endif
@@ -0,0 +1,6 @@
+/* Host stub of FblString.h for the benchmarks, not used by the target build. */
+#ifndef FBLSTRING_H
+#define FBLSTRING_H
+extern void FblMemCpy(void *d, const void *s, unsigned short n);
+extern void Bl_MemSet(void *d, unsigned char v, unsigned short n);
+#endif
@@ -0,0 +1,10 @@
+/* Host stub of FblUdsDiag.h for the benchmarks, not used by the target build. */
+#ifndef FBLUDSDIAG_H
+#define FBLUDSDIAG_H
+#include "FblCanTp.h"
+extern UINT8 Diag_StartOfReception(bl_BufferSize_t size);
+extern UINT8 Diag_CopyRxData(bl_BufferSize_t size, const bl_Buffer_t *buf);
+extern void Diag_RxIndication(UINT8 taType, UINT8 result);
+extern UINT8 Diag_CopyTxData(bl_BufferSize_t size, bl_Buffer_t *buf);
+extern void Diag_TxConfirmation(UINT8 result);
+#endif
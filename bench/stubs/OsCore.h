@@ -0,0 +1 @@
+/* Host stub of OsCore.h for the benchmarks, not used by the target build. */
@@ -0,0 +1,4 @@
+/* Host stub of OsCoreCfg.h for the benchmarks, not used by the target build. */
+#define EVENT_MSG_READY 0x1u
+#define EVENT_READY 0x2u
+#define EVENT_SCAN_TIMER 0x4u
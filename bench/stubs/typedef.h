@@ -0,0 +1,20 @@
+/* Host stub of typedef.h for the benchmarks, not used by the target build. */
+#ifndef TYPEDEF_H
+#define TYPEDEF_H
+#include <stddef.h>
+typedef unsigned char UINT8;
+typedef unsigned short UINT16;
+typedef unsigned int UINT32;
+#define TRUE 1u
+#define FALSE 0u
+#define NULL_PTR ((void*)0)
+#define ON 1
+#define OFF 0
+#define ERR_OK 0u
+#define ERR_ERROR 1u
+#define ERR_OVERFLOW 2u
+#define INIT_SUCCESS 1u
+#define RETURN_IF_FAIL(x) do{ if(!(x)) return; }while(0)
+#define BL_DEBUG_ASSERT_NO_RET(x) ((void)0)
+#define BL_DEBUG_ASSERT_PARAM(x) ((void)0)
+#endif
@@ -1,2436 +1,5877 @@
-/*************************************************************************************************************
-*    FileName   :    FblCanTp.c
-*    Description:    CAN Transport Protocol Layer for FBL. 
-
-*    UpdateDate :    2022/3/8
-*    Version    :    1.0.0
-*    History    :         
-        1. V1.0.0, 2022/3/8, R515, Initial version.
-
-*************************************************************************************************************/
-
-/*************************************************************************************************************
-                                             Include Files
-*************************************************************************************************************/
-#include "FblCanTp.h"
-#include "FblCanTpCfg.h"
-#include "FblUdsDiag.h"
-#include "FblString.h"
-
-#include "FblDrvApi.h"
-#include "OsCoreCfg.h" 
-#include "OsCore.h" 
-
-/*************************************************************************************************************
-                                     Local Function Declarations
- ************************************************************************************************************/
-/** \brief The CTS used for the FS field in the Flow Control Frame.*/
-#define CANTP_FC_FRAME_CTS              (0x00u)
-/** \brief The WAIT used for the FS field in the Flow Control Frame.*/
-#define CANTP_FC_FRAME_WAIT             (0x01u)
-/** \brief The OVERFLOW used for the FS field in the Flow Control Frame.*/
-#define CANTP_FC_FRAME_OVERFLOW         (0x02u)
-
-/** \brief The number of the PCI used for different types of cantp channel.*/
-#define CANTP_NUMBER_OF_PCI_INFO        (0x02u)
-/** \brief This PCI used for standard cantp channel.*/
-#define CANTP_STANDARD_PCI_INFO         (0x00u)
-/** \brief This PCI used for extended or mixed cantp channel.*/
-#define CANTP_EXTENDED_PCI_INFO         (0x01u)
-
-/** \brief The number of status of the Rx channels.*/
-#define CANTP_NUMBER_OF_RX_STATUS       (0x05u)
-/** \brief The number of status of the Tx channels.*/
-#define CANTP_NUMBER_OF_TX_STATUS       (0x05u)
-
-/** \brief The number of frame types according to ISO 15765-2.*/
-#define CANTP_NUMBER_OF_FRAME_TYPE      (0x04u)
-/** \brief The Single Frame.*/
-#define CANTP_FRAME_TYPE_SF             (0x00u)
-/** \brief The First Frame.*/
-#define CANTP_FRAME_TYPE_FF             (0x01u)
-/** \brief The Consecutive Frame.*/
-#define CANTP_FRAME_TYPE_CF             (0x02u)
-/** \brief The Flow Control Frame.*/
-#define CANTP_FRAME_TYPE_FC             (0x03u)
-
-/** \brief The type value of the Single Frame.*/
-#define CANTP_FRAME_SF_VALUE            (0x00u)
-/** \brief The type value of the First Frame.*/
-#define CANTP_FRAME_FF_VALUE            (0x10u)
-/** \brief The type value of the Consecutive Frame.*/
-#define CANTP_FRAME_CF_VALUE            (0x20u)
-/** \brief The type value of the Flow Control Frame.*/
-#define CANTP_FRAME_FC_VALUE            (0x30u)
-
-/** \brief The 16bits type value of the First Frame.*/
-#define CANTP_FRAME_FF_VAULE_16BITS     (0x1000u)
-
-/** \brief The ta offset in a frame.*/
-#define CANTP_TA_OFFSET                 (0x00u)
-/** \brief The max STmin value.*/
-#define CANTP_MAX_STMIN_VALUE           (0x7Fu)
-#define CANTP_MIN_STMIN_VALUE_US        (0xF0u)
-#define CANTP_MAX_STMIN_VALUE_US        (0xFAu)
-
-/** \brief The Idle status of a channel.*/
-#define CANTP_STATUS_IDLE               (0x00u)
-/** \brief The recvSF status of a Rx channel.*/
-#define CANTP_STATUS_RECEIVING_SF       (0x01u)
-/** \brief The recvFF status of a Rx channel.*/
-#define CANTP_STATUS_RECEIVING_FF       (0x02u)
-/** \brief The recvCF status of a Rx channel.*/
-#define CANTP_STATUS_RECEIVING_CF       (0x03u)
-/** \brief The tranFC status of a Rx channel.*/
-#define CANTP_STATUS_TRANSMITTING_FC    (0x04u)
-
-/** \brief The tranSF status of a Tx channel.*/
-#define CANTP_STATUS_TRANSMITTING_SF    (0x01u)
-/** \brief The tranFF status of a Tx channel.*/
-#define CANTP_STATUS_TRANSMITTING_FF    (0x02u)
-/** \brief The tranCF status of a Tx channel.*/
-#define CANTP_STATUS_TRANSMITTING_CF    (0x03u)
-/** \brief The recvFC status of a Tx channel.*/
-#define CANTP_STATUS_RECEIVING_FC       (0x04u)
-
-/** \brief The sub Idle status of a channel.*/
-#define CANTP_SUB_STATUS_IDLE           (0x00u)
-/** \brief The sub transmitting status of a channel.*/
-#define CANTP_SUB_STATUS_TRANSMITTING   (0x01u)
-/** \brief The sub receiving status of a channel.*/
-#define CANTP_SUB_STATUS_RECEIVING      (0x02u)
-
-/** \brief The mask of data size in the First Frame.*/
-#define CANTP_FRAME_FF_DATASIZE_MASK    (0x0FFFu)
-/** \brief the mask of data size in the Single Frame.*/
-#define CANTP_FRAME_SF_DATASIZE_MASK    (0x0Fu)
-
-/** \brief Get the data size in the Single Frame.*/
-#define CANTP_GET_SF_DATASIZE(data)     GET_LOW_HALF(data)
-/** \brief Get the data size in the First Frame.*/
-#define CANTP_GET_FF_DATASIZE(data,data2)  (((UINT16)(GET_LOW_HALF(data) << 8)| (UINT16)data2) \
-                                                & CANTP_FRAME_FF_DATASIZE_MASK)
-#define CANTP_GET_FF_DATASIZE2(data1,data2,data3,data4)  (((UINT32)((data1) << 24)) | ((UINT32)data2 << 16) \
-                                                    | ((UINT32)data3 << 8)| ((UINT32)data4))
-
-/** \brief Get the SN in the Consecutive Frame.*/
-#define CANTP_GET_CF_SN(pci,buf)      GET_LOW_HALF((buf)[(pci)->pciPos])
-
-/** \brief Get the frame type in the a frame.*/
-#define CANTP_GET_FRAME_TYPE(pci,buf) GET_LOW_HALF((buf)[(pci)->pciPos]>> 4)
-/** \brief Get the FlowStatus in the a Flow Control Frame.*/
-#define CANTP_GET_FC_FS(pci,buf)      GET_LOW_HALF((buf)[(pci)->pciPos])
-/** \brief Get the BlockSize in the a Flow Control Frame.*/
-#define CANTP_GET_FC_BS(pci,buf)        ((buf)[(pci)->fcBsPos])
-/** \brief Get the STmin in the a Flow Control Frame.*/
-#define CANTP_GET_FC_STMIN(pci,buf)     ((buf)[(pci)->fcStPos])
-
-
-/** \brief If the status of a channel is Idle return TRUE.*/
-#define CANTP_STATUS_IS_IDLE(chn)       (CANTP_STATUS_IDLE == (chn)->status)
-/** \brief If the status of a channel is recvSF return TRUE.*/
-#define CANTP_STATUS_IS_RECVSF(chn)     (CANTP_STATUS_RECEIVING_SF \
-                                            == (chn)->status)
-/** \brief If the status of a channel is recvFF return TRUE.*/
-#define CANTP_STATUS_IS_RECVFF(chn)     (CANTP_STATUS_RECEIVING_FF \
-                                            == (chn)->status)
-/** \brief If the status of a channel is recvCF return TRUE.*/
-#define CANTP_STATUS_IS_RECVCF(chn)     (CANTP_STATUS_RECEIVING_CF \
-                                            == (chn)->status)
-/** \brief If the status of a channel is recvFC return TRUE.*/
-#define CANTP_STATUS_IS_RECVFC(chn)     (CANTP_STATUS_RECEIVING_FC \
-                                            == (chn)->status)
-/** \brief If the status of a channel is tranSF return TRUE.*/
-#define CANTP_STATUS_IS_TRANSF(chn)     (CANTP_STATUS_TRANSMITTING_SF \
-                                            == (chn)->status)
-/** \brief If the status of a channel is tranFF return TRUE.*/
-#define CANTP_STATUS_IS_TRANFF(chn)     (CANTP_STATUS_TRANSMITTING_FF \
-                                            == (chn)->status)
-/** \brief If the status of a channel is tranCF return TRUE.*/
-#define CANTP_STATUS_IS_TRANCF(chn)     (CANTP_STATUS_TRANSMITTING_CF \
-                                            == (chn)->status)
-/** \brief If the status of a channel is tranFC return TRUE.*/
-#define CANTP_STATUS_IS_TRANFC(chn)     (CANTP_STATUS_TRANSMITTING_FC \
-                                            == (chn)->status)
-
-/*  When continuous FF or SF is received in one channel during
-    a timeout period,It maybe break other physical channel.
-    So If a channel is receiving a FF or a SF, do NOT indicate.*/
-/** \brief Check if the buffer is gotten from Dcm module.*/
-#define CANTP_IS_GETTING_BUFFER(chn)    ((chn)->status > \
-                                            CANTP_STATUS_RECEIVING_FF)
-
-/** \brief If the status of a channel is NOT Idle return TRUE.*/
-#define CANTP_STATUS_IS_NOT_IDLE(chn)   (!CANTP_STATUS_IS_IDLE(chn))
-
-/** \brief If the status of a channel is NOT recvSF return TRUE.*/
-#define CANTP_STATUS_IS_NOT_RECVSF(chn) (!CANTP_STATUS_IS_RECVSF(chn))
-/** \brief If the status of a channel is NOT recvFF return TRUE.*/
-#define CANTP_STATUS_IS_NOT_RECVFF(chn) (!CANTP_STATUS_IS_RECVFF(chn))
-/** \brief If the status of a channel is NOT recvCF return TRUE.*/
-#define CANTP_STATUS_IS_NOT_RECVCF(chn) (!CANTP_STATUS_IS_RECVCF(chn))
-/** \brief If the status of a channel is NOT recvFC return TRUE.*/
-#define CANTP_STATUS_IS_NOT_RECVFC(chn) (!CANTP_STATUS_IS_RECVFC(chn))
-/** \brief If the status of a channel is NOT tranSF return TRUE.*/
-#define CANTP_STATUS_IS_NOT_TRANSF(chn) (!CANTP_STATUS_IS_TRANSF(chn))
-/** \brief If the status of a channel is NOT tranFF return TRUE.*/
-#define CANTP_STATUS_IS_NOT_TRANFF(chn) (!CANTP_STATUS_IS_TRANFF(chn))
-/** \brief If the status of a channel is NOT tranCF return TRUE.*/
-#define CANTP_STATUS_IS_NOT_TRANCF(chn) (!CANTP_STATUS_IS_TRANCF(chn))
-/** \brief If the status of a channel is NOT tranFC return TRUE.*/
-#define CANTP_STATUS_IS_NOT_TRANFC(chn) (!CANTP_STATUS_IS_TRANFC(chn))
-
-/** \brief If the sub status of a channel is Idle return TRUE.*/
-#define CANTP_SUB_STATUS_IS_IDLE(chn)   (CANTP_SUB_STATUS_IDLE \
-                                            == (chn)->subStatus)
-/** \brief If the sub status of a channel is Receiving return TRUE.*/
-#define CANTP_SUB_STATUS_IS_RECV(chn)   (CANTP_SUB_STATUS_RECEIVING \
-                                                == (chn)->subStatus)
-/** \brief If the sub status of a channel is Transmitting return TRUE.*/
-#define CANTP_SUB_STATUS_IS_TRAN(chn)   (CANTP_SUB_STATUS_TRANSMITTING \
-                                                == (chn)->subStatus)
-
-/** \brief If the sub status of a channel is NOT Idle return TRUE.*/
-#define CANTP_SUB_STATUS_IS_NOT_IDLE(chn)   (!CANTP_SUB_STATUS_IS_IDLE(chn))
-/** \brief If the sub status of a channel is NOT Receiving return TRUE.*/
-#define CANTP_SUB_STATUS_IS_NOT_RECV(chn)   (!CANTP_SUB_STATUS_IS_RECV(chn))
-/** \brief If the sub status of a channel is NOT Transmitting return TRUE.*/
-#define CANTP_SUB_STATUS_IS_NOT_TRAN(chn)   (!CANTP_SUB_STATUS_IS_TRAN(chn))
-
-/** \brief Set the status of a channel to Idle.*/
-#define CANTP_STATUS_GOTO_IDLE(chn)     ((chn)->status = CANTP_STATUS_IDLE)
-/** \brief Set the status of a channel to recvSF.*/
-#define CANTP_STATUS_GOTO_RECVSF(chn)   ((chn)->status = \
-                                            CANTP_STATUS_RECEIVING_SF)
-/** \brief Set the status of a channel to recvFF.*/
-#define CANTP_STATUS_GOTO_RECVFF(chn)   ((chn)->status = \
-                                            CANTP_STATUS_RECEIVING_FF)
-/** \brief Set the status of a channel to recvCF.*/
-#define CANTP_STATUS_GOTO_RECVCF(chn)   ((chn)->status = \
-                                            CANTP_STATUS_RECEIVING_CF)
-/** \brief Set the status of a channel to recvFC.*/
-#define CANTP_STATUS_GOTO_RECVFC(chn)   ((chn)->status = \
-                                            CANTP_STATUS_RECEIVING_FC)
-
-/** \brief Set the status of a channel to tranSF.*/
-#define CANTP_STATUS_GOTO_TRANSF(chn)   ((chn)->status = \
-                                            CANTP_STATUS_TRANSMITTING_SF)
-/** \brief Set the status of a channel to tranFF.*/
-#define CANTP_STATUS_GOTO_TRANFF(chn)   ((chn)->status = \
-                                            CANTP_STATUS_TRANSMITTING_FF)
-/** \brief Set the status of a channel to tranCF.*/
-#define CANTP_STATUS_GOTO_TRANCF(chn)   ((chn)->status = \
-                                            CANTP_STATUS_TRANSMITTING_CF)
-/** \brief Set the status of a channel to tranFC.*/
-#define CANTP_STATUS_GOTO_TRANFC(chn)   ((chn)->status = \
-                                            CANTP_STATUS_TRANSMITTING_FC)
-
-/** \brief Set the sub status of a channel to Idle.*/
-#define CANTP_SUB_STATUS_GOTO_IDLE(chn) ((chn)->subStatus = \
-                                            CANTP_SUB_STATUS_IDLE)
-
-/** \brief Set the sub status of a channel to receiving.*/
-#define CANTP_SUB_STATUS_GOTO_RECV(chn) ((chn)->subStatus = \
-                                            CANTP_SUB_STATUS_RECEIVING)
-
-/** \brief Set the sub status of a channel to transmitting.*/
-#define CANTP_SUB_STATUS_GOTO_TRAN(chn) ((chn)->subStatus = \
-                                            CANTP_SUB_STATUS_TRANSMITTING)
-
-/** \brief Set the private data of a channel.*/
-#define CANTP_SET_PRIVATE_DATA(chn,_pData) ((chn)->pData = (UINT8)(_pData))
-
-/** \brief Set the BS of a channel.*/
-#define CANTP_SET_BS(chn,_bs)       ((chn)->bs = (UINT8)(_bs))
-/** \brief Set the STmin of a channel.*/
-#define CANTP_SET_STMIN(chn,_st)    ((chn)->st = (UINT8)(_st))
-/** \brief Set the maxWFT of a channel.*/
-#define CANTP_SET_MAXWFT(chn,_wft)  ((chn)->wft = (UINT8)(_wft))
-/** \brief Set the TA type of a channel.*/
-#define CANTP_SET_TATYPE(chn,type)  ((chn)->taType = (UINT8)(type))
-
-/** \brief Initialize the BS of a channel by channel configurations.*/
-#define CANTP_INIT_BS_BY_CFG(chn,cfg)       CANTP_SET_BS(chn,(cfg)->bs)
-/** \brief Initialize the STmin of a channel by channel configurations.*/
-#define CANTP_INIT_STMIN_BY_CFG(chn,cfg)    CANTP_SET_STMIN(chn,(cfg)->st)
-/** \brief Initialize the maxWFT of a channel by channel configurations.*/
-#define CANTP_INIT_MAXWFT_BY_CFG(chn,cfg)   CANTP_SET_MAXWFT(chn,(cfg)->wft)
-/** \brief Initialize the TA type of a channel by channel configurations.*/
-#define CANTP_INIT_TATYPE_BY_CFG(chn,cfg)   CANTP_SET_TATYPE(chn,(cfg)->taType)
-
-/** \brief Initialize the BS of a channel.*/
-#define CANTP_INIT_BS(chn)      CANTP_INIT_BS_BY_CFG((chn),(chn)->chnCfg)
-/** \brief Initialize the STmin of a channel.*/
-#define CANTP_INIT_STMIN(chn)   CANTP_INIT_STMIN_BY_CFG((chn),(chn)->chnCfg)
-/** \brief Initialize the maxWFT of a channel.*/
-#define CANTP_INIT_MAXWFT(chn)  CANTP_INIT_MAXWFT_BY_CFG((chn),(chn)->chnCfg)
-/** \brief Initialize the TA type of a channel.*/
-#define CANTP_INIT_TATYPE(chn)  CANTP_INIT_TATYPE_BY_CFG((chn),(chn)->chnCfg)
-
-/** \brief Set the timeout value of the timer in a channel.*/
-#define CANTP_SET_TIMER(chn,timeout)    ((chn)->timer = (UINT16)(timeout))
-/** \brief Get the current value of the timer in a channel.*/
-#define CANTP_GET_TIMER(chn)            ((chn)->timer)
-
-/** \brief Initialize the timer in a channel.*/
-#define CANTP_INIT_TIMER(chn)           CANTP_SET_TIMER(chn,0u)
-/** \brief Use the timerA to initialize the timer in a channel.*/
-#define CANTP_INIT_TIMER_A(chn) CANTP_SET_TIMER(chn,(chn)->chnCfg->timerA)
-/** \brief Use the timerB to initialize the timer in a channel.*/
-#define CANTP_INIT_TIMER_B(chn) CANTP_SET_TIMER(chn,(chn)->chnCfg->timerB)
-/** \brief Use the timerC to initialize the timer in a channel.*/
-#define CANTP_INIT_TIMER_C(chn) CANTP_SET_TIMER(chn,(chn)->chnCfg->timerC)
-
-/** \brief Check if the timer in a channel is timeout.*/
-#define CANTP_IS_TIMEOUT(chn)           (0u == CANTP_GET_TIMER(chn))
-
-/** \brief Set the SN of a channel.*/
-#define CANTP_SET_SN(chn,_sn)       ((chn)->sn = (UINT8)(_sn))
-/** \brief Set the CF counter of a channel.*/
-#define CANTP_SET_CFCNT(chn,_cfCnt) ((chn)->cfCnt = (UINT16)(_cfCnt))
-/** \brief Set the size of the last CF of a channel.*/
-#define CANTP_SET_LAST_SIZE(chn,_lastSize)  ((chn)->lastSize =\
-                                                (UINT8)(_lastSize))
-/** \brief Set the total size of a channel.*/
-#define CANTP_SET_TOTAL_SIZE(chn,_totalSize)    ((chn)->totalSize =\
-                                                 (bl_BufferSize_t)(_totalSize))
-
-/** \brief Set the tx delay of a channel.*/
-#define CANTP_SET_TXDELAY(chn,delay)    ((chn)->txDelay = (UINT8)(delay))
-
-/** \brief Initialize the SN of a channel.*/
-#define CANTP_INIT_SN(chn)          CANTP_SET_SN(chn,0u)
-/** \brief Initialize the CF counter of a channel.*/
-#define CANTP_INIT_CFCNT(chn)       CANTP_SET_CFCNT(chn,0u)
-/** \brief Initialize the size of the last CF of a channel.*/
-#define CANTP_INIT_LAST_SIZE(chn)   CANTP_SET_LAST_SIZE(chn,0u)
-/** \brief Initialize the total size of a channel.*/
-#define CANTP_INIT_TOTAL_SIZE(chn)  CANTP_SET_TOTAL_SIZE(chn,0u)
-/** \brief Initialize the tx delay of a channel.*/
-#define CANTP_INIT_TXDELAY(chn)     CANTP_SET_TXDELAY(chn,(chn)->st)
-/** \brief Add the SN of a channel.*/
-#define CANTP_ADD_SN(chn)            ((chn)->sn += 1)
-/** \brief Check if a channel is functional.*/
-#define CANTP_IS_FUNCTIONAL_CHANNEL(chn)    (CANTP_TATYPE_FUNCTIONAL \
-                                                == (chn)->chnCfg->taType)
-/** \brief Check if a channel is physical.*/
-#define CANTP_IS_PHYSICAL_CHANNEL(chn)      (CANTP_TATYPE_PHYSICAL \
-                                                == (chn)->chnCfg->taType)
-
-/*****************************************************************************
- *  Internal Type Definitions
- *****************************************************************************/
-/** \brief A alias of the struct _tag_CanTpChannel.*/
-typedef struct _tag_CanTpChannel bl_CanTpChannel_t;
-/** \brief A alias of the struct _tag_CanTpPciInfo.*/
-typedef struct _tag_CanTpPciInfo bl_CanTpPciInfo_t;
-/** \brief A alias of the struct _tag_CanTpPeriodInterface.*/
-typedef struct _tag_CanTpPeriodInterface bl_CanTpPeriodIF_t;
-/** \brief A interface used to process received frame.*/
-typedef UINT8 (*bl_CanTpRxProcess_t)(bl_CanTpChannel_t *channel,
-                                                bl_BufferSize_t size,
-                                                const bl_Buffer_t *buffer);
-/** \brief A interface used to confirm that a frame is transmitted.*/
-typedef void (*bl_CanTpTxConfirm_t)(bl_CanTpChannel_t *channel);
-/*****************************************************************************
- *  Internal Structure Definitions
- *****************************************************************************/
-/** \brief The PCI Informations for a can tp channel.*/
-struct _tag_CanTpPciInfo
-{
-    UINT8 pciPos;     /**< The PCI position in a can frame.*/
-    UINT8 dataPos;    /**< The valid data position in a SF or CF frame.*/
-    UINT8 ffDataPos;  /**< The valid data position in a FF frame.*/
-    UINT8 fcBsPos;    /**< The BS position in a FC frame.*/
-    UINT8 fcStPos;    /**< The STmin position in a FC frame.*/
-    UINT8 maxDataSize;/**< The max size of data in a SF or CF frame.*/
-    UINT8 maxFFDataSize;  /**< The max size of data in a FF frame.*/
-    UINT8 maxFCDataSize;  /**< The max size of data in a FC frame.*/
-};
-
-/** \brief The channel of the CAN TP.*/
-struct _tag_CanTpChannel
-{
-    UINT8 status;     /**< The current status of a channel.*/
-    UINT8 subStatus;  /**< The current sub status of a channel.*/
-    UINT8 pData;      /**< The private data of a channel.*/
-    UINT8 sn;         /**< The expected SN used to receive CF frames.*/
-    UINT8 txDelay;    /**< The Delay timer for sending a CF frame.*/
-    UINT8 st;         /**< The STmin copy from chnCfg->st or a FC frame.*/
-    UINT8 bs;         /**< The BS copy from chnCfg->bs or a FC frame.*/
-    UINT8 wft;        /**< The WFT copy from chnCfg->wft.*/
-    UINT8 taType;      /**< The TA type copy from chnCfg->taType.*/
-    UINT8 lastSize;   /**< The Size of the last CF or SF frame.*/
-    bl_Buffer_t frame[CANTP_MAX_FRAME_SIZE];  /**< The local frame buffer.*/
-    UINT16 timer;     /**< The timer*/
-    UINT16 cfCnt;     /**< The counter of CF frames.*/
-    bl_BufferSize_t totalSize; /**< The total size of Tx or Rx.*/
-    const struct _tag_CanTpChannelCfg *chnCfg; /**< Channel configurations*/
-    const struct _tag_CanTpPciInfo *pciInfo;   /**< PCI information*/
-};
-
-/** \brief The period process interface of the CAN TP channel.*/
-struct _tag_CanTpPeriodInterface
-{
-    void (*Period)(bl_CanTpChannel_t *channel); /**< period of status.*/
-    UINT8 (*Timeout)(bl_CanTpChannel_t *channel);/**< timeout of status*/
-};
-
-/*****************************************************************************
- *  Internal Function Declarations
- *****************************************************************************/
-static void FblCanTpMsgHandle(UINT8 *pucData);
-static void FblCanTpEventHandle(UINT16 uwEventId);
-static void CanTp_Init(void);
-/** \brief Use the configuration to initialize a cantp channel.*/
-static void _Cantp_InitChannel(bl_CanTpChannel_t *channel,
-                                const bl_CanTpChannelCfg_t *channelCfg);
-/** \brief Use the Rx handle of the canif module to get a channel.*/
-static bl_CanTpChannel_t * _Cantp_GetChannelByRxId(UINT16 id,
-                                                   UINT16 chnNum,
-                                                   bl_CanTpChannel_t *chnList);
-/** \brief Use the size to set the CF counter and last size of a channel.*/
-static void _Cantp_SetMultipleFrameSize(bl_CanTpChannel_t *channel,
-                                        bl_BufferSize_t size);
-
-/** \brief Get the STmin to used to transmit CF.*/
-static UINT8 _Cantp_GetSTMinFromFC(UINT8 st);
-
-/** \brief The period function.*/
-static void _Cantp_PeriodFunction(UINT16 num,
-                                bl_CanTpChannel_t *channelList,
-                                const bl_CanTpPeriodIF_t *periodList);
-/** \brief The Rx indication function used by Rx channel.*/
-static UINT8 _Cantp_RxIndToRxChannel(bl_CanTpChannel_t *channel,
-                                            bl_BufferSize_t size,
-                                            const bl_Buffer_t *buffer);
-
-/** \brief The Rx indication function used by Tx channel.*/
-static UINT8 _Cantp_RxIndToTxChannel(bl_CanTpChannel_t *channel,
-                                            bl_BufferSize_t size,
-                                            const bl_Buffer_t *buffer);
-
-/** \brief Transmit a CF.*/
-static void _Cantp_TransmitCF(bl_CanTpChannel_t *channel);
-/** \brief Make the PCI of SF into the local frame.*/
-static void _Cantp_MakePciOfSF(bl_CanTpChannel_t *channel);
-/** \brief Make the PCI of FF into the local frame.*/
-static void _Cantp_MakePciOfFF(bl_CanTpChannel_t *channel);
-/** \brief Make the PCI of CF into the local frame.*/
-static void _Cantp_MakePciOfCF(bl_CanTpChannel_t *channel);
-/** \brief Make the PCI of FC into the local frame.*/
-static void _Cantp_MakePciOfFC(bl_CanTpChannel_t *channel);
-/** \brief The Tx confirmation function used for the Idle status of a channel.*/
-static void _Cantp_TxConfirmIdle(bl_CanTpChannel_t *channel);
-/** \brief The Tx confirmation function used for the tranSF status of a channel.*/
-static void _Cantp_TxConfirmSF(bl_CanTpChannel_t *channel);
-/** \brief The Tx confirmation function used for the tranFF status of a channel.*/
-static void _Cantp_TxConfirmFF(bl_CanTpChannel_t *channel);
-/** \brief The Tx confirmation function used for the tranCF status of a channel.*/
-static void _Cantp_TxConfirmCF(bl_CanTpChannel_t *channel);
-/** \brief The Tx confirmation function used for the tranFC status of a channel.*/
-static void _Cantp_TxConfirmFC(bl_CanTpChannel_t *channel);
-/** \brief The Change the status of a channel to Idle.*/
-static void _Cantp_GotoIdle(bl_CanTpChannel_t *channel);
-/** \brief The Change the status of a channel to TranSF.*/
-static void _Cantp_GotoTranSF(bl_CanTpChannel_t *channel);
-/** \brief The Change the status of a channel to TranFF.*/
-static void _Cantp_GotoTranFF(bl_CanTpChannel_t *channel);
-/** \brief The Change the status of a channel to TranCF.*/
-static void _Cantp_GotoTranCF(bl_CanTpChannel_t *channel);
-/** \brief The Change the status of a channel to TranFC.*/
-static void _Cantp_GotoTranFC(bl_CanTpChannel_t *channel, UINT8 fs);
-/** \brief Receive a Single Frame.*/
-static UINT8 _Cantp_ReceiveSF(bl_CanTpChannel_t *channel,
-                                    bl_BufferSize_t size,
-                                    const bl_Buffer_t *buffer);
-/** \brief Receive a First Frame.*/
-static UINT8 _Cantp_ReceiveFF(bl_CanTpChannel_t *channel,
-                                    bl_BufferSize_t size,
-                                    const bl_Buffer_t *buffer);
-/** \brief Receive a Consecutive Frame.*/
-static UINT8 _Cantp_ReceiveCF(bl_CanTpChannel_t *channel,
-                                    bl_BufferSize_t size,
-                                    const bl_Buffer_t *buffer);
-/** \brief Receive a Flow Control Frame.*/
-static UINT8 _Cantp_ReceiveFC(bl_CanTpChannel_t *channel,
-                                    bl_BufferSize_t size,
-                                    const bl_Buffer_t *buffer);
-
-/** \brief The period function of the Idle status of a channel.*/
-static void _Cantp_PeriodIdle(bl_CanTpChannel_t *channel);
-/** \brief The timeout function of the Idle status of a channel.*/
-static UINT8 _Cantp_TimeoutIdle(bl_CanTpChannel_t *channel);
-/** \brief The period function of the RecvSF status of a channel.*/
-static void _Cantp_PeriodRecvSF(bl_CanTpChannel_t *channel);
-/** \brief The timeout function of the RecvSF status of a channel.*/
-static UINT8 _Cantp_TimeoutRecvSF(bl_CanTpChannel_t *channel);
-/** \brief The period function of the RecvFF status of a channel.*/
-static void _Cantp_PeriodRecvFF(bl_CanTpChannel_t *channel);
-/** \brief The timeout function of the RecvFF status of a channel.*/
-static UINT8 _Cantp_TimeoutRecvFF(bl_CanTpChannel_t *channel);
-/** \brief The period function of the RecvCF status of a channel.*/
-static void _Cantp_PeriodRecvCF(bl_CanTpChannel_t *channel);
-/** \brief The timeout function of the RecvCF status of a channel.*/
-static UINT8 _Cantp_TimeoutRecvCF(bl_CanTpChannel_t *channel);
-/** \brief The period function of the TranFC status of a channel.*/
-static void _Cantp_PeriodTranFC(bl_CanTpChannel_t *channel);
-/** \brief The timeout function of the TranFC status of a channel.*/
-static UINT8 _Cantp_TimeoutTranFC(bl_CanTpChannel_t *channel);
-/** \brief The period function of the TranSF status of a channel.*/
-static void _Cantp_PeriodTranSF(bl_CanTpChannel_t *channel);
-/** \brief The timeout function of the TranSF status of a channel.*/
-static UINT8 _Cantp_TimeoutTranSF(bl_CanTpChannel_t *channel);
-/** \brief The period function of the TranFF status of a channel.*/
-static void _Cantp_PeriodTranFF(bl_CanTpChannel_t *channel);
-/** \brief The timeout function of the TranFF status of a channel.*/
-static UINT8 _Cantp_TimeoutTranFF(bl_CanTpChannel_t *channel);
-/** \brief The period function of the TranCF status of a channel.*/
-static void _Cantp_PeriodTranCF(bl_CanTpChannel_t *channel);
-/** \brief The timeout function of the TranCF status of a channel.*/
-static UINT8 _Cantp_TimeoutTranCF(bl_CanTpChannel_t *channel);
-/** \brief The period function of the RecvFC status of a channel.*/
-static void _Cantp_PeriodRecvFC(bl_CanTpChannel_t *channel);
-/** \brief The timeout function of the RecvFC status of a channel.*/
-static UINT8 _Cantp_TimeoutRecvFC(bl_CanTpChannel_t *channel);
-
-/*****************************************************************************
- *  Internal Variable Definitions
- *****************************************************************************/
-/** \brief The PCI used to standard, extanded or mixed channel.*/
-static const bl_CanTpPciInfo_t gs_CanTpPciInfo[CANTP_NUMBER_OF_PCI_INFO] =
-{
-    /*The channel type is CANTP_TYPE_STANDARD.*/
-    {
-        0,1,2,1,2,
-#if (ENABLE_CANFD == ON)
-        63,/***最大的SF和CF的数据大小***/
-        62,/***最大的FF的数据大小***/
-        3 /***最大的FC的数据大小***/
-#else
-        7,
-        6,
-        3
-#endif
-    },
-    /*The channel type is CANTP_TYPE_EXTENDED or CANTP_TYPE_MIXED.*/
-    {
-        1,2,3,2,3,6,5,4
-    },
-};
-
-/** \brief The period schedule interface of the Rx channel.*/
-static const bl_CanTpPeriodIF_t gs_RxPeriodList[CANTP_NUMBER_OF_RX_STATUS] =
-{
-    {
-        &_Cantp_PeriodIdle,&_Cantp_TimeoutIdle
-    },
-    {
-        &_Cantp_PeriodRecvSF,&_Cantp_TimeoutRecvSF
-    },
-    {
-        &_Cantp_PeriodRecvFF,&_Cantp_TimeoutRecvFF
-    },
-    {
-        &_Cantp_PeriodRecvCF,&_Cantp_TimeoutRecvCF
-    },
-    {
-        &_Cantp_PeriodTranFC,&_Cantp_TimeoutTranFC
-    },
-};
-
-/** \brief The period schedule interface of the Tx channel.*/
-static const bl_CanTpPeriodIF_t gs_TxPeriodList[CANTP_NUMBER_OF_TX_STATUS] =
-{
-    {
-        &_Cantp_PeriodIdle,&_Cantp_TimeoutIdle
-    },
-    {
-        &_Cantp_PeriodTranSF,&_Cantp_TimeoutTranSF
-    },
-    {
-        &_Cantp_PeriodTranFF,&_Cantp_TimeoutTranFF
-    },
-    {
-        &_Cantp_PeriodTranCF,&_Cantp_TimeoutTranCF
-    },
-    {
-        &_Cantp_PeriodRecvFC,&_Cantp_TimeoutRecvFC
-    },
-};
-/** \brief The Tx confirmation interface of a channel.*/
-static const bl_CanTpTxConfirm_t gs_TxConfirmList[CANTP_NUMBER_OF_TX_STATUS] =
-{
-    &_Cantp_TxConfirmIdle,
-    &_Cantp_TxConfirmSF,
-    &_Cantp_TxConfirmFF,
-    &_Cantp_TxConfirmCF,
-    &_Cantp_TxConfirmFC
-};
-
-/** \brief The Rx process interface of a channel.*/
-static const bl_CanTpRxProcess_t gs_RxProcessList[CANTP_NUMBER_OF_FRAME_TYPE] =
-{
-    &_Cantp_ReceiveSF,
-    &_Cantp_ReceiveFF,
-    &_Cantp_ReceiveCF,
-    &_Cantp_ReceiveFC
-};
-
-
-
-/** \brief The Rx channel list.*/
-static bl_CanTpChannel_t gs_CanTpRxChannel[CANTP_NUMBER_OF_RX_CHANNEL];
-/** \brief The Tx channel list.*/
-static bl_CanTpChannel_t gs_CanTpTxChannel[CANTP_NUMBER_OF_TX_CHANNEL];
-
-/** \brief The transmitting channel list.*/
-static bl_CanTpChannel_t *gs_TransmittingChannel[CANTP_NUMBER_OF_TX_CHANNEL];
-
-/*************************************************************************************************************
-                                          Function Definitions
- ************************************************************************************************************/
-/*************************************************************************************************************
-* Function Name  : FblCanTpColdInit
-* Description    : 
-* Input          : None
-* Output         : None
-* Return         : TRUE/FALSE
-*************************************************************************************************************/
-UINT8 FblCanTpColdInit(void)
-{       
-    //FblTpInit();
-    CanTp_Init();
-    return INIT_SUCCESS;
-}
-
-/*************************************************************************************************************
-* Function Name  : FblCanTpWarmInit
-* Description    : 
-* Input          : None
-* Output         : None
-* Return         : TRUE/FALSE
-*************************************************************************************************************/
-UINT8 FblCanTpWarmInit(void)
-{
-    //FblTpInit();
-    CanTp_Init();
-    return INIT_SUCCESS;
-}
-
-/*************************************************************************************************************
-* Function Name  : FblCanTpTask
-* Description    : 
-* Input          : uwEventId
-                 : pucData
-* Output         : None
-* Return         : None
-*************************************************************************************************************/
-void FblCanTpTask(UINT16 uwEventId,UINT8 *pucData)
-{
-    /*Parameter validity check*/
-    RETURN_IF_FAIL(NULL != pucData);
-    
-    if(uwEventId & EVENT_MSG_READY){
-        FblCanTpMsgHandle(pucData);
-    } 
-
-    if(uwEventId & EVENT_READY){
-        FblCanTpEventHandle(uwEventId); 
-    } 
-}
-
-/*************************************************************************************************************
-* Function Name  : FblCanTpMsgHandle
-* Description    : 
-* Input          : None
-* Output         : None
-* Return         : None
-*************************************************************************************************************/
-static void FblCanTpMsgHandle(UINT8 *pucData)
-{
-    
-}
-
-/*************************************************************************************************************
-* Function Name  : FblCanTpEventHandle
-* Description    : 
-* Input          : uwEventId
-* Output         : None
-* Return         : None
-*************************************************************************************************************/
-static void FblCanTpEventHandle(UINT16 uwEventId)
-{
-    if(uwEventId & EVENT_SCAN_TIMER)
-    {
-        Cantp_PeriodFunction();
-    }
-}
-
-/**************************************************************************//**
- *
- *  \details    Initialize the can TP module.
- *
- *  \return None.
- *
- *  \since  V1.0.0
- *
- *****************************************************************************/
-static void CanTp_Init(void)
-{
-    UINT8 handle;
-    bl_CanTpChannel_t *channel;
-    const bl_CanTpChannelCfg_t *channelCfg;
-
-    /*Initialize the RX channels*/
-    for (handle = 0; handle < CANTP_NUMBER_OF_RX_CHANNEL; handle++)
-    {
-        channel = &gs_CanTpRxChannel[handle];
-        channelCfg = &g_CanTpRxChnsCfg[handle];
-        _Cantp_InitChannel(channel, channelCfg);
-    }
-
-    /*Initialize the TX channels*/
-    for (handle = 0; handle < CANTP_NUMBER_OF_TX_CHANNEL; handle++)
-    {
-        channel = &gs_CanTpTxChannel[handle];
-        channelCfg = &g_CanTpTxChnsCfg[handle];
-        _Cantp_InitChannel(channel, channelCfg);
-    }
-
-    return ;
-}
-
-/**************************************************************************//**
- *
- *  \details Transmit the data.
- *
- *  \param[in]  handle - Tx handle.
- *  \param[in]  size - the size of the data.
- *
- *  \return None.
- *
- *  \since  V2.0.0
- *
- *****************************************************************************/
-UINT8 Cantp_Transmit(bl_CanTpHandle_t handle, bl_BufferSize_t size)
-{
-    UINT8  ret = ERR_ERROR;
-    bl_CanTpChannel_t *channel;
-    const bl_CanTpPciInfo_t *pci;
-
-    BL_DEBUG_ASSERT_PARAM(handle < CANTP_NUMBER_OF_TX_CHANNEL);
-    BL_DEBUG_ASSERT_PARAM(size != 0);
-
-    channel = &gs_CanTpTxChannel[handle];
-    
-    if(CANTP_STATUS_IS_IDLE(channel))
-    {
-        pci = channel->pciInfo;
-
-        if (size > (pci->maxDataSize))
-        {
-            if (CANTP_IS_PHYSICAL_CHANNEL(channel))
-            {
-                _Cantp_SetMultipleFrameSize(channel,size);
-                _Cantp_GotoTranFF(channel);
-
-                ret = ERR_OK;
-            }
-        }
-        else
-        {
-            channel->lastSize = (UINT8)size;
-            _Cantp_GotoTranSF(channel);
-
-            ret = ERR_OK;
-        }
-    }
-
-    return ret;
-}
-
-/**************************************************************************//**
- *
- *  \details    If a tx channel wait for receiving a FC frame, The tx channel
- *              process this frame. otherwise the rx channel process it.
- *
- *  \param[in]  handle - rx handle of the canif.
- *  \param[in]  size - the size of the data.
- *  \param[in]  buffer - the content of the data.
- *
- *  \return None.
- *
- *  \since  V2.0.0
- *
- *****************************************************************************/
-void Cantp_RxIndication(UINT16 id,
-                            bl_BufferSize_t size,
-                            const bl_Buffer_t *buffer)
-{
-    bl_CanTpChannel_t *channel;
-    UINT8 ret;
-
-    /*Check whether the parameters are valid.*/
-#if (CANTP_FUN_RX_FRAME_PADDING == ON)
-    if ((CANTP_MAX_FRAME_SIZE >= size) && (buffer != NULL_PTR))
-#else
-    if ((size > 0) && (buffer != NULL_PTR))
-#endif
-    {
-        channel = _Cantp_GetChannelByRxId(id,
-                                            CANTP_NUMBER_OF_TX_CHANNEL,
-                                            gs_CanTpTxChannel);
-        ret = _Cantp_RxIndToTxChannel(channel,size,buffer);/***仅接收流控帧***/
-        if (ret != ERR_OK)   /*the Tx channel is not process this frame.*/
-        {
-            channel = _Cantp_GetChannelByRxId(id,
-                                                CANTP_NUMBER_OF_RX_CHANNEL,
-                                                gs_CanTpRxChannel);
-            (void)_Cantp_RxIndToRxChannel(channel,size,buffer);/***接收除流控帧外的其他帧***/
-
-        }
-    }
-
-    return ;
-}
-
-/**************************************************************************//**
- *
- *  \details    If a channel wait for a confirmation, call the confirmation
- *              function of this channel.
- *
- *  \param[in]  handle - tx handle of the canif.
- *
- *  \return None.
- *
- *  \since  V2.0.0
- *
- *****************************************************************************/
-void Cantp_TxConfirmation(UINT16 id)
-{
-    bl_CanTpChannel_t *channel;
-    bl_CanTpTxConfirm_t confirm;
-    UINT16 i;
-
-    for (i = 0; i < CANTP_NUMBER_OF_TX_CHANNEL; i++)
-    {
-        channel = gs_TransmittingChannel[i];
-        if ((channel != NULL_PTR) && (channel->chnCfg->txId == id))
-        {
-            BL_DEBUG_ASSERT_NO_RET(channel->status<CANTP_NUMBER_OF_TX_STATUS);
-
-            confirm = gs_TxConfirmList[channel->status];
-
-            confirm(channel);
-
-            gs_TransmittingChannel[i] = NULL_PTR;
-
-            break;
-        }
-    }
-
-    return ;
-}
-
-/**************************************************************************//**
- *
- *  \details    When the timer of a channel is not timeout, call the period
- *              function. If the timer is timeout, call the timeout function.
- *
- *  \return None.
- *
- *  \since  V2.0.0
- *
- *****************************************************************************/
-void Cantp_PeriodFunction(void)
-{
-    _Cantp_PeriodFunction(CANTP_NUMBER_OF_RX_CHANNEL,
-                            gs_CanTpRxChannel,
-                            gs_RxPeriodList);
-
-    _Cantp_PeriodFunction(CANTP_NUMBER_OF_TX_CHANNEL,
-                            gs_CanTpTxChannel,
-                            gs_TxPeriodList);
-}
-
-/**************************************************************************//**
- *
- *  \details Initialize the channel of the cantp module.
- *
- *  \param[in]  channel     - the pointer of a cantp channel.
- *  \param[in]  channelCfg  - the pointer of a cantp channel cfg in ROM.
- *
- *  \return None.
- *
- *  \since  V2.0.0
- *
- *****************************************************************************/
-static void _Cantp_InitChannel(bl_CanTpChannel_t *channel,
-                                const bl_CanTpChannelCfg_t *channelCfg)
-{
-    BL_DEBUG_ASSERT_NO_RET(channel != NULL_PTR);
-    BL_DEBUG_ASSERT_NO_RET(channelCfg != NULL_PTR);
-    
-    CANTP_STATUS_GOTO_IDLE(channel);
-    CANTP_SUB_STATUS_GOTO_IDLE(channel);
-
-    CANTP_INIT_STMIN_BY_CFG(channel, channelCfg);
-    CANTP_INIT_BS_BY_CFG(channel, channelCfg);
-    CANTP_INIT_MAXWFT_BY_CFG(channel, channelCfg);
-    CANTP_INIT_TATYPE_BY_CFG(channel, channelCfg);
-
-    CANTP_INIT_TIMER(channel);
-
-    if (CANTP_TYPE_STANDARD == channelCfg->type)
-    {
-        channel->pciInfo = &gs_CanTpPciInfo[CANTP_STANDARD_PCI_INFO];
-    }
-    else
-    {
-        channel->pciInfo = &gs_CanTpPciInfo[CANTP_EXTENDED_PCI_INFO];
-    }
-
-    channel->chnCfg = channelCfg;
-    return ;
-}
-
-/**************************************************************************//**
- *
- *  \details Get the cantp channel by the receiving handle.
- *
- *  \param[in]  handle  - the receiving handle of the canif moudle.
- *  \param[in]  chnNum  - the number of channels.
- *  \param[in]  chnList - the channels
- *
- *  \return If the rxId of a channel equal to the handle then return a pointer
- *          of the channel, otherwise returns NULL_PTR.
- *
- *  \since  V2.0.0
- *
- *****************************************************************************/
-static bl_CanTpChannel_t * _Cantp_GetChannelByRxId(UINT16 id,
-                                                    UINT16 chnNum,
-                                                    bl_CanTpChannel_t *chnList)
-{
-    bl_CanTpChannel_t *channel = NULL_PTR;
-    UINT16 i;
-
-    for (i = 0; i < chnNum; i++)
-    {
-        if (chnList[i].chnCfg->rxId == id)
-        {
-            channel = &chnList[i];
-            break;
-        }
-    }
-
-    return channel;
-}
-
-/**************************************************************************//**
- *
- *  \details calculate the CF count and the size of last CF by the total size
- *           of transmitting or receiving data.
- *
- *  \param[in]  channel - the pointer of a cantp channel.
- *  \param[in]  size    - the total size of transmitting or receiving data.
- *
- *  \return None.
- *
- *  \since  V5.1.0
- *
- *****************************************************************************/
-static void _Cantp_SetMultipleFrameSize(bl_CanTpChannel_t *channel,
-                                        bl_BufferSize_t size)
-{
-    bl_BufferSize_t tmpSize;
-    UINT16 tmpCnt;
-    const bl_CanTpPciInfo_t *pci = channel->pciInfo;
-
-    BL_DEBUG_ASSERT_NO_RET(size > pci->maxDataSize);
-    BL_DEBUG_ASSERT_NO_RET(pci->maxDataSize != 0);
-
-    tmpCnt = (size / ((bl_BufferSize_t)pci->maxDataSize));
-
-    tmpSize = (size % ((bl_BufferSize_t)pci->maxDataSize)) + 1u;
-
-    CANTP_SET_TOTAL_SIZE(channel,size);
-    CANTP_SET_LAST_SIZE(channel,tmpSize);
-    CANTP_SET_CFCNT(channel,tmpCnt);
-
-    return ;
-}
-
-/**************************************************************************//**
- *
- *  \details    Calculate the STmin according to ISO 15765-2
- *
- *  \param[in]  st - The STmin is received from the tester.
- *
- *  \return the STmin used by cantp channel.
- *
- *  \since  V5.1.0
- *
- *****************************************************************************/
-static UINT8 _Cantp_GetSTMinFromFC(UINT8 st)
-{
-    UINT8 retSTMin;
-
-    if (st > CANTP_MAX_STMIN_VALUE)
-    {
-        if ((st > CANTP_MIN_STMIN_VALUE_US) && (st < CANTP_MAX_STMIN_VALUE_US))
-        {
-            retSTMin = CANTP_SCHEDULE_PERIOD;
-        }
-        else
-        {
-#if (CANTP_SCHEDULE_PERIOD == 1)
-            retSTMin = CANTP_MAX_STMIN_VALUE;
-#else
-            retSTMin = (CANTP_MAX_STMIN_VALUE / CANTP_SCHEDULE_PERIOD) + 1;
-#endif
-        }
-
-    }
-    else
-    {
-#if (CANTP_SCHEDULE_PERIOD == 1)
-        retSTMin = st + 1;
-#else
-        retSTMin = (st / CANTP_SCHEDULE_PERIOD) + 1;
-#endif
-
-    }
-
-    return retSTMin;
-}
-
-/**************************************************************************//**
- *
- *  \details the period function of the cantp module.
- *
- *  \param[in]  num - The number of the channels in the list.
- *  \param[in]  channelList - the list of the channels.
- *  \param[in]  periodList - the list of the period and timeout interface of
- *                           the channel.
- *
- *  \return None.
- *
- *  \since  V5.0.0
- *
- *****************************************************************************/
-static void _Cantp_PeriodFunction(UINT16 num,
-                                    bl_CanTpChannel_t *channelList,
-                                    const bl_CanTpPeriodIF_t *periodList)
-{
-    bl_CanTpChannel_t *channel;
-    UINT8 ret;
-    UINT16 i;
-
-    for (i = 0; i < num; i++)
-    {
-        channel = &channelList[i];
-        if (CANTP_IS_TIMEOUT(channel))
-        {
-            ret = periodList[channel->status].Timeout(channel);
-            if (ERR_OK == ret)
-            {
-                _Cantp_GotoIdle(channel);
-            }
-        }
-        else
-        {
-            channel->timer -= 1;
-            periodList[channel->status].Period(channel);
-        }
-    }
-}
-
-/**************************************************************************//**
- *
- *  \details Indicate a rx channel to receive a frame data.
- *
- *  \param[in]  channel - the pointer of a rx channel.
- *  \param[in]  size - the size of received data
- *  \param[in]  buffer - the contents of received data.
- *
- *  \return If the received data can be processed by the rx channel, returns
- *          the ERR_OK. Otherwise returns ERR_ERROR.
- *
- *  \since  V5.0.0
- *
- *****************************************************************************/
-static UINT8 _Cantp_RxIndToRxChannel(bl_CanTpChannel_t *channel,
-                                            bl_BufferSize_t size,
-                                            const bl_Buffer_t *buffer)
-{
-    bl_CanTpRxProcess_t processor;
-    UINT8 frameType;
-    UINT8 ret = ERR_ERROR;
-
-    if (channel != NULL_PTR)
-    {
-        if ((channel->chnCfg->type == CANTP_TYPE_STANDARD)
-            || (channel->chnCfg->ta == buffer[CANTP_TA_OFFSET]))
-        {
-            frameType = CANTP_GET_FRAME_TYPE(channel->pciInfo,buffer);
-            if (frameType < CANTP_FRAME_TYPE_FC)
-            {
-                processor = gs_RxProcessList[frameType];
-                ret = processor(channel,size,buffer);
-            }
-        }
-    }
-
-    return ret;
-}
-
-/**************************************************************************//**
- *
- *  \details Indicate a tx channel to receive a frame data.
- *
- *  \param[in]  channel - the pointer of a tx channel.
- *  \param[in]  size - the size of received data
- *  \param[in]  buffer - the contents of received data.
- *
- *  \return If the received data can be processed by the tx channel, returns
- *          the ERR_OK. Otherwise returns ERR_ERROR.
- *
- *  \since  V5.0.0
- *
- *****************************************************************************/
-static UINT8 _Cantp_RxIndToTxChannel(bl_CanTpChannel_t *channel,
-                                            bl_BufferSize_t size,
-                                            const bl_Buffer_t *buffer)
-{
-    bl_CanTpRxProcess_t processor;
-    UINT8 frameType;
-    UINT8 ret = ERR_ERROR;
-    
-    if (channel != NULL_PTR)
-    {
-        if ((channel->chnCfg->type == CANTP_TYPE_STANDARD)
-            || (channel->chnCfg->ta == buffer[CANTP_TA_OFFSET]))
-        {
-            frameType = CANTP_GET_FRAME_TYPE(channel->pciInfo,buffer);
-            if (frameType == CANTP_FRAME_TYPE_FC)
-            {
-                processor = gs_RxProcessList[frameType];
-                ret = processor(channel,size,buffer);
-            }
-        }
-    }
-
-    return ret;
-}
-
-/**************************************************************************//**
- *
- *  \details    receive a frame according to the Single Frame in
- *              the ISO 15765-2.
- *
- *  \param[in]  channel - the pointer of a channel.
- *  \param[in]  size - the size of received data
- *  \param[in]  buffer - the contents of received data.
- *
- *  \return If the received data can be processed by the channel, returns
- *          the ERR_OK. Otherwise returns ERR_ERROR.
- *
- *  \since  V5.0.0
- *
- *****************************************************************************/
-static UINT8 _Cantp_ReceiveSF(bl_CanTpChannel_t *channel,
-                                    bl_BufferSize_t size,
-                                    const bl_Buffer_t *buffer)
-{
-    const bl_CanTpPciInfo_t *pci;
-    UINT8 ret = ERR_ERROR;
-    UINT8 tmpSize;
-
-    pci = channel->pciInfo;
-#if(CANTP_COMMUNICATION_DUPLEX == CANTP_HALF_DUPLEX)
-    if((CANTP_STATUS_IS_IDLE(&gs_CanTpTxChannel[CANTP_TATYPE_PHYSICAL])) 
-        || (CANTP_IS_FUNCTIONAL_CHANNEL(channel)))
-    {
-#endif
-#if (ENABLE_CANFD == ON)
-        /***获得SF_DL***/
-        if(size <= 8)
-        {
-            tmpSize = CANTP_GET_SF_DATASIZE(buffer[pci->pciPos]);
-        }
-        else
-        {
-            tmpSize = CANTP_GET_SF_DATASIZE(buffer[(pci->pciPos) + 1]);
-            if((0x00 != CANTP_GET_SF_DATASIZE(buffer[pci->pciPos]))
-              ||(tmpSize < 8))
-            {
-                return ret;
-            }
-        }
-#else
-        tmpSize = CANTP_GET_SF_DATASIZE(buffer[pci->pciPos]);
-#endif
-        if ((tmpSize != 0) && (tmpSize <= pci->maxDataSize) && (tmpSize < size))
-        {
-            /*  When continuous SF is received in one channel during
-                a timeout period,It maybe break other channel.
-                So If a channel do not get the buffer from DCM module,
-                do NOT indicate.*/
-            if(CANTP_IS_GETTING_BUFFER(channel))
-
-            {
-                Diag_RxIndication(channel->taType, ERR_ERROR);
-            }
-#if (ENABLE_CANFD == ON)
-            if(tmpSize >= 8 )
-            {
-                FblMemCpy(channel->frame, &buffer[(pci->dataPos) + 1], (UINT16)tmpSize);
-            }
-            else
-#endif
-            {
-                FblMemCpy(channel->frame, &buffer[pci->dataPos], (UINT16)tmpSize);
-            }
-            channel->lastSize = tmpSize;
-
-            CANTP_STATUS_GOTO_RECVSF(channel);
-            CANTP_INIT_TIMER_B(channel);
-
-            ret = ERR_OK;
-        }
-#if(CANTP_COMMUNICATION_DUPLEX == CANTP_HALF_DUPLEX)
-    }
-#endif
-    return ret;
-}
-/**************************************************************************//**
- *
- *  \details    receive a frame according to the First Frame in
- *              the ISO 15765-2.
- *
- *  \param[in]  channel - the pointer of a channel.
- *  \param[in]  size - the size of received data
- *  \param[in]  buffer - the contents of received data.
- *
- *  \return If the received data can be processed by the channel, returns
- *          the ERR_OK. Otherwise returns ERR_ERROR.
- *
- *  \since  V5.0.0
- *
- *****************************************************************************/
-static UINT8 _Cantp_ReceiveFF(bl_CanTpChannel_t *channel,
-                                    bl_BufferSize_t size,
-                                    const bl_Buffer_t *buffer)
-{
-    const bl_CanTpPciInfo_t *pci;
-    UINT8 ret = ERR_ERROR;
-    bl_BufferSize_t totalSize;
-
-    if (CANTP_IS_PHYSICAL_CHANNEL(channel))
-    {
-        pci = channel->pciInfo;
-#if(CANTP_COMMUNICATION_DUPLEX == CANTP_HALF_DUPLEX)
-        if(CANTP_STATUS_IS_IDLE(&gs_CanTpTxChannel[CANTP_TATYPE_PHYSICAL]))
-        {
-#endif
-#if (ENABLE_CANFD == ON)
-            totalSize = CANTP_GET_FF_DATASIZE(buffer[pci->pciPos],buffer[(pci->pciPos) + 1]);
-
-            if(totalSize == 0x0000)/***FF_DL>4095***/
-            {
-                /***暂时不支持大于4095的数据***/
-                return ret;
-                /*totalSize = CANTP_GET_FF_DATASIZE2(buffer[(pci->pciPos) + 2],buffer[(pci->pciPos) + 3], \
-                                                   buffer[(pci->pciPos) + 3],buffer[(pci->pciPos) + 4]);*/
-            }
-#else
-            totalSize = CANTP_GET_FF_DATASIZE(buffer[pci->pciPos],buffer[(pci->pciPos) + 1]);
-#endif
-#if (CANTP_FUN_RX_FRAME_PADDING == ON)
-            if((totalSize > pci->maxFFDataSize) && (CANTP_MAX_FRAME_SIZE == size))
-#else
-            if (totalSize > pci->maxFFDataSize)
-#endif
-            {
-                /*  When continuous FF is received in one channel during
-                    a timeout period,It maybe break other physical channel.
-                    So If a channel do not get the buffer from DCM module,
-                    do NOT indicate.*/
-                if(CANTP_IS_GETTING_BUFFER(channel))
-                {
-                    Diag_RxIndication(channel->taType, ERR_ERROR);
-                }
-                FblMemCpy(channel->frame,&buffer[pci->ffDataPos],(UINT16)(size - pci->pciPos));
-                _Cantp_SetMultipleFrameSize(channel,totalSize);
-
-                CANTP_INIT_SN(channel);
-                CANTP_INIT_MAXWFT_BY_CFG(channel,channel->chnCfg);
-                CANTP_STATUS_GOTO_RECVFF(channel);
-                CANTP_INIT_TIMER_B(channel);
-
-                ret = ERR_OK;
-            }
-#if(CANTP_COMMUNICATION_DUPLEX == CANTP_HALF_DUPLEX)
-        }
-#endif
-    }
-
-    return ret;
-}
-
-/**************************************************************************//**
- *
- *  \details    receive a frame according to the Consecutive Frame in
- *              the ISO 15765-2.
- *
- *  \param[in]  channel - the pointer of a channel.
- *  \param[in]  size - the size of received data
- *  \param[in]  buffer - the contents of received data.
- *
- *  \return If the received data can be processed by the channel, returns
- *          the ERR_OK. Otherwise returns ERR_ERROR.
- *
- *  \since  V5.0.0
- *
- *****************************************************************************/
-static UINT8 _Cantp_ReceiveCF(bl_CanTpChannel_t *channel,
-                                    bl_BufferSize_t size,
-                                    const bl_Buffer_t *buffer)
-{
-    const bl_CanTpPciInfo_t *pci;
-    UINT8 ret = ERR_ERROR;
-    UINT8 expectedSN;
-    UINT8 recvSN;
-    UINT8 tmpSize;
-
-    pci = channel->pciInfo;
-#if(CANTP_COMMUNICATION_DUPLEX == CANTP_HALF_DUPLEX)
-    if(CANTP_STATUS_IS_IDLE(&gs_CanTpTxChannel[CANTP_TATYPE_PHYSICAL]))
-    {
-#endif
-        do
-        {
-            if (CANTP_STATUS_IS_NOT_RECVCF(channel)
-                || (0 == channel->cfCnt))   /*avoid unwanted CF*/
-            {
-                break;
-            }
-#if (CANTP_FUN_RX_FRAME_PADDING == OFF)
-            if (1 == channel->cfCnt)        /*the last CF*/
-            {
-                if (size < channel->lastSize)
-                {
-                    break;
-                }
-            }
-            else
-            {
-                if (size < CANTP_MAX_FRAME_SIZE)
-                {
-                    break;
-                }
-            }
-#else
-            (void)size;
-#endif
-
-            expectedSN = GET_LOW_HALF(channel->sn + 1);
-            recvSN = CANTP_GET_CF_SN(pci,buffer);
-            if (recvSN == expectedSN)
-            {
-                channel->sn = expectedSN;
-            }
-            else
-            {
-                Diag_RxIndication(channel->taType, ERR_ERROR);
-                _Cantp_GotoIdle(channel);
-                break;
-            }
-
-            channel->cfCnt -= 1;
-            if (0 == channel->cfCnt)
-            {
-                tmpSize = channel->lastSize;
-            }
-            else
-            {
-                tmpSize = pci->maxDataSize;
-            }
-
-            /*Immediately copy data to buffer avoid continuous CF during a period*/
-            ret = Diag_CopyRxData(tmpSize,&buffer[pci->dataPos]);
-            if (ERR_OK == ret)
-            {
-                /*reset the timer of this channel.*/
-                CANTP_INIT_TIMER_C(channel);
-
-                if ((channel->bs != 0) && (channel->cfCnt != 0))
-                {
-                    channel->bs -= 1;
-                    if (0 == channel->bs)
-                    {
-                        _Cantp_GotoTranFC(channel, CANTP_FC_FRAME_CTS);
-                    }
-                }
-            }
-            else
-            {
-                BL_DEBUG_ASSERT_NO_RET(0);
-                Diag_RxIndication(channel->taType, ERR_ERROR);
-                _Cantp_GotoIdle(channel);
-            }
-        }while(0);/*lint !e717*/
-#if(CANTP_COMMUNICATION_DUPLEX == CANTP_HALF_DUPLEX)
-    }
-#endif
-    return ret;
-}
-
-/**************************************************************************//**
- *
- *  \details    receive a frame according to the Flow Control Frame in
- *              the ISO 15765-2.
- *
- *  \param[in]  channel - the pointer of a channel.
- *  \param[in]  size - the size of received data
- *  \param[in]  buffer - the contents of received data.
- *
- *  \return If the received data can be processed by the channel, returns
- *          the ERR_OK. Otherwise returns ERR_ERROR.
- *
- *  \since  V5.0.0
- *
- *****************************************************************************/
-static UINT8 _Cantp_ReceiveFC(bl_CanTpChannel_t *channel,
-                                    bl_BufferSize_t size,
-                                    const bl_Buffer_t *buffer)
-{
-    const bl_CanTpPciInfo_t *pci;
-    UINT8 ret = ERR_ERROR;
-    UINT8 fs;
-    UINT8 tmpSt;
-    pci = channel->pciInfo;
-
-#if(CANTP_COMMUNICATION_DUPLEX == CANTP_HALF_DUPLEX)
-    if(CANTP_STATUS_IS_IDLE(&gs_CanTpRxChannel[CANTP_TATYPE_PHYSICAL]))
-    {
-#endif
-        /*if the status of this channel is not waiting for FC*/
-#if (CANTP_FUN_RX_FRAME_PADDING == OFF)
-        if (CANTP_STATUS_IS_RECVFC(channel) && (size >= pci->maxFCDataSize))
-#else
-        (void)size;
-
-        if (CANTP_STATUS_IS_RECVFC(channel))
-#endif
-        {
-            fs = CANTP_GET_FC_FS(channel->pciInfo,buffer);
-
-            switch(fs)
-            {
-                case CANTP_FC_FRAME_CTS:
-                    channel->bs = CANTP_GET_FC_BS(channel->pciInfo,buffer);
-                    tmpSt = CANTP_GET_FC_STMIN(pci,buffer);
-                    channel->st = _Cantp_GetSTMinFromFC(tmpSt);
-
-                    _Cantp_GotoTranCF(channel);
-                    break;
-                case CANTP_FC_FRAME_WAIT:
-                    CANTP_INIT_TIMER_B(channel);
-                    break;
-                case CANTP_FC_FRAME_OVERFLOW:
-                    Diag_TxConfirmation(ERR_OVERFLOW);
-                    _Cantp_GotoIdle(channel);
-                    break;
-                default:
-                    Diag_TxConfirmation(ERR_ERROR);
-                    _Cantp_GotoIdle(channel);
-                    break;
-            }
-
-            ret = ERR_OK;
-        }
-#if(CANTP_COMMUNICATION_DUPLEX == CANTP_HALF_DUPLEX)
-    }
-#endif
-    return ret;
-
-}
-
-
-/**************************************************************************//**
- *
- *  \details    Make the PCI information according to Single Frame and save it
- *              to the local frame of the channel.
- *
- *  \param[in/out]  channel - the pointer of a tx channel.
- *
- *  \return None
- *
- *  \since  V5.1.0
- *
- *****************************************************************************/
-static void _Cantp_MakePciOfSF(bl_CanTpChannel_t *channel)
-{
-    const bl_CanTpPciInfo_t *pci = channel->pciInfo;
-    bl_Buffer_t *frame = channel->frame;
-
-    if (channel->chnCfg->type != CANTP_TYPE_STANDARD)
-    {
-        frame[CANTP_TA_OFFSET] = channel->chnCfg->ta;
-    }
-
-    frame[pci->pciPos] = GET_LOW_HALF(channel->lastSize);
-
-    return ;
-}
-
-/**************************************************************************//**
- *
- *  \details    Make the PCI information according to First Frame and save it
- *              to the local frame of the channel.
- *
- *  \param[in/out]  channel - the pointer of a tx channel.
- *
- *  \return None
- *
- *  \since  V5.1.0
- *
- *****************************************************************************/
-static void _Cantp_MakePciOfFF(bl_CanTpChannel_t *channel)
-{
-    const bl_CanTpPciInfo_t *pci = channel->pciInfo;
-    bl_Buffer_t *frame = channel->frame;
-    bl_BufferSize_t totalSize = channel->totalSize;
-
-    if (channel->chnCfg->type != CANTP_TYPE_STANDARD)
-    {
-        frame[CANTP_TA_OFFSET] = channel->chnCfg->ta;
-    }
-
-    totalSize = (totalSize & CANTP_FRAME_FF_DATASIZE_MASK)
-                + CANTP_FRAME_FF_VAULE_16BITS;
-    frame[pci->pciPos] = (UINT8)(totalSize >> 8);
-    frame[(pci->pciPos) + 1] = (UINT8)(totalSize);
-
-    return ;
-}
-
-/**************************************************************************//**
- *
- *  \details    Make the PCI information according to Consecutive Frame and
- *              save it to the local frame of the channel.
- *
- *  \param[in/out]  channel - the pointer of a tx channel.
- *
- *  \return None
- *
- *  \since  V5.1.0
- *
- *****************************************************************************/
-static void _Cantp_MakePciOfCF(bl_CanTpChannel_t *channel)
-{
-    const bl_CanTpPciInfo_t *pci = channel->pciInfo;
-    bl_Buffer_t *frame = channel->frame;
-
-    if (channel->chnCfg->type != CANTP_TYPE_STANDARD)
-    {
-        frame[CANTP_TA_OFFSET] = channel->chnCfg->ta;
-    }
-
-    frame[pci->pciPos] = CANTP_FRAME_CF_VALUE + GET_LOW_HALF(channel->sn);
-
-    return ;
-}
-
-/**************************************************************************//**
- *
- *  \details    Make the PCI information according to Flow Control Frame and
- *              save it to the local frame of the channel.
- *
- *  \param[in/out]  channel - the pointer of a tx channel.
- *
- *  \return None
- *
- *  \since  V5.1.0
- *
- *****************************************************************************/
-static void _Cantp_MakePciOfFC(bl_CanTpChannel_t *channel)
-{
-    const bl_CanTpPciInfo_t *pci = channel->pciInfo;
-    bl_Buffer_t *frame = channel->frame;
-
-    if (channel->chnCfg->type != CANTP_TYPE_STANDARD)
-    {
-        frame[CANTP_TA_OFFSET] = channel->chnCfg->ta;
-    }
-
-    frame[pci->pciPos] = CANTP_FRAME_FC_VALUE
-                            + GET_LOW_HALF(channel->pData);
-    frame[pci->fcBsPos] = channel->bs;
-    frame[pci->fcStPos] = channel->st;
-
-    return ;
-}
-
-/**************************************************************************//**
- *
- *  \details    The tx confirm function is used for the idle statue of channel.
- *
- *  \param[in/out]  channel - the pointer of a tx channel.
- *
- *  \return None
- *
- *  \since  V5.0.0
- *
- *****************************************************************************/
-static void _Cantp_TxConfirmIdle(bl_CanTpChannel_t *channel)
-{
-    (void)channel;
-
-    BL_DEBUG_ASSERT_NO_RET(CANTP_STATUS_IS_NOT_IDLE(channel));
-
-    return ;
-}
-
-/**************************************************************************//**
- *
- *  \details    The tx confirm function is used for the tranSF statue of
- *              channel.
- *
- *  \param[in/out]  channel - the pointer of a tx channel.
- *
- *  \return None
- *
- *  \since  V5.0.0
- *
- *****************************************************************************/
-static void _Cantp_TxConfirmSF(bl_CanTpChannel_t *channel)
-{
-    Diag_TxConfirmation(ERR_OK);
-
-    _Cantp_GotoIdle(channel);
-
-    return ;
-}
-
-/**************************************************************************//**
- *
- *  \details    The tx confirm function is used for the tranFF statue of
- *              channel.
- *
- *  \param[in/out]  channel - the pointer of a tx channel.
- *
- *  \return None
- *
- *  \since  V5.0.0
- *
- *****************************************************************************/
-static void _Cantp_TxConfirmFF(bl_CanTpChannel_t *channel)
-{
-    CANTP_ADD_SN(channel);  /*the First Frame use first SN.*/
-    CANTP_STATUS_GOTO_RECVFC(channel);
-    CANTP_SUB_STATUS_GOTO_IDLE(channel);
-    CANTP_INIT_TIMER_B(channel);
-
-    return ;
-}
-
-/**************************************************************************//**
- *
- *  \details    The tx confirm function is used for the tranCF statue of
- *              channel.
- *
- *  \param[in/out]  channel - the pointer of a tx channel.
- *
- *  \return None
- *
- *  \since  V5.0.0
- *
- *****************************************************************************/
-static void _Cantp_TxConfirmCF(bl_CanTpChannel_t *channel)
-{
-    BL_DEBUG_ASSERT_NO_RET(CANTP_SUB_STATUS_IS_TRAN(channel));
-
-    CANTP_SUB_STATUS_GOTO_IDLE(channel);
-    CANTP_ADD_SN(channel);
-
-    if (channel->cfCnt == 0)
-    {
-        Diag_TxConfirmation(ERR_OK);
-        _Cantp_GotoIdle(channel);
-    }
-    else
-    {
-        if (channel->bs != 0)
-        {
-            channel->bs -= 1;
-            if (0 == channel->bs)
-            {
-                CANTP_STATUS_GOTO_RECVFC(channel);
-                CANTP_INIT_TIMER_B(channel);
-            }
-            else
-            {
-            	CANTP_SET_TIMER(channel,CANTP_CHNNEL_RX_CR);
-            	CANTP_INIT_TXDELAY(channel);
-            }
-        }
-        else
-        {
-            CANTP_SET_TIMER(channel,CANTP_CHNNEL_RX_CR);
-            CANTP_INIT_TXDELAY(channel);
-        }
-    }
-
-    return ;
-}
-
-/**************************************************************************//**
- *
- *  \details    The tx confirm function is used for the tranFC statue of
- *              channel.
- *
- *  \param[in/out]  channel - the pointer of a tx channel.
- *
- *  \return None
- *
- *  \since  V5.0.0
- *
- *****************************************************************************/
-static void _Cantp_TxConfirmFC(bl_CanTpChannel_t *channel)
-{
-    switch(channel->pData)
-    {
-        case CANTP_FC_FRAME_CTS:
-            CANTP_STATUS_GOTO_RECVCF(channel);
-            CANTP_INIT_TIMER_C(channel);
-            break;
-        case CANTP_FC_FRAME_WAIT:
-            CANTP_STATUS_GOTO_RECVFF(channel);
-            CANTP_INIT_TIMER_B(channel);
-            break;
-        default:
-            _Cantp_GotoIdle(channel);
-            break;
-    }
-
-    return ;
-}
-
-/**************************************************************************//**
- *
- *  \details    Change the status of the channel to tranFC status.
- *
- *  \param[in/out]  channel - the pointer of a rx channel.
- *  \param[in] fs - the FS value of the FC frame.
- *
- *  \return None
- *
- *  \since  V5.1.0
- *
- *****************************************************************************/
-static void _Cantp_GotoTranFC(bl_CanTpChannel_t *channel, UINT8 fs)
-{
-    CANTP_STATUS_GOTO_TRANFC(channel);
-    CANTP_SUB_STATUS_GOTO_IDLE(channel);
-    CANTP_INIT_TIMER_A(channel);
-    CANTP_INIT_BS_BY_CFG(channel,channel->chnCfg);
-    CANTP_SET_PRIVATE_DATA(channel,fs);
-
-    return ;
-}
-
-/**************************************************************************//**
- *
- *  \details    Change the status of the channel to Idle status.
- *
- *  \param[in/out]  channel - the pointer of a channel.
- *
- *  \return None
- *
- *  \since  V5.1.0
- *
- *****************************************************************************/
-static void _Cantp_GotoIdle(bl_CanTpChannel_t *channel)
-{
-    CANTP_STATUS_GOTO_IDLE(channel);
-    CANTP_SUB_STATUS_GOTO_IDLE(channel);
-    CANTP_INIT_TIMER(channel);
-
-    return ;
-}
-
-/**************************************************************************//**
- *
- *  \details    Change the status of the channel to tranSF status.
- *
- *  \param[in/out]  channel - the pointer of a tx channel.
- *
- *  \return None
- *
- *  \since  V5.1.0
- *
- *****************************************************************************/
-static void _Cantp_GotoTranSF(bl_CanTpChannel_t *channel)
-{
-    CANTP_STATUS_GOTO_TRANSF(channel);
-    CANTP_SUB_STATUS_GOTO_IDLE(channel);
-    CANTP_INIT_TIMER_A(channel);
-
-    return ;
-}
-
-/**************************************************************************//**
- *
- *  \details    Change the status of the channel to tranFF status.
- *
- *  \param[in/out]  channel - the pointer of a tx channel.
- *
- *  \return None
- *
- *  \since  V5.1.0
- *
- *****************************************************************************/
-static void _Cantp_GotoTranFF(bl_CanTpChannel_t *channel)
-{
-    CANTP_STATUS_GOTO_TRANFF(channel);
-    CANTP_SUB_STATUS_GOTO_IDLE(channel);
-    CANTP_INIT_SN(channel);
-    CANTP_INIT_TIMER_A(channel);
-
-    return ;
-}
-
-/**************************************************************************//**
- *
- *  \details    Change the status of the channel to tranCF status.
- *
- *  \param[in/out]  channel - the pointer of a tx channel.
- *
- *  \return None
- *
- *  \since  V5.1.0
- *
- *****************************************************************************/
-static void _Cantp_GotoTranCF(bl_CanTpChannel_t *channel)
-{
-    CANTP_STATUS_GOTO_TRANCF(channel);
-    CANTP_SUB_STATUS_GOTO_IDLE(channel);
-    CANTP_SET_TIMER(channel,CANTP_CHNNEL_RX_CR);
-    CANTP_INIT_TXDELAY(channel);
-
-    return ;
-}
-
-/**************************************************************************//**
- *
- *  \details    The period function is used for the Idle status of a channel.
- *
- *  \param[in/out]  channel - the pointer of a channel.
- *
- *  \return None
- *
- *  \note   This function is not called except the timer is not set to zero
- *          during the status of this channel is changed to IDLE.
- *
- *  \since  V5.1.0
- *
- *****************************************************************************/
-static void _Cantp_PeriodIdle(bl_CanTpChannel_t *channel)
-{
-    (void)channel;
-    /*  This function is not called except the timer is not set to zero
-        during the status of this channel is changed to IDLE.*/
-    BL_DEBUG_ASSERT_NO_RET(0);
-
-    return ;
-}
-
-/**************************************************************************//**
- *
- *  \details    The timeout function is used for the Idle status of a channel.
- *
- *  \param[in/out]  channel - the pointer of a channel.
- *
- *  \return If the timeout event is processed return ERR_OK, otherwise
- *          return ERR_ERROR.
- *
- *  \note   Avoid unnecessary status switching, this function always returns
- *          ERR_ERROR.
- *
- *  \since  V5.1.0
- *
- *****************************************************************************/
-static UINT8 _Cantp_TimeoutIdle(bl_CanTpChannel_t *channel)
-{
-    (void)channel;
-
-    return ERR_ERROR;
-}
-
-/**************************************************************************//**
- *
- *  \details    The period function is used for the recvSF status of a channel.
- *
- *  \param[in/out]  channel - the pointer of a channel.
- *
- *  \return None
- *
- *  \since V5.1.0
- *
- *****************************************************************************/
-static void _Cantp_PeriodRecvSF(bl_CanTpChannel_t *channel)
-{
-    UINT8 ret;
-    /*alloc the buffer from the Dcm*/
-    ret = Diag_StartOfReception(channel->lastSize);
-    /*if success then copy frame to buffer and goto idle*/
-    if (ERR_OK == ret)
-    {
-        ret = Diag_CopyRxData(channel->lastSize,channel->frame);
-        if (ERR_OK == ret)
-        {
-            Diag_RxIndication(channel->taType, ERR_OK);
-        }
-        else
-        {
-            BL_DEBUG_ASSERT_NO_RET(0);
-            Diag_RxIndication(channel->taType, ERR_ERROR);
-        }
-
-        _Cantp_GotoIdle(channel);
-    }
-
-    return ;
-}
-
-/**************************************************************************//**
- *
- *  \details    The timeout function is used for the recvSF status of a channel.
- *
- *  \param[in/out]  channel - the pointer of a channel.
- *
- *  \return If the timeout event is processed return ERR_OK, otherwise
- *          return ERR_ERROR.
- *
- *  \since  V5.1.0
- *
- *****************************************************************************/
-static UINT8 _Cantp_TimeoutRecvSF(bl_CanTpChannel_t *channel)
-{
-    (void)channel;
-
-    return ERR_OK;
-}
-
-/**************************************************************************//**
- *
- *  \details    The period function is used for the recvFF status of a channel.
- *
- *  \param[in/out]  channel - the pointer of a channel.
- *
- *  \return None
- *
- *  \since V5.1.0
- *
- *****************************************************************************/
-static void _Cantp_PeriodRecvFF(bl_CanTpChannel_t *channel)
-{
-    UINT8 ret;
-    /*Apply for the buffer from the Dcm*/
-    ret = Diag_StartOfReception(channel->totalSize);
-
-    if (ERR_OK == ret)
-    {
-        ret = Diag_CopyRxData(channel->pciInfo->maxFFDataSize,channel->frame);
-        if (ERR_OK == ret)
-        {
-            _Cantp_GotoTranFC(channel, CANTP_FC_FRAME_CTS);
-        }
-        else
-        {
-            BL_DEBUG_ASSERT_NO_RET(0);
-            Diag_RxIndication(channel->taType, ERR_ERROR);
-            _Cantp_GotoIdle(channel);
-        }
-    }
-    else if (ERR_OVERFLOW == ret)
-    {
-        _Cantp_GotoTranFC(channel, CANTP_FC_FRAME_OVERFLOW);
-    }
-    else
-    {
-        /* The buffer busy, wait the next period to alloc again.*/
-    }
-
-    return ;
-
-}
-
-/**************************************************************************//**
- *
- *  \details    The timeout function is used for the recvFF status of a channel.
- *
- *  \param[in/out]  channel - the pointer of a channel.
- *
- *  \return If the timeout event is processed return ERR_OK, otherwise
- *          return ERR_ERROR.
- *
- *  \since  V5.1.0
- *
- *****************************************************************************/
-static UINT8 _Cantp_TimeoutRecvFF(bl_CanTpChannel_t *channel)
-{
-    UINT8 ret = ERR_OK;
-
-    if (channel->wft != 0)
-    {
-        channel->wft -= 1;
-
-        _Cantp_GotoTranFC(channel, CANTP_FC_FRAME_WAIT);
-
-        ret = ERR_ERROR;
-    }
-
-    /* Br timeout, do not indicate the DCM.*/
-    return ret;
-}
-
-/**************************************************************************//**
- *
- *  \details    The period function is used for the recvCF status of a channel.
- *
- *  \param[in/out]  channel - the pointer of a channel.
- *
- *  \return None
- *
- *  \since V5.1.0
- *
- *****************************************************************************/
-static void _Cantp_PeriodRecvCF(bl_CanTpChannel_t *channel)
-{
-    if (0 == channel->cfCnt)
-    {
-        /*All CF is successfully received.*/
-        Diag_RxIndication(channel->taType, ERR_OK);
-
-        _Cantp_GotoIdle(channel);
-    }
-
-    return ;
-}
-
-/**************************************************************************//**
- *
- *  \details    The timeout function is used for the recvCF status of a channel.
- *
- *  \param[in/out]  channel - the pointer of a channel.
- *
- *  \return If the timeout event is processed return ERR_OK, otherwise
- *          return ERR_ERROR.
- *
- *  \since  V5.1.0
- *
- *****************************************************************************/
-static UINT8 _Cantp_TimeoutRecvCF(bl_CanTpChannel_t *channel)
-{
-    (void)channel;
-
-    /*Cr timeout!*/
-    Diag_RxIndication(channel->taType, ERR_ERROR);
-
-    return ERR_OK;
-}
-
-/**************************************************************************//**
- *
- *  \details    The period function is used for the tranFC status of a channel.
- *
- *  \param[in/out]  channel - the pointer of a channel.
- *
- *  \return None
- *
- *  \since V5.1.0
- *
- *****************************************************************************/
-static void _Cantp_PeriodTranFC(bl_CanTpChannel_t *channel)
-{
-    UINT8 ret;
-    bl_BufferSize_t frameSize;
-    bl_Buffer_t *frame;
-    UINT16 id;
-
-
-    BL_DEBUG_ASSERT_NO_RET(channel != NULL_PTR);
-    BL_DEBUG_ASSERT_NO_RET(CANTP_STATUS_IS_TRANFC(channel));
-
-    if (CANTP_SUB_STATUS_IS_IDLE(channel))
-    {
-        _Cantp_MakePciOfFC(channel);
-
-        frameSize = channel->pciInfo->maxFCDataSize;
-        frame = channel->frame;
-        id = channel->chnCfg->txId;
-
-        BL_DEBUG_ASSERT_NO_RET(frameSize != 0);
-
-#if (CANTP_FUN_TX_FRAME_PADDING == ON)
-        Bl_MemSet(&frame[frameSize],
-                    CANTP_FRAME_PADDING_VALUE,
-                    (UINT16)(CANTP_MAX_FRAME_SIZE - frameSize));
-
-        ret = FblCanSendData(frame, id,CANTP_MAX_FRAME_SIZE);
-#else
-        ret = FblCanSendData(frame, id,frameSize);
-
-#endif
-
-        if (ERR_OK == ret)
-        {
-            CANTP_SUB_STATUS_GOTO_TRAN(channel);
-            gs_TransmittingChannel[0] = channel;
-            Cantp_TxConfirmation(id);
-        }
-    }
-
-    return ;
-
-}
-
-/**************************************************************************//**
- *
- *  \details    The timeout function is used for the tranFC status of a channel.
- *
- *  \param[in/out]  channel - the pointer of a channel.
- *
- *  \return If the timeout event is processed return ERR_OK, otherwise
- *          return ERR_ERROR.
- *
- *  \since  V5.1.0
- *
- *****************************************************************************/
-/*lint -e{818}*/
-static UINT8 _Cantp_TimeoutTranFC(bl_CanTpChannel_t *channel)
-{
-    if (channel->pData != CANTP_FC_FRAME_WAIT)
-    {
-        /*  When a FC frame with wait flag is transmitted,
-            this channel do not get a buffer from DCM module.
-            So do NOT indicate the DCM module in order to avoid
-            break other channel.*/
-        Diag_RxIndication(channel->taType, ERR_ERROR);
-    }
-
-    return ERR_OK;
-}
-
-/**************************************************************************//**
- *
- *  \details    The period function is used for the tranSF status of a channel.
- *
- *  \param[in/out]  channel - the pointer of a channel.
- *
- *  \return None
- *
- *  \since V5.1.0
- *
- *****************************************************************************/
-static void _Cantp_PeriodTranSF(bl_CanTpChannel_t *channel)
-{
-    UINT8 ret;
-    UINT8 dataPos;
-    bl_BufferSize_t dataSize;
-    bl_BufferSize_t frameSize;
-    bl_Buffer_t *frame;
-    UINT16 id;
-    BL_DEBUG_ASSERT_NO_RET(channel != NULL_PTR);
-    BL_DEBUG_ASSERT_NO_RET(CANTP_STATUS_IS_TRANSF(channel));
-
-    if (CANTP_SUB_STATUS_IS_IDLE(channel))
-    {
-        _Cantp_MakePciOfSF(channel);
-
-        dataSize = channel->lastSize;
-        frame = channel->frame;
-        dataPos = channel->pciInfo->dataPos;
-        id = channel->chnCfg->txId;
-        frameSize = dataSize + dataPos;
-
-        BL_DEBUG_ASSERT_NO_RET(dataSize != 0);
-        BL_DEBUG_ASSERT_NO_RET(frameSize <= CANTP_MAX_FRAME_SIZE);
-
-        ret = Diag_CopyTxData(dataSize, &frame[dataPos]);
-
-        BL_DEBUG_ASSERT_NO_RET(ERR_OK == ret);
-
-#if (CANTP_FUN_TX_FRAME_PADDING == ON)
-        Bl_MemSet(&frame[frameSize],
-                    CANTP_FRAME_PADDING_VALUE,
-                    (UINT16)(CANTP_MAX_FRAME_SIZE - frameSize));
-
-        ret = FblCanSendData(frame, id,CANTP_MAX_FRAME_SIZE);
-#else
-        ret = FblCanSendData(frame, id,frameSize);
-#endif
-        if (ERR_OK == ret)
-        {
-            CANTP_SUB_STATUS_GOTO_TRAN(channel);
-            gs_TransmittingChannel[0] = channel;
-            Cantp_TxConfirmation(id);
-        }
-    }
-
-    return ;
-}
-
-/**************************************************************************//**
- *
- *  \details    The timeout function is used for the tranSF status of a channel.
- *
- *  \param[in/out]  channel - the pointer of a channel.
- *
- *  \return If the timeout event is processed return ERR_OK, otherwise
- *          return ERR_ERROR.
- *
- *  \since  V5.1.0
- *
- *****************************************************************************/
-static UINT8 _Cantp_TimeoutTranSF(bl_CanTpChannel_t *channel)
-{
-    (void)channel;
-    /*The As timeout.*/
-    Diag_TxConfirmation(ERR_ERROR);
-    return ERR_OK;
-}
-
-/**************************************************************************//**
- *
- *  \details    The period function is used for the tranFF status of a channel.
- *
- *  \param[in/out]  channel - the pointer of a channel.
- *
- *  \return None
- *
- *  \since V5.1.0
- *
- *****************************************************************************/
-static void _Cantp_PeriodTranFF(bl_CanTpChannel_t *channel)
-{
-    UINT8 ret;
-    UINT8 dataPos;
-    bl_BufferSize_t dataSize;
-    bl_Buffer_t *frame;
-    UINT16 id;
-
-    BL_DEBUG_ASSERT_NO_RET(channel != NULL_PTR);
-    BL_DEBUG_ASSERT_NO_RET(CANTP_STATUS_IS_TRANFF(channel));
-    BL_DEBUG_ASSERT_NO_RET(channel->totalSize != 0);
-
-    if (CANTP_SUB_STATUS_IS_IDLE(channel))
-    {
-        _Cantp_MakePciOfFF(channel);
-
-        frame = channel->frame;
-        dataPos = channel->pciInfo->ffDataPos;
-        dataSize = channel->pciInfo->maxFFDataSize;
-        id = channel->chnCfg->txId;
-
-        ret = Diag_CopyTxData(dataSize, &frame[dataPos]);
-
-        BL_DEBUG_ASSERT_NO_RET(ERR_OK == ret);
-
-        ret = FblCanSendData(frame, id,CANTP_MAX_FRAME_SIZE);
-
-        if (ERR_OK == ret)
-        {
-            CANTP_SUB_STATUS_GOTO_TRAN(channel);
-            gs_TransmittingChannel[0] = channel;
-            Cantp_TxConfirmation(id);
-        }
-    }
-
-    return ;
-}
-
-/**************************************************************************//**
- *
- *  \details    The timeout function is used for the tranFF status of a channel.
- *
- *  \param[in/out]  channel - the pointer of a channel.
- *
- *  \return If the timeout event is processed return ERR_OK, otherwise
- *          return ERR_ERROR.
- *
- *  \since  V5.1.0
- *
- *****************************************************************************/
-static UINT8 _Cantp_TimeoutTranFF(bl_CanTpChannel_t *channel)
-{
-    (void)channel;
-    /*The As timeout.*/
-    Diag_TxConfirmation(ERR_ERROR);
-    return ERR_OK;
-}
-
-/**************************************************************************//**
- *
- *  \details    The period function is used for the tranCF status of a channel.
- *
- *  \param[in/out]  channel - the pointer of a channel.
- *
- *  \return None
- *
- *  \since V5.1.0
- *
- *****************************************************************************/
-static void _Cantp_PeriodTranCF(bl_CanTpChannel_t *channel)
-{
-    BL_DEBUG_ASSERT_NO_RET(channel != NULL_PTR);
-    BL_DEBUG_ASSERT_NO_RET(CANTP_STATUS_IS_TRANCF(channel));
-    BL_DEBUG_ASSERT_NO_RET(channel->cfCnt > 0);
-
-    if (CANTP_SUB_STATUS_IS_IDLE(channel))
-    {
-        if (channel->txDelay != 0)
-        {
-            channel->txDelay -= 1;
-        }
-
-        if (channel->txDelay == 0)
-        {
-            _Cantp_TransmitCF(channel);
-        }
-    }
-
-    return ;
-}
-/**************************************************************************//**
- *
- *  \details    transmit a frame according to the Flow Control Frame in
- *              the ISO 15765-2.
- *              If the frame is not transmitted, try again during the next
- *              period.
- *
- *  \param[in/out]  channel - the pointer of a tx channel.
- *
- *  \return None
- *
- *  \since  V5.0.0
- *
- *****************************************************************************/
-static void _Cantp_TransmitCF(bl_CanTpChannel_t *channel)
-{
-    UINT8 ret;
-    UINT8 dataPos;
-    bl_BufferSize_t dataSize;
-    bl_BufferSize_t frameSize;
-    bl_Buffer_t *frame;
-    UINT16 id;
-    UINT16 cfCounter;
-
-    _Cantp_MakePciOfCF(channel);
-
-    cfCounter = channel->cfCnt - 1;
-    if (0 == cfCounter)
-    {
-        dataSize = channel->lastSize;
-    }
-    else
-    {
-        dataSize = channel->pciInfo->maxDataSize;
-    }
-
-    frame = channel->frame;
-    dataPos = channel->pciInfo->dataPos;
-    id = channel->chnCfg->txId;
-    frameSize = dataSize + dataPos;
-    BL_DEBUG_ASSERT_NO_RET(dataSize != 0);
-    BL_DEBUG_ASSERT_NO_RET(frameSize <= CANTP_MAX_FRAME_SIZE);
-
-#if (CANTP_FUN_TX_FRAME_PADDING == ON)
-    Bl_MemSet(&frame[frameSize],
-                CANTP_FRAME_PADDING_VALUE,
-                (UINT16)(CANTP_MAX_FRAME_SIZE - frameSize));
-
-    ret = FblCanSendData(frame, id,CANTP_MAX_FRAME_SIZE );
-#else
-    ret = FblCanSendData(frame, id,CANTP_MAX_FRAME_SIZE );
-#endif
-
-
-    if (ERR_OK == ret)
-    {
-        channel->cfCnt = cfCounter;
-        CANTP_SUB_STATUS_GOTO_TRAN(channel);
-        gs_TransmittingChannel[0] = channel;
-        Cantp_TxConfirmation(id);
-    }
-
-    return ;
-}
-
-/**************************************************************************//**
- *
- *  \details    The timeout function is used for the tranCF status of a channel.
- *
- *  \param[in/out]  channel - the pointer of a channel.
- *
- *  \return If the timeout event is processed return ERR_OK, otherwise
- *          return ERR_ERROR.
- *
- *  \since  V5.1.0
- *
- *****************************************************************************/
-static UINT8 _Cantp_TimeoutTranCF(bl_CanTpChannel_t *channel)
-{
-    (void)channel;
-    /*The As timeout.*/
-    Diag_TxConfirmation(ERR_ERROR);
-    return ERR_OK;
-}
-
-/**************************************************************************//**
- *
- *  \details    The period function is used for the recvFC status of a channel.
- *
- *  \param[in/out]  channel - the pointer of a channel.
- *
- *  \return None
- *
- *  \since V5.1.0
- *
- *****************************************************************************/
-static void _Cantp_PeriodRecvFC(bl_CanTpChannel_t *channel)
-{
-    (void)channel;
-    return ;
-}
-
-/**************************************************************************//**
- *
- *  \details    The timeout function is used for the recvFC status of a channel.
- *
- *  \param[in/out]  channel - the pointer of a channel.
- *
- *  \return If the timeout event is processed return ERR_OK, otherwise
- *          return ERR_ERROR.
- *
- *  \since  V5.1.0
- *
- *****************************************************************************/
-static UINT8 _Cantp_TimeoutRecvFC(bl_CanTpChannel_t *channel)
-{
-    (void)channel;
-    /*The Bs timeout.*/
-    Diag_TxConfirmation(ERR_ERROR);
-    return ERR_OK;
-}
-
-
-
-/*************************************************************************************************************
-                                          End Of File
-*************************************************************************************************************/
+/*************************************************************************************************************
+*    FileName   :    FblCanTp.c
+*    Description:    CAN Transport Protocol Layer for FBL. 
+
+*    UpdateDate :    2022/3/8
+*    Version    :    1.0.0
+*    History    :         
+        1. V1.0.0, 2022/3/8, R515, Initial version.
+
+*************************************************************************************************************/
+
+/*************************************************************************************************************
+                                             Include Files
+*************************************************************************************************************/
+#include "FblCanTp.h"
+#include "FblCanTpCfg.h"
+#include "FblUdsDiag.h"
+#include "FblString.h"
+#if (CANTP_FUN_CLIENT_SCHEDULER == ON)
+#include "FblCanTpSched.h"
+#endif
+#if (CANTP_FUN_GATEWAY_ROUTING == ON)
+#include "FblCanTpRoute.h"
+#endif
+#if (CANTP_FUN_DOIP_GATEWAY == ON)
+#include "FblCanTpDoIp.h"
+#endif
+#if (CANTP_FUN_RX_STREAM == ON)
+#include "FblCanTpStream.h"
+#endif
+
+#include "FblDrvApi.h"
+#include "OsCoreCfg.h" 
+#include "OsCore.h" 
+
+/*************************************************************************************************************
+                                     Local Function Declarations
+ ************************************************************************************************************/
+/** \brief The CTS used for the FS field in the Flow Control Frame.*/
+#define CANTP_FC_FRAME_CTS              (0x00u)
+/** \brief The WAIT used for the FS field in the Flow Control Frame.*/
+#define CANTP_FC_FRAME_WAIT             (0x01u)
+/** \brief The OVERFLOW used for the FS field in the Flow Control Frame.*/
+#define CANTP_FC_FRAME_OVERFLOW         (0x02u)
+/** \brief The WAIT transmitted between two blocks, the FS field is WAIT.*/
+#define CANTP_FC_FRAME_WAIT_BLOCK       (0x11u)
+
+/** \brief The number of the PCI layouts used for different types of cantp
+    channel.*/
+#define CANTP_NUMBER_OF_PCI_LAYOUT      (0x02u)
+/** \brief This PCI layout used for standard cantp channel.*/
+#define CANTP_STANDARD_PCI_LAYOUT       (0x00u)
+/** \brief This PCI layout used for extended or mixed cantp channel, the TA
+    or AE byte is before the PCI.*/
+#define CANTP_EXTENDED_PCI_LAYOUT       (0x01u)
+
+/** \brief The number of the PCI used for different frame sizes of a layout.*/
+#if (ENABLE_CANXL == ON)
+#define CANTP_NUMBER_OF_PCI_INFO        (0x03u)
+#elif (ENABLE_CANFD == ON)
+#define CANTP_NUMBER_OF_PCI_INFO        (0x02u)
+#else
+#define CANTP_NUMBER_OF_PCI_INFO        (0x01u)
+#endif
+/** \brief This PCI used for the classic frames.*/
+#define CANTP_CLASSIC_PCI_INFO          (0x00u)
+/** \brief This PCI used for the CANFD frames, the TX_DL or RX_DL is 64.*/
+#define CANTP_CANFD_PCI_INFO            (0x01u)
+/** \brief This PCI used for the CANXL frames, the TX_DL or RX_DL is 2048.*/
+#define CANTP_CANXL_PCI_INFO            (0x02u)
+
+#if (CANTP_FUN_FIXED_ADDRESSING == ON)
+/** \brief No slot of the pool is used.*/
+#define CANTP_POOL_NONE                 (0xFFu)
+/** \brief No peer of the fixed addressing sent a request.*/
+#define CANTP_FIXED_PEER_NONE           (0xFFFFu)
+/** \brief The number of the addresses in the 29-bit ids.*/
+#define CANTP_NUMBER_OF_ADDRESS         (0x100u)
+/** \brief The mask of the SA in the 29-bit ids.*/
+#define CANTP_FIXED_ID_SA_MASK          (0xFFuL)
+#endif
+
+#if (CANTP_FUN_RX_QUEUE == ON)
+/** \brief The mask of the indexes of the rx queue.*/
+#define CANTP_RX_QUEUE_MASK             ((UINT16)(CANTP_RX_QUEUE_SIZE - 1u))
+#endif
+
+#if (CANTP_FUN_TX_REQUEST_QUEUE == ON)
+/** \brief The mask of the indexes of the tx request queue of a channel.*/
+#define CANTP_TX_REQUEST_QUEUE_MASK     ((UINT8)(CANTP_TX_REQUEST_QUEUE_SIZE - 1u))
+#endif
+
+#if (CANTP_FUN_RX_SF_QUEUE == ON)
+/** \brief The mask of the indexes of the SF queue of a channel.*/
+#define CANTP_RX_SF_QUEUE_MASK          ((UINT8)(CANTP_RX_SF_QUEUE_SIZE - 1u))
+/** \brief The number of the SF queues, one for each rx channel.*/
+#if (CANTP_FUN_FIXED_ADDRESSING == ON)
+#define CANTP_NUMBER_OF_SF_QUEUE        (CANTP_NUMBER_OF_RX_CHANNEL \
+                                            + CANTP_NUMBER_OF_POOL_CHANNEL)
+#else
+#define CANTP_NUMBER_OF_SF_QUEUE        (CANTP_NUMBER_OF_RX_CHANNEL)
+#endif
+#endif
+
+#if (CANTP_FUN_FRAME_POOL == ON)
+/** \brief A channel does not borrow a frame buffer.*/
+#define CANTP_FRAME_BUFFER_NONE         (0xFFu)
+/** \brief The flag of the index of a classic frame buffer.*/
+#define CANTP_FRAME_BUFFER_CLASSIC      (0x80u)
+#endif
+
+#if (CANTP_FUN_CHANNEL_SOA == ON)
+/** \brief The first slots of the rx, tx and pool channels in the dense
+    arrays.*/
+#define CANTP_RX_CHANNEL_SLOT           (0u)
+#define CANTP_TX_CHANNEL_SLOT           (CANTP_RX_CHANNEL_SLOT \
+                                            + CANTP_NUMBER_OF_RX_CHANNEL)
+#if (CANTP_FUN_FIXED_ADDRESSING == ON)
+#define CANTP_POOL_RX_CHANNEL_SLOT      (CANTP_TX_CHANNEL_SLOT \
+                                            + CANTP_NUMBER_OF_TX_CHANNEL)
+#define CANTP_POOL_TX_CHANNEL_SLOT      (CANTP_POOL_RX_CHANNEL_SLOT \
+                                            + CANTP_NUMBER_OF_POOL_CHANNEL)
+/** \brief The number of the slots of all channels.*/
+#define CANTP_NUMBER_OF_CHANNEL_SLOT    (CANTP_POOL_TX_CHANNEL_SLOT \
+                                            + CANTP_NUMBER_OF_POOL_CHANNEL)
+#else
+#define CANTP_NUMBER_OF_CHANNEL_SLOT    (CANTP_TX_CHANNEL_SLOT \
+                                            + CANTP_NUMBER_OF_TX_CHANNEL)
+#endif
+#endif
+
+#if (CANTP_FUN_WARM_HANDOVER == ON)
+/** \brief The record of the handover is valid.*/
+#define CANTP_HANDOVER_MAGIC            (0x484F5652uL)
+#endif
+
+/** \brief The number of the valid CANFD frame sizes bigger than 8.*/
+#define CANTP_NUMBER_OF_CANFD_SIZE      (0x07u)
+
+/** \brief The number of status of the Rx channels.*/
+#define CANTP_NUMBER_OF_RX_STATUS       (0x05u)
+/** \brief The number of status of the Tx channels.*/
+#define CANTP_NUMBER_OF_TX_STATUS       (0x05u)
+
+/** \brief The number of frame types according to ISO 15765-2.*/
+#define CANTP_NUMBER_OF_FRAME_TYPE      (0x04u)
+/** \brief The Single Frame.*/
+#define CANTP_FRAME_TYPE_SF             (0x00u)
+/** \brief The First Frame.*/
+#define CANTP_FRAME_TYPE_FF             (0x01u)
+/** \brief The Consecutive Frame.*/
+#define CANTP_FRAME_TYPE_CF             (0x02u)
+/** \brief The Flow Control Frame.*/
+#define CANTP_FRAME_TYPE_FC             (0x03u)
+
+/** \brief The type value of the Single Frame.*/
+#define CANTP_FRAME_SF_VALUE            (0x00u)
+/** \brief The type value of the First Frame.*/
+#define CANTP_FRAME_FF_VALUE            (0x10u)
+/** \brief The type value of the Consecutive Frame.*/
+#define CANTP_FRAME_CF_VALUE            (0x20u)
+/** \brief The type value of the Flow Control Frame.*/
+#define CANTP_FRAME_FC_VALUE            (0x30u)
+
+/** \brief The 16bits type value of the First Frame.*/
+#define CANTP_FRAME_FF_VAULE_16BITS     (0x1000u)
+
+/** \brief The size of the SF_DL of the escape sequence in the Single Frame.*/
+#define CANTP_FRAME_SF_ESC_SIZE         (0x01u)
+/** \brief The size of the FF_DL of the escape sequence in the First Frame.*/
+#define CANTP_FRAME_FF_ESC_SIZE         (0x04u)
+/** \brief The max size of a message, it is limited by bl_BufferSize_t.*/
+#define CANTP_MAX_MESSAGE_SIZE          (0xFFFFuL)
+
+/** \brief The ta offset in a frame.*/
+#define CANTP_TA_OFFSET                 (0x00u)
+/** \brief The max STmin value.*/
+#define CANTP_MAX_STMIN_VALUE           (0x7Fu)
+#define CANTP_MIN_STMIN_VALUE_US        (0xF0u)
+#define CANTP_MAX_STMIN_VALUE_US        (0xFAu)
+
+/** \brief The Idle status of a channel.*/
+#define CANTP_STATUS_IDLE               (0x00u)
+/** \brief The recvSF status of a Rx channel.*/
+#define CANTP_STATUS_RECEIVING_SF       (0x01u)
+/** \brief The recvFF status of a Rx channel.*/
+#define CANTP_STATUS_RECEIVING_FF       (0x02u)
+/** \brief The recvCF status of a Rx channel.*/
+#define CANTP_STATUS_RECEIVING_CF       (0x03u)
+/** \brief The tranFC status of a Rx channel.*/
+#define CANTP_STATUS_TRANSMITTING_FC    (0x04u)
+
+/** \brief The tranSF status of a Tx channel.*/
+#define CANTP_STATUS_TRANSMITTING_SF    (0x01u)
+/** \brief The tranFF status of a Tx channel.*/
+#define CANTP_STATUS_TRANSMITTING_FF    (0x02u)
+/** \brief The tranCF status of a Tx channel.*/
+#define CANTP_STATUS_TRANSMITTING_CF    (0x03u)
+/** \brief The recvFC status of a Tx channel.*/
+#define CANTP_STATUS_RECEIVING_FC       (0x04u)
+
+/** \brief The sub Idle status of a channel.*/
+#define CANTP_SUB_STATUS_IDLE           (0x00u)
+/** \brief The sub transmitting status of a channel.*/
+#define CANTP_SUB_STATUS_TRANSMITTING   (0x01u)
+/** \brief The sub receiving status of a channel.*/
+#define CANTP_SUB_STATUS_RECEIVING      (0x02u)
+
+/** \brief The mask of data size in the First Frame.*/
+#define CANTP_FRAME_FF_DATASIZE_MASK    (0x0FFFu)
+/** \brief the mask of data size in the Single Frame.*/
+#define CANTP_FRAME_SF_DATASIZE_MASK    (0x0Fu)
+
+/** \brief Get the data size in the Single Frame.*/
+#define CANTP_GET_SF_DATASIZE(data)     GET_LOW_HALF(data)
+/** \brief Get the data size in the First Frame.*/
+#define CANTP_GET_FF_DATASIZE(data,data2)  (((UINT16)(GET_LOW_HALF(data) << 8)| (UINT16)data2) \
+                                                & CANTP_FRAME_FF_DATASIZE_MASK)
+#define CANTP_GET_FF_DATASIZE2(data1,data2,data3,data4)  (((UINT32)(data1) << 24) | ((UINT32)(data2) << 16) \
+                                                    | ((UINT32)(data3) << 8)| ((UINT32)(data4)))
+
+/** \brief Check if a Single Frame uses the escape sequence, the SF_DL does not
+    fit in a classic frame.*/
+#define CANTP_IS_SF_ESCAPE(pci,size)    (((size) + CANTP_DATA_POS(pci)) \
+                                            > CANTP_CLASSIC_FRAME_SIZE)
+/** \brief Check if a First Frame uses the escape sequence, the FF_DL is
+    bigger than 4095.*/
+#define CANTP_IS_FF_ESCAPE(size)        ((size) > CANTP_FRAME_FF_DATASIZE_MASK)
+/** \brief Get the size of the data in the First Frame of a message, the FF
+    fills a frame of the TX_DL or RX_DL.*/
+#define CANTP_GET_FF_DATA_SIZE(pci,dl,size) ((bl_BufferSize_t)((dl) \
+                                                - CANTP_FF_DATA_POS(pci) \
+                                                - (CANTP_IS_FF_ESCAPE(size) \
+                                                    ? CANTP_FRAME_FF_ESC_SIZE : 0u)))
+
+/** \brief Check whether a received frame is valid.*/
+#if (CANTP_FUN_RX_FRAME_PADDING == ON)
+#define CANTP_IS_VALID_FRAME(size,buffer)   ((CANTP_MAX_FRAME_SIZE >= (size)) \
+                                                && ((buffer) != NULL_PTR))
+#else
+#define CANTP_IS_VALID_FRAME(size,buffer)   (((size) > 0) \
+                                                && ((buffer) != NULL_PTR))
+#endif
+
+/** \brief Check if a channel type uses the standard addressing.*/
+#define CANTP_IS_STANDARD_TYPE(type)    (((type) == CANTP_TYPE_STANDARD) \
+                                            || ((type) == CANTP_TYPE_STANDARD_CANFD) \
+                                            || ((type) == CANTP_TYPE_NORMAL_FIXED))
+/** \brief Check if a channel type encodes the TA and SA in the 29-bit id.*/
+#define CANTP_IS_FIXED_TYPE(type)       (((type) == CANTP_TYPE_NORMAL_FIXED) \
+                                            || ((type) == CANTP_TYPE_MIXED_29))
+
+#if (CANTP_FUN_STATIC_PCI_LAYOUT == ON)
+/*All channels use one PCI layout, so the positions in the frames and the
+  TA byte checks are constants.*/
+#if (CANTP_STATIC_STANDARD_LAYOUT == ON)
+#define CANTP_STATIC_PCI_LAYOUT         CANTP_STANDARD_PCI_LAYOUT
+#define CANTP_STATIC_PCI_POS            (0u)
+#define CANTP_IS_STANDARD_CHANNEL(chn)  ((void)(chn), TRUE)
+#else
+#define CANTP_STATIC_PCI_LAYOUT         CANTP_EXTENDED_PCI_LAYOUT
+#define CANTP_STATIC_PCI_POS            (1u)
+#define CANTP_IS_STANDARD_CHANNEL(chn)  ((void)(chn), FALSE)
+#endif
+#define CANTP_PCI_POS(pci)              ((void)(pci), CANTP_STATIC_PCI_POS)
+#define CANTP_DATA_POS(pci)             ((void)(pci), (CANTP_STATIC_PCI_POS + 1u))
+#define CANTP_FF_DATA_POS(pci)          ((void)(pci), (CANTP_STATIC_PCI_POS + 2u))
+#define CANTP_FC_BS_POS(pci)            ((void)(pci), (CANTP_STATIC_PCI_POS + 1u))
+#define CANTP_FC_ST_POS(pci)            ((void)(pci), (CANTP_STATIC_PCI_POS + 2u))
+#else
+/** \brief Check if a channel uses the standard addressing.*/
+#define CANTP_IS_STANDARD_CHANNEL(chn)  CANTP_IS_STANDARD_TYPE((chn)->chnCfg->type)
+/** \brief Get the positions of the PCI, the data and the FC parameters.*/
+#define CANTP_PCI_POS(pci)              ((pci)->pciPos)
+#define CANTP_DATA_POS(pci)             ((pci)->dataPos)
+#define CANTP_FF_DATA_POS(pci)          ((pci)->ffDataPos)
+#define CANTP_FC_BS_POS(pci)            ((pci)->fcBsPos)
+#define CANTP_FC_ST_POS(pci)            ((pci)->fcStPos)
+#endif
+
+#if ((CANTP_FUN_STATIC_PCI_LAYOUT == ON) && (CANTP_NUMBER_OF_PCI_INFO == 1u))
+/** \brief Only the classic frames are used, the PCI of all channels is the
+    same constant, so its sizes are folded by the compiler.*/
+#define CANTP_CHANNEL_PCI(chn)          ((void)(chn), \
+                                            &gs_CanTpPciInfo[CANTP_STATIC_PCI_LAYOUT] \
+                                                [CANTP_CLASSIC_PCI_INFO])
+#else
+/** \brief Get the PCI of a channel.*/
+#define CANTP_CHANNEL_PCI(chn)          ((chn)->pciInfo)
+#endif
+
+#if (CANTP_NUMBER_OF_PCI_INFO == 1u)
+/** \brief Only the classic frames are used, the TX_DL and RX_DL are 8.*/
+#define CANTP_CHANNEL_DL(chn)           ((void)(chn), \
+                                            (bl_BufferSize_t)CANTP_CLASSIC_FRAME_SIZE)
+#define CANTP_SET_CHANNEL_DL(chn,dl)    ((void)(chn), (void)(dl))
+#else
+/** \brief Get the TX_DL or RX_DL of the multiple frames of a channel.*/
+#define CANTP_CHANNEL_DL(chn)           ((chn)->frameDl)
+/** \brief Set the TX_DL or RX_DL of the multiple frames of a channel.*/
+#define CANTP_SET_CHANNEL_DL(chn,dl)    ((chn)->frameDl = (bl_BufferSize_t)(dl))
+#endif
+/** \brief Get the size of the data in a CF frame of a channel.*/
+#define CANTP_CHANNEL_CF_DATA_SIZE(chn) ((bl_BufferSize_t)(CANTP_CHANNEL_DL(chn) \
+                                            - CANTP_DATA_POS(CANTP_CHANNEL_PCI(chn))))
+/** \brief Get the max size of data in a SF frame of a channel, a SF bigger
+    than a classic frame does not exceed the TX_DL either.*/
+#define CANTP_CHANNEL_SF_DATA_SIZE(chn) (((CANTP_CHANNEL_DL(chn) > CANTP_CLASSIC_FRAME_SIZE) \
+                                            && (CANTP_CHANNEL_CF_DATA_SIZE(chn) \
+                                                <= CANTP_CHANNEL_PCI(chn)->maxSFDataSize)) \
+                                            ? (bl_BufferSize_t)(CANTP_CHANNEL_CF_DATA_SIZE(chn) \
+                                                - CANTP_FRAME_SF_ESC_SIZE) \
+                                            : CANTP_CHANNEL_PCI(chn)->maxSFDataSize)
+
+/** \brief Get the SN in the Consecutive Frame.*/
+#define CANTP_GET_CF_SN(pci,buf)      GET_LOW_HALF((buf)[CANTP_PCI_POS(pci)])
+
+/** \brief Get the frame type in the a frame.*/
+#define CANTP_GET_FRAME_TYPE(pci,buf) GET_LOW_HALF((buf)[CANTP_PCI_POS(pci)]>> 4)
+/** \brief Get the FlowStatus in the a Flow Control Frame.*/
+#define CANTP_GET_FC_FS(pci,buf)      GET_LOW_HALF((buf)[CANTP_PCI_POS(pci)])
+/** \brief Get the BlockSize in the a Flow Control Frame.*/
+#define CANTP_GET_FC_BS(pci,buf)        ((buf)[CANTP_FC_BS_POS(pci)])
+/** \brief Get the STmin in the a Flow Control Frame.*/
+#define CANTP_GET_FC_STMIN(pci,buf)     ((buf)[CANTP_FC_ST_POS(pci)])
+
+
+#if (CANTP_FUN_CHANNEL_SOA == ON)
+/** \brief The status of a channel, in the dense array of its slot.*/
+#define CANTP_CHANNEL_STATUS(chn)       (gs_CanTpChannelStatus[(chn)->slot])
+/** \brief The timer of a channel, in the dense array of its slot.*/
+#define CANTP_CHANNEL_TIMER(chn)        (gs_CanTpChannelTimer[(chn)->slot])
+#else
+#define CANTP_CHANNEL_STATUS(chn)       ((chn)->status)
+#define CANTP_CHANNEL_TIMER(chn)        ((chn)->timer)
+#endif
+
+/** \brief If the status of a channel is Idle return TRUE.*/
+#define CANTP_STATUS_IS_IDLE(chn)       (CANTP_STATUS_IDLE \
+                                            == CANTP_CHANNEL_STATUS(chn))
+/** \brief If the status of a channel is recvSF return TRUE.*/
+#define CANTP_STATUS_IS_RECVSF(chn)     (CANTP_STATUS_RECEIVING_SF \
+                                            == CANTP_CHANNEL_STATUS(chn))
+/** \brief If the status of a channel is recvFF return TRUE.*/
+#define CANTP_STATUS_IS_RECVFF(chn)     (CANTP_STATUS_RECEIVING_FF \
+                                            == CANTP_CHANNEL_STATUS(chn))
+/** \brief If the status of a channel is recvCF return TRUE.*/
+#define CANTP_STATUS_IS_RECVCF(chn)     (CANTP_STATUS_RECEIVING_CF \
+                                            == CANTP_CHANNEL_STATUS(chn))
+/** \brief If the status of a channel is recvFC return TRUE.*/
+#define CANTP_STATUS_IS_RECVFC(chn)     (CANTP_STATUS_RECEIVING_FC \
+                                            == CANTP_CHANNEL_STATUS(chn))
+/** \brief If the status of a channel is tranSF return TRUE.*/
+#define CANTP_STATUS_IS_TRANSF(chn)     (CANTP_STATUS_TRANSMITTING_SF \
+                                            == CANTP_CHANNEL_STATUS(chn))
+/** \brief If the status of a channel is tranFF return TRUE.*/
+#define CANTP_STATUS_IS_TRANFF(chn)     (CANTP_STATUS_TRANSMITTING_FF \
+                                            == CANTP_CHANNEL_STATUS(chn))
+/** \brief If the status of a channel is tranCF return TRUE.*/
+#define CANTP_STATUS_IS_TRANCF(chn)     (CANTP_STATUS_TRANSMITTING_CF \
+                                            == CANTP_CHANNEL_STATUS(chn))
+/** \brief If the status of a channel is tranFC return TRUE.*/
+#define CANTP_STATUS_IS_TRANFC(chn)     (CANTP_STATUS_TRANSMITTING_FC \
+                                            == CANTP_CHANNEL_STATUS(chn))
+
+/*  When continuous FF or SF is received in one channel during
+    a timeout period,It maybe break other physical channel.
+    So If a channel is receiving a FF or a SF, do NOT indicate.*/
+/** \brief Check if the buffer is gotten from Dcm module.*/
+#define CANTP_IS_GETTING_BUFFER(chn)    (CANTP_CHANNEL_STATUS(chn) > \
+                                            CANTP_STATUS_RECEIVING_FF)
+
+/** \brief If the status of a channel is NOT Idle return TRUE.*/
+#define CANTP_STATUS_IS_NOT_IDLE(chn)   (!CANTP_STATUS_IS_IDLE(chn))
+
+/** \brief If the status of a channel is NOT recvSF return TRUE.*/
+#define CANTP_STATUS_IS_NOT_RECVSF(chn) (!CANTP_STATUS_IS_RECVSF(chn))
+/** \brief If the status of a channel is NOT recvFF return TRUE.*/
+#define CANTP_STATUS_IS_NOT_RECVFF(chn) (!CANTP_STATUS_IS_RECVFF(chn))
+/** \brief If the status of a channel is NOT recvCF return TRUE.*/
+#define CANTP_STATUS_IS_NOT_RECVCF(chn) (!CANTP_STATUS_IS_RECVCF(chn))
+/** \brief If the status of a channel is NOT recvFC return TRUE.*/
+#define CANTP_STATUS_IS_NOT_RECVFC(chn) (!CANTP_STATUS_IS_RECVFC(chn))
+/** \brief If the status of a channel is NOT tranSF return TRUE.*/
+#define CANTP_STATUS_IS_NOT_TRANSF(chn) (!CANTP_STATUS_IS_TRANSF(chn))
+/** \brief If the status of a channel is NOT tranFF return TRUE.*/
+#define CANTP_STATUS_IS_NOT_TRANFF(chn) (!CANTP_STATUS_IS_TRANFF(chn))
+/** \brief If the status of a channel is NOT tranCF return TRUE.*/
+#define CANTP_STATUS_IS_NOT_TRANCF(chn) (!CANTP_STATUS_IS_TRANCF(chn))
+/** \brief If the status of a channel is NOT tranFC return TRUE.*/
+#define CANTP_STATUS_IS_NOT_TRANFC(chn) (!CANTP_STATUS_IS_TRANFC(chn))
+
+/** \brief If the sub status of a channel is Idle return TRUE.*/
+#define CANTP_SUB_STATUS_IS_IDLE(chn)   (CANTP_SUB_STATUS_IDLE \
+                                            == (chn)->subStatus)
+/** \brief If the sub status of a channel is Receiving return TRUE.*/
+#define CANTP_SUB_STATUS_IS_RECV(chn)   (CANTP_SUB_STATUS_RECEIVING \
+                                                == (chn)->subStatus)
+/** \brief If the sub status of a channel is Transmitting return TRUE.*/
+#define CANTP_SUB_STATUS_IS_TRAN(chn)   (CANTP_SUB_STATUS_TRANSMITTING \
+                                                == (chn)->subStatus)
+
+/** \brief If the sub status of a channel is NOT Idle return TRUE.*/
+#define CANTP_SUB_STATUS_IS_NOT_IDLE(chn)   (!CANTP_SUB_STATUS_IS_IDLE(chn))
+/** \brief If the sub status of a channel is NOT Receiving return TRUE.*/
+#define CANTP_SUB_STATUS_IS_NOT_RECV(chn)   (!CANTP_SUB_STATUS_IS_RECV(chn))
+/** \brief If the sub status of a channel is NOT Transmitting return TRUE.*/
+#define CANTP_SUB_STATUS_IS_NOT_TRAN(chn)   (!CANTP_SUB_STATUS_IS_TRAN(chn))
+
+/** \brief Set the status of a channel to Idle.*/
+#define CANTP_STATUS_GOTO_IDLE(chn)     (CANTP_CHANNEL_STATUS(chn) = CANTP_STATUS_IDLE)
+/** \brief Set the status of a channel to recvSF.*/
+#define CANTP_STATUS_GOTO_RECVSF(chn)   (CANTP_CHANNEL_STATUS(chn) = \
+                                            CANTP_STATUS_RECEIVING_SF)
+/** \brief Set the status of a channel to recvFF.*/
+#define CANTP_STATUS_GOTO_RECVFF(chn)   (CANTP_CHANNEL_STATUS(chn) = \
+                                            CANTP_STATUS_RECEIVING_FF)
+/** \brief Set the status of a channel to recvCF.*/
+#define CANTP_STATUS_GOTO_RECVCF(chn)   (CANTP_CHANNEL_STATUS(chn) = \
+                                            CANTP_STATUS_RECEIVING_CF)
+/** \brief Set the status of a channel to recvFC.*/
+#define CANTP_STATUS_GOTO_RECVFC(chn)   (CANTP_CHANNEL_STATUS(chn) = \
+                                            CANTP_STATUS_RECEIVING_FC)
+
+/** \brief Set the status of a channel to tranSF.*/
+#define CANTP_STATUS_GOTO_TRANSF(chn)   (CANTP_CHANNEL_STATUS(chn) = \
+                                            CANTP_STATUS_TRANSMITTING_SF)
+/** \brief Set the status of a channel to tranFF.*/
+#define CANTP_STATUS_GOTO_TRANFF(chn)   (CANTP_CHANNEL_STATUS(chn) = \
+                                            CANTP_STATUS_TRANSMITTING_FF)
+/** \brief Set the status of a channel to tranCF.*/
+#define CANTP_STATUS_GOTO_TRANCF(chn)   (CANTP_CHANNEL_STATUS(chn) = \
+                                            CANTP_STATUS_TRANSMITTING_CF)
+/** \brief Set the status of a channel to tranFC.*/
+#define CANTP_STATUS_GOTO_TRANFC(chn)   (CANTP_CHANNEL_STATUS(chn) = \
+                                            CANTP_STATUS_TRANSMITTING_FC)
+
+/** \brief Set the sub status of a channel to Idle.*/
+#define CANTP_SUB_STATUS_GOTO_IDLE(chn) ((chn)->subStatus = \
+                                            CANTP_SUB_STATUS_IDLE)
+
+/** \brief Set the sub status of a channel to receiving.*/
+#define CANTP_SUB_STATUS_GOTO_RECV(chn) ((chn)->subStatus = \
+                                            CANTP_SUB_STATUS_RECEIVING)
+
+/** \brief Set the sub status of a channel to transmitting.*/
+#define CANTP_SUB_STATUS_GOTO_TRAN(chn) ((chn)->subStatus = \
+                                            CANTP_SUB_STATUS_TRANSMITTING)
+
+/** \brief Set the private data of a channel.*/
+#define CANTP_SET_PRIVATE_DATA(chn,_pData) ((chn)->pData = (UINT8)(_pData))
+
+/** \brief Set the BS of a channel.*/
+#define CANTP_SET_BS(chn,_bs)       ((chn)->bs = (UINT8)(_bs))
+/** \brief Set the STmin of a channel.*/
+#define CANTP_SET_STMIN(chn,_st)    ((chn)->st = (UINT8)(_st))
+/** \brief Set the maxWFT of a channel.*/
+#define CANTP_SET_MAXWFT(chn,_wft)  ((chn)->wft = (UINT8)(_wft))
+/** \brief Set the TA type of a channel.*/
+#define CANTP_SET_TATYPE(chn,type)  ((chn)->taType = (UINT8)(type))
+
+/** \brief Initialize the BS of a channel by channel configurations.*/
+#define CANTP_INIT_BS_BY_CFG(chn,cfg)       CANTP_SET_BS(chn,(cfg)->bs)
+/** \brief Initialize the STmin of a channel by channel configurations.*/
+#define CANTP_INIT_STMIN_BY_CFG(chn,cfg)    CANTP_SET_STMIN(chn,(cfg)->st)
+/** \brief Initialize the maxWFT of a channel by channel configurations.*/
+#define CANTP_INIT_MAXWFT_BY_CFG(chn,cfg)   CANTP_SET_MAXWFT(chn,(cfg)->wft)
+/** \brief Initialize the TA type of a channel by channel configurations.*/
+#define CANTP_INIT_TATYPE_BY_CFG(chn,cfg)   CANTP_SET_TATYPE(chn,(cfg)->taType)
+
+/** \brief Initialize the BS of a channel.*/
+#define CANTP_INIT_BS(chn)      CANTP_INIT_BS_BY_CFG((chn),(chn)->chnCfg)
+#if (CANTP_FUN_CHANGE_PARAMETER == ON)
+/** \brief Initialize the BS sent in the FC frames of a rx channel.*/
+#define CANTP_INIT_FC_BS(chn)   CANTP_SET_BS(chn,(chn)->fcBs)
+/** \brief Get the BS sent in the FC frames of a rx channel.*/
+#define CANTP_GET_CHANNEL_FC_BS(chn)    ((chn)->fcBs)
+#else
+#define CANTP_INIT_FC_BS(chn)   CANTP_INIT_BS(chn)
+#define CANTP_GET_CHANNEL_FC_BS(chn)    ((chn)->chnCfg->bs)
+#endif
+/** \brief Initialize the STmin of a channel.*/
+#define CANTP_INIT_STMIN(chn)   CANTP_INIT_STMIN_BY_CFG((chn),(chn)->chnCfg)
+/** \brief Initialize the maxWFT of a channel.*/
+#define CANTP_INIT_MAXWFT(chn)  CANTP_INIT_MAXWFT_BY_CFG((chn),(chn)->chnCfg)
+/** \brief Initialize the TA type of a channel.*/
+#define CANTP_INIT_TATYPE(chn)  CANTP_INIT_TATYPE_BY_CFG((chn),(chn)->chnCfg)
+
+/** \brief Set the timeout value of the timer in a channel.*/
+#define CANTP_SET_TIMER(chn,timeout)    (CANTP_CHANNEL_TIMER(chn) = (UINT16)(timeout))
+/** \brief Get the current value of the timer in a channel.*/
+#define CANTP_GET_TIMER(chn)            (CANTP_CHANNEL_TIMER(chn))
+
+/** \brief Initialize the timer in a channel.*/
+#define CANTP_INIT_TIMER(chn)           CANTP_SET_TIMER(chn,0u)
+/** \brief Use the timerA to initialize the timer in a channel.*/
+#define CANTP_INIT_TIMER_A(chn) CANTP_SET_TIMER(chn,(chn)->chnCfg->timerA)
+/** \brief Use the timerB to initialize the timer in a channel.*/
+#define CANTP_INIT_TIMER_B(chn) CANTP_SET_TIMER(chn,(chn)->chnCfg->timerB)
+/** \brief Use the timerC to initialize the timer in a channel.*/
+#define CANTP_INIT_TIMER_C(chn) CANTP_SET_TIMER(chn,(chn)->chnCfg->timerC)
+
+/** \brief Check if the timer in a channel is timeout.*/
+#define CANTP_IS_TIMEOUT(chn)           (0u == CANTP_GET_TIMER(chn))
+
+/** \brief Set the SN of a channel.*/
+#define CANTP_SET_SN(chn,_sn)       ((chn)->sn = (UINT8)(_sn))
+/** \brief Set the CF counter of a channel.*/
+#define CANTP_SET_CFCNT(chn,_cfCnt) ((chn)->cfCnt = (UINT16)(_cfCnt))
+/** \brief Set the size of the last CF of a channel.*/
+#define CANTP_SET_LAST_SIZE(chn,_lastSize)  ((chn)->lastSize =\
+                                                (bl_BufferSize_t)(_lastSize))
+/** \brief Set the total size of a channel.*/
+#define CANTP_SET_TOTAL_SIZE(chn,_totalSize)    ((chn)->totalSize =\
+                                                 (bl_BufferSize_t)(_totalSize))
+
+/** \brief Set the tx delay of a channel.*/
+#define CANTP_SET_TXDELAY(chn,delay)    ((chn)->txDelay = (UINT8)(delay))
+
+/** \brief Initialize the SN of a channel.*/
+#define CANTP_INIT_SN(chn)          CANTP_SET_SN(chn,0u)
+/** \brief Initialize the CF counter of a channel.*/
+#define CANTP_INIT_CFCNT(chn)       CANTP_SET_CFCNT(chn,0u)
+/** \brief Initialize the size of the last CF of a channel.*/
+#define CANTP_INIT_LAST_SIZE(chn)   CANTP_SET_LAST_SIZE(chn,0u)
+/** \brief Initialize the total size of a channel.*/
+#define CANTP_INIT_TOTAL_SIZE(chn)  CANTP_SET_TOTAL_SIZE(chn,0u)
+/** \brief Initialize the tx delay of a channel.*/
+#define CANTP_INIT_TXDELAY(chn)     CANTP_SET_TXDELAY(chn,(chn)->st)
+/** \brief Add the SN of a channel.*/
+#define CANTP_ADD_SN(chn)            ((chn)->sn += 1)
+/** \brief Check if a channel is functional.*/
+#define CANTP_IS_FUNCTIONAL_CHANNEL(chn)    (CANTP_TATYPE_FUNCTIONAL \
+                                                == (chn)->chnCfg->taType)
+/** \brief Get the max size of the frames of a channel.*/
+#define CANTP_GET_MAX_DL(chn)   ((CANTP_MAX_DL_DEFAULT == (chn)->chnCfg->maxDl) \
+                                    ? (bl_BufferSize_t)CANTP_MAX_FRAME_SIZE \
+                                    : (bl_BufferSize_t)(chn)->chnCfg->maxDl)
+/** \brief Check if a channel is physical.*/
+#define CANTP_IS_PHYSICAL_CHANNEL(chn)      (CANTP_TATYPE_PHYSICAL \
+                                                == (chn)->chnCfg->taType)
+#if (CANTP_FUN_FUNCTIONAL_MULTICAST == ON)
+/** \brief Check if a functional channel transfers multiple frames.*/
+#define CANTP_IS_MULTICAST_CHANNEL(chn)     ((CANTP_MULTICAST_OFF \
+                                                != gs_CanTpMulticastMode) \
+                                            && CANTP_IS_FUNCTIONAL_CHANNEL(chn))
+/** \brief Check if a channel receives multiple frames without sending FC.*/
+#define CANTP_IS_MULTICAST_FOLLOWER(chn)    ((CANTP_MULTICAST_FOLLOWER \
+                                                == gs_CanTpMulticastMode) \
+                                            && CANTP_IS_FUNCTIONAL_CHANNEL(chn))
+#else
+#define CANTP_IS_MULTICAST_CHANNEL(chn)     (FALSE)
+#define CANTP_IS_MULTICAST_FOLLOWER(chn)    (FALSE)
+#endif
+
+/** \brief Check if the channel in the other direction of the same connection
+    is Idle.*/
+#define CANTP_PAIR_IS_IDLE(chn)     ((NULL_PTR == (chn)->pair) \
+                                        || CANTP_STATUS_IS_IDLE((chn)->pair))
+
+/** \brief Check if a channel is allowed to transmit a frame on the bus, and
+    charge the bus budget when the frame is transmitted.*/
+#if (CANTP_FUN_CLIENT_SCHEDULER == ON)
+#define CANTP_GRANT_FRAME(handle)       CanTpSched_GrantFrame(handle)
+#define CANTP_FRAME_TRANSMITTED(handle) CanTpSched_FrameTransmitted(handle)
+#else
+#define CANTP_GRANT_FRAME(handle)       (TRUE)
+#define CANTP_FRAME_TRANSMITTED(handle)
+#endif
+
+#if (CANTP_FUN_FIXED_ADDRESSING == ON)
+/** \brief Get the handle of a rx channel, a channel of the pool uses the
+    handle of its template.*/
+#define CANTP_GET_RX_HANDLE(chn)    ((chn)->handle)
+/** \brief Get the handle of a tx channel, a channel of the pool uses the
+    handle of its template.*/
+#define CANTP_GET_TX_HANDLE(chn)    ((chn)->handle)
+#else
+/** \brief Get the handle of a rx channel.*/
+#define CANTP_GET_RX_HANDLE(chn)    ((bl_CanTpHandle_t)((chn) - gs_CanTpRxChannel))
+/** \brief Get the handle of a tx channel.*/
+#define CANTP_GET_TX_HANDLE(chn)    ((bl_CanTpHandle_t)((chn) - gs_CanTpTxChannel))
+#endif
+
+/** \brief Request a buffer from the upper layer for a rx channel.*/
+#define CANTP_START_OF_RECEPTION(chn,size)  CANTP_UL_START_OF_RECEPTION( \
+                                                CANTP_GET_RX_HANDLE(chn),(size))
+/** \brief Copy the received data of a rx channel to the upper layer.*/
+#define CANTP_COPY_RX_DATA(chn,size,buf)    CANTP_UL_COPY_RX_DATA( \
+                                                CANTP_GET_RX_HANDLE(chn),(size),(buf))
+/** \brief Indicate the upper layer the result of a rx channel.*/
+#if (CANTP_FUN_FIXED_ADDRESSING == ON)
+#define CANTP_RX_INDICATION(chn,result)     do { \
+                                                _Cantp_SetFixedPeer((chn),(result)); \
+                                                CANTP_UL_RX_INDICATION( \
+                                                CANTP_GET_RX_HANDLE(chn),(chn)->taType,(result)); \
+                                            } while (0)
+#else
+#define CANTP_RX_INDICATION(chn,result)     CANTP_UL_RX_INDICATION( \
+                                                CANTP_GET_RX_HANDLE(chn),(chn)->taType,(result))
+#endif
+/** \brief Copy the transmitting data of a tx channel from the upper layer.*/
+#if (CANTP_FUN_TX_REQUEST_QUEUE == ON)
+#define CANTP_COPY_TX_DATA(chn,size,buf)    _Cantp_CopyTxData((chn),(size),(buf))
+#else
+#define CANTP_COPY_TX_DATA(chn,size,buf)    CANTP_UL_COPY_TX_DATA( \
+                                                CANTP_GET_TX_HANDLE(chn),(size),(buf))
+#endif
+/** \brief Confirm the upper layer the result of a tx channel.*/
+#define CANTP_TX_CONFIRMATION(chn,result)   CANTP_UL_TX_CONFIRMATION( \
+                                                CANTP_GET_TX_HANDLE(chn),(result))
+
+/*****************************************************************************
+ *  Internal Type Definitions
+ *****************************************************************************/
+/** \brief A alias of the struct _tag_CanTpChannel.*/
+typedef struct _tag_CanTpChannel bl_CanTpChannel_t;
+/** \brief A alias of the struct _tag_CanTpPciInfo.*/
+typedef struct _tag_CanTpPciInfo bl_CanTpPciInfo_t;
+/** \brief A alias of the struct _tag_CanTpPeriodInterface.*/
+typedef struct _tag_CanTpPeriodInterface bl_CanTpPeriodIF_t;
+#if (CANTP_FUN_FIXED_ADDRESSING == ON)
+/** \brief A alias of the struct _tag_CanTpPoolSlot.*/
+typedef struct _tag_CanTpPoolSlot bl_CanTpPoolSlot_t;
+#endif
+#if (CANTP_FUN_RX_QUEUE == ON)
+/** \brief A alias of the struct _tag_CanTpQueuedFrame.*/
+typedef struct _tag_CanTpQueuedFrame bl_CanTpQueuedFrame_t;
+#endif
+#if (CANTP_FUN_RX_SF_QUEUE == ON)
+/** \brief A alias of the struct _tag_CanTpQueuedSF.*/
+typedef struct _tag_CanTpQueuedSF bl_CanTpQueuedSF_t;
+/** \brief A alias of the struct _tag_CanTpSFQueue.*/
+typedef struct _tag_CanTpSFQueue bl_CanTpSFQueue_t;
+#endif
+#if (CANTP_FUN_TX_REQUEST_QUEUE == ON)
+/** \brief A alias of the struct _tag_CanTpTxRequest.*/
+typedef struct _tag_CanTpTxRequest bl_CanTpTxRequest_t;
+#endif
+#if (CANTP_FUN_WARM_HANDOVER == ON)
+/** \brief A alias of the struct _tag_CanTpHandover.*/
+typedef struct _tag_CanTpHandover bl_CanTpHandover_t;
+#endif
+/** \brief A interface used to process received frame.*/
+typedef UINT8 (*bl_CanTpRxProcess_t)(bl_CanTpChannel_t *channel,
+                                                bl_BufferSize_t size,
+                                                const bl_Buffer_t *buffer);
+/** \brief A interface used to confirm that a frame is transmitted.*/
+typedef void (*bl_CanTpTxConfirm_t)(bl_CanTpChannel_t *channel);
+/*****************************************************************************
+ *  Internal Structure Definitions
+ *****************************************************************************/
+/** \brief The PCI Informations for a can tp channel.*/
+struct _tag_CanTpPciInfo
+{
+    UINT8 pciPos;     /**< The PCI position in a can frame.*/
+    UINT8 dataPos;    /**< The valid data position in a SF or CF frame.*/
+    UINT8 ffDataPos;  /**< The valid data position in a FF frame.*/
+    UINT8 fcBsPos;    /**< The BS position in a FC frame.*/
+    UINT8 fcStPos;    /**< The STmin position in a FC frame.*/
+    bl_BufferSize_t maxSFDataSize;  /**< The max size of data in a SF frame.*/
+    bl_BufferSize_t maxFCDataSize;  /**< The max size of data in a FC frame.*/
+    bl_BufferSize_t frameSize;      /**< The biggest TX_DL of the frames.*/
+};
+
+#if (CANTP_FUN_RX_SF_QUEUE == ON)
+/** \brief A SF received before the last SF of a channel is given to the
+    upper layer.*/
+struct _tag_CanTpQueuedSF
+{
+    const struct _tag_CanTpPciInfo *pciInfo;   /**< PCI information*/
+    bl_BufferSize_t size; /**< The size of data in the SF.*/
+    bl_Buffer_t *data;    /**< The data of the SF, the MAX_DL of the channel.*/
+};
+
+/** \brief The SFs of a rx channel waiting for the upper layer. The SFs are
+    queued by the ISR and given by the task.*/
+struct _tag_CanTpSFQueue
+{
+    volatile UINT8 head;  /**< The count of the SFs queued, only written by
+                               the ISR.*/
+    volatile UINT8 tail;  /**< The count of the SFs given, only written by
+                               the task.*/
+    volatile UINT8 drop;  /**< The head when the last FF is received, the SFs
+                               before it are dropped. Only written by the
+                               ISR.*/
+    bl_CanTpQueuedSF_t entry[CANTP_RX_SF_QUEUE_SIZE]; /**< The SFs.*/
+};
+#endif
+
+#if (CANTP_FUN_TX_REQUEST_QUEUE == ON)
+/** \brief A message queued behind the transfer of a tx channel, its data
+    is copied from its buffer or the upper layer when it is started.*/
+struct _tag_CanTpTxRequest
+{
+    bl_BufferSize_t size; /**< The size of the message.*/
+    const bl_Buffer_t *data;    /**< The data of the message, NULL_PTR if it
+                                     is copied from the upper layer.*/
+#if (CANTP_FUN_RESUMABLE_TRANSFER == ON)
+    bl_BufferSize_t skipSize;   /**< The size of the data skipped before the
+                                     message is transmitted from an offset.*/
+#endif
+};
+#endif
+
+/** \brief The channel of the CAN TP.*/
+struct _tag_CanTpChannel
+{
+#if (CANTP_FUN_CHANNEL_SOA == ON)
+    UINT16 slot;      /**< The index of the status and the timer of a
+                           channel in the dense arrays.*/
+#else
+    UINT8 status;     /**< The current status of a channel.*/
+#endif
+    UINT8 subStatus;  /**< The current sub status of a channel.*/
+    UINT8 pData;      /**< The private data of a channel.*/
+    UINT8 sn;         /**< The expected SN used to receive CF frames.*/
+    UINT8 txDelay;    /**< The Delay timer for sending a CF frame.*/
+    UINT8 st;         /**< The STmin copy from chnCfg->st or a FC frame.*/
+    UINT8 bs;         /**< The BS copy from chnCfg->bs or a FC frame.*/
+    UINT8 wft;        /**< The WFT copy from chnCfg->wft.*/
+    UINT8 taType;      /**< The TA type copy from chnCfg->taType.*/
+#if (CANTP_FUN_CHANGE_PARAMETER == ON)
+    UINT8 fcBs;       /**< The BS sent in the FC frames, from chnCfg->bs or
+                           Cantp_ChangeParameter.*/
+#endif
+    bl_BufferSize_t lastSize;   /**< The Size of the last CF or SF frame.*/
+#if (CANTP_FUN_FRAME_POOL == ON)
+    bl_Buffer_t *frame;   /**< The frame buffer borrowed from the pool.*/
+    UINT8 frameBuffer;    /**< The index of the borrowed frame buffer.*/
+#else
+    bl_Buffer_t frame[CANTP_MAX_FRAME_SIZE];  /**< The local frame buffer.*/
+#endif
+#if (CANTP_FUN_CHANNEL_SOA == OFF)
+    UINT16 timer;     /**< The timer*/
+#endif
+    UINT16 cfCnt;     /**< The counter of CF frames.*/
+    bl_BufferSize_t totalSize; /**< The total size of Tx or Rx.*/
+    const struct _tag_CanTpChannelCfg *chnCfg; /**< Channel configurations*/
+    const struct _tag_CanTpPciInfo *pciInfo;   /**< PCI information*/
+#if (CANTP_NUMBER_OF_PCI_INFO > 1u)
+    bl_BufferSize_t frameDl;  /**< The TX_DL or RX_DL of the multiple frames.*/
+#endif
+#if(CANTP_COMMUNICATION_DUPLEX == CANTP_HALF_DUPLEX)
+    struct _tag_CanTpChannel *pair; /**< The channel of the same connection
+                                         in the other direction.*/
+#endif
+#if (CANTP_FUN_FIXED_ADDRESSING == ON)
+    bl_CanTpHandle_t handle;  /**< The handle used by the upper layer.*/
+    UINT8 sa;         /**< The SA of the peer of the fixed addressing.*/
+#endif
+#if (CANTP_FUN_FUNCTIONAL_MULTICAST == ON)
+    UINT8 catchUp;    /**< A CF of the multicast transfer is lost.*/
+    bl_BufferSize_t catchUpOffset;  /**< The size of the data copied to the
+                                         upper layer before the lost CF.*/
+#endif
+#if (CANTP_FUN_RESUMABLE_TRANSFER == ON)
+    UINT8 resume;     /**< The last multiple frames transfer is aborted.*/
+    bl_BufferSize_t resumeOffset;   /**< The offset in the whole message of
+                                         the data committed before the
+                                         abort.*/
+    bl_BufferSize_t resumeBase; /**< The offset in the whole message of the
+                                     first data of the transfer.*/
+    bl_BufferSize_t skipSize;   /**< The size of the data skipped before the
+                                     message is transmitted from an offset.*/
+#endif
+#if (CANTP_FUN_RX_SF_QUEUE == ON)
+    bl_CanTpSFQueue_t *sfQueue; /**< The SFs waiting for the upper layer, only
+                                     used by a rx channel.*/
+#endif
+#if (CANTP_FUN_TX_REQUEST_QUEUE == ON)
+    const bl_Buffer_t *txData;  /**< The data of the transmitting message,
+                                     NULL_PTR if it is copied from the upper
+                                     layer.*/
+    volatile UINT8 txqHead; /**< The count of the queued messages, only
+                                 written by the task of the upper layer.*/
+    volatile UINT8 txqTail; /**< The count of the started messages, only
+                                 written when the channel goes to the idle
+                                 status.*/
+    bl_CanTpTxRequest_t txQueue[CANTP_TX_REQUEST_QUEUE_SIZE]; /**< The messages
+                                            waiting for the channel.*/
+#endif
+};
+
+/** \brief The period process interface of the CAN TP channel.*/
+struct _tag_CanTpPeriodInterface
+{
+    void (*Period)(bl_CanTpChannel_t *channel); /**< period of status.*/
+    UINT8 (*Timeout)(bl_CanTpChannel_t *channel);/**< timeout of status*/
+};
+
+#if (CANTP_FUN_FIXED_ADDRESSING == ON)
+/** \brief The slot of the pool used by a peer of the fixed addressing.*/
+struct _tag_CanTpPoolSlot
+{
+    UINT8 used;       /**< The slot is used by a peer.*/
+    UINT8 sa;         /**< The SA of the peer.*/
+    const struct _tag_CanTpChannel *rxTmpl; /**< The rx template channel.*/
+    struct _tag_CanTpChannelCfg rxCfg;  /**< The rx configurations of the peer.*/
+    struct _tag_CanTpChannelCfg txCfg;  /**< The tx configurations of the peer.*/
+};
+#endif
+
+#if (CANTP_FUN_RX_QUEUE == ON)
+/** \brief A frame copied into the rx queue by the CAN ISR.*/
+struct _tag_CanTpQueuedFrame
+{
+    UINT8 ctrl;           /**< The CAN controller receiving the frame.*/
+    UINT32 id;            /**< The id of the frame.*/
+    bl_BufferSize_t size; /**< The size of the frame.*/
+    bl_Buffer_t data[CANTP_MAX_FRAME_SIZE];  /**< The contents of the frame.*/
+};
+#endif
+
+#if (CANTP_FUN_WARM_HANDOVER == ON)
+/** \brief The record of the warm handover in the no-init RAM.*/
+struct _tag_CanTpHandover
+{
+    UINT32 magic;     /**< CANTP_HANDOVER_MAGIC if the record is saved.*/
+    UINT32 id;        /**< The id of the request, with the SA of the peer.*/
+    UINT8 ctrl;       /**< The CAN controller receiving the request.*/
+    UINT8 st;         /**< The STmin of the last FC of the peer.*/
+    UINT16 checksum;  /**< The checksum of the record.*/
+    bl_Buffer_t frame[CANTP_CLASSIC_FRAME_SIZE];  /**< The SF of the request.*/
+};
+#endif
+
+/*****************************************************************************
+ *  Internal Function Declarations
+ *****************************************************************************/
+static void FblCanTpMsgHandle(UINT8 *pucData);
+static void FblCanTpEventHandle(UINT16 uwEventId);
+static void CanTp_Init(void);
+/** \brief Use the configuration to initialize a cantp channel.*/
+static void _Cantp_InitChannel(bl_CanTpChannel_t *channel,
+                                const bl_CanTpChannelCfg_t *channelCfg);
+#if (CANTP_FUN_FIXED_ADDRESSING == ON)
+/** \brief Initialize the pool of the fixed addressing.*/
+static void _Cantp_InitPool(void);
+/** \brief Get the slot of the pool used by a peer.*/
+static UINT8 _Cantp_GetPoolSlot(const bl_CanTpChannel_t *rxTmpl,
+                                const bl_CanTpChannel_t *txTmpl,
+                                UINT8 sa);
+/** \brief Use a 29-bit id to get a rx channel of the fixed addressing.*/
+static bl_CanTpChannel_t *_Cantp_GetFixedRxChannel(UINT8 ctrl, UINT32 id);
+/** \brief Use a 29-bit id to get a tx channel of the fixed addressing.*/
+static bl_CanTpChannel_t *_Cantp_GetFixedTxChannel(UINT8 ctrl, UINT32 id);
+/** \brief Get the tx channel of the pool transmitting to the last peer.*/
+static bl_CanTpChannel_t *_Cantp_GetFixedPeerChannel(bl_CanTpChannel_t *txTmpl);
+/** \brief Check if other peer of a template is served.*/
+static UINT8 _Cantp_IsOtherPeerBusy(const bl_CanTpChannel_t *rxTmpl, UINT8 sa);
+/** \brief Save the peer of a request received by the fixed addressing.*/
+static void _Cantp_SetFixedPeer(const bl_CanTpChannel_t *channel,
+                                bl_CanTpResult_t result);
+#endif
+/** \brief Get the tx channel used by a tx handle of the upper layer.*/
+static bl_CanTpChannel_t *_Cantp_GetTxChannel(bl_CanTpHandle_t handle);
+/** \brief Start to transmit a message by an idle tx channel.*/
+static UINT8 _Cantp_StartTransmit(bl_CanTpChannel_t *channel,
+                                    bl_BufferSize_t size);
+#if (CANTP_FUN_TX_REQUEST_QUEUE == ON)
+/** \brief Start or queue a message of a tx handle.*/
+static UINT8 _Cantp_TransmitRequest(bl_CanTpHandle_t handle,
+                                    const bl_CanTpTxRequest_t *request);
+/** \brief Start a message by an idle tx channel.*/
+static UINT8 _Cantp_StartRequest(bl_CanTpChannel_t *channel,
+                                    const bl_CanTpTxRequest_t *request);
+/** \brief Queue a message behind the transfer of a tx channel.*/
+static UINT8 _Cantp_QueueTransmit(bl_CanTpChannel_t *channel,
+                                    const bl_CanTpTxRequest_t *request);
+/** \brief Start the oldest queued message of an idle tx channel.*/
+static void _Cantp_StartQueuedTransmit(bl_CanTpChannel_t *channel);
+/** \brief Copy the transmitting data of a tx channel.*/
+static UINT8 _Cantp_CopyTxData(bl_CanTpChannel_t *channel,
+                                bl_BufferSize_t size,
+                                bl_Buffer_t *buffer);
+#endif
+/** \brief Get the tx channel which may receive a FC frame of an id.*/
+static bl_CanTpChannel_t *_Cantp_GetTxChannelById(UINT8 ctrl, UINT32 id);
+/** \brief Get the rx channel which may receive the frames of an id.*/
+static bl_CanTpChannel_t *_Cantp_GetRxChannelById(UINT8 ctrl, UINT32 id);
+/** \brief Get the PCI of a channel type used by the frames of a size.*/
+static const bl_CanTpPciInfo_t *_Cantp_GetPciInfo(UINT8 type,
+                                                bl_BufferSize_t frameSize);
+/** \brief Use the Rx handle of the canif module to get a channel.*/
+static bl_CanTpChannel_t * _Cantp_GetChannelByRxId(UINT8 ctrl,
+                                                   UINT32 id,
+                                                   UINT16 chnNum,
+                                                   bl_CanTpChannel_t *chnList);
+/** \brief Use the size to set the CF counter and last size of a channel.*/
+static void _Cantp_SetMultipleFrameSize(bl_CanTpChannel_t *channel,
+                                        bl_BufferSize_t size);
+
+#if ((CANTP_FUN_FUNCTIONAL_MULTICAST == ON) \
+    || (CANTP_FUN_RESUMABLE_TRANSFER == ON))
+/** \brief Get the size of the data of the FF and the transferred CF.*/
+static bl_BufferSize_t _Cantp_GetCommittedSize(const bl_CanTpChannel_t *channel);
+#endif
+#if (CANTP_FUN_FUNCTIONAL_MULTICAST == ON)
+/** \brief Save the catch-up offset of a multicast transfer.*/
+static void _Cantp_SaveCatchUpOffset(bl_CanTpChannel_t *channel);
+#endif
+#if (CANTP_FUN_RESUMABLE_TRANSFER == ON)
+/** \brief Save the checkpoint of an aborted transfer.*/
+static void _Cantp_SaveResumeOffset(bl_CanTpChannel_t *channel);
+/** \brief Skip the data before the offset of a message.*/
+static UINT8 _Cantp_SkipTxData(bl_CanTpChannel_t *channel);
+#endif
+
+#if (CANTP_FUN_INLINE_FLOW_CONTROL == ON)
+/** \brief Get the buffer and transmit the FC of a rx channel at once.*/
+static void _Cantp_InlineFlowControl(bl_CanTpChannel_t *channel);
+#endif
+
+#if (CANTP_FUN_RX_QUEUE == ON)
+/** \brief Process the frames in the rx queue, at most the budget.*/
+static void _Cantp_DrainRxQueue(void);
+#endif
+
+#if (CANTP_FUN_FRAME_POOL == ON)
+/** \brief Initialize the pool of the frame buffers.*/
+static void _Cantp_InitFramePool(void);
+/** \brief Borrow a frame buffer from the pool.*/
+static UINT8 _Cantp_GetFrameBuffer(bl_CanTpChannel_t *channel);
+/** \brief Give back the frame buffer of a channel to the pool.*/
+static void _Cantp_FreeFrameBuffer(bl_CanTpChannel_t *channel);
+#endif
+
+#if (CANTP_FUN_WARM_HANDOVER == ON)
+/** \brief Restore the pending request of the record of the handover.*/
+static void _Cantp_RestoreHandover(void);
+/** \brief Calculate the checksum of the record of the handover.*/
+static UINT16 _Cantp_GetHandoverChecksum(const bl_CanTpHandover_t *record);
+#endif
+
+#if (CANTP_FUN_RX_BLOCK_HOLD == ON)
+/** \brief Get the size of the data in the next block of a rx channel.*/
+static bl_BufferSize_t _Cantp_GetBlockSize(const bl_CanTpChannel_t *channel);
+#endif
+
+/** \brief Get the STmin to used to transmit CF.*/
+static UINT8 _Cantp_GetSTMinFromFC(UINT8 st);
+
+/** \brief Pad a frame and get the size of the frame on the bus.*/
+static bl_BufferSize_t _Cantp_PadFrame(bl_Buffer_t *frame,
+                                        bl_BufferSize_t size);
+
+/** \brief The period function.*/
+static void _Cantp_PeriodFunction(UINT16 num,
+                                UINT16 first,
+                                bl_CanTpChannel_t *channelList,
+                                const bl_CanTpPeriodIF_t *periodList);
+#if (CANTP_FUN_TX_PRIORITY == ON)
+/** \brief Transmit the pending SF of the tx channels.*/
+static void _Cantp_PeriodUrgentTx(UINT16 num, bl_CanTpChannel_t *channelList);
+#endif
+/** \brief The Rx indication function used by Rx channel.*/
+static UINT8 _Cantp_RxIndToRxChannel(bl_CanTpChannel_t *channel,
+                                            bl_BufferSize_t size,
+                                            const bl_Buffer_t *buffer);
+/** \brief Finish a frame received by a rx channel.*/
+static void _Cantp_RxChannelReceived(bl_CanTpChannel_t *channel);
+
+/** \brief The Rx indication function used by Tx channel.*/
+static UINT8 _Cantp_RxIndToTxChannel(bl_CanTpChannel_t *channel,
+                                            bl_BufferSize_t size,
+                                            const bl_Buffer_t *buffer);
+/** \brief The Rx indication function used by the Tx channels of an id.*/
+static UINT8 _Cantp_RxIndToTx(UINT8 ctrl,
+                                UINT32 id,
+                                bl_CanTpChannel_t *channel,
+                                bl_BufferSize_t size,
+                                const bl_Buffer_t *buffer);
+
+/** \brief Transmit a CF.*/
+static void _Cantp_TransmitCF(bl_CanTpChannel_t *channel);
+/** \brief Make the PCI of SF into the local frame.*/
+static void _Cantp_MakePciOfSF(bl_CanTpChannel_t *channel);
+/** \brief Make the PCI of FF into the local frame.*/
+static void _Cantp_MakePciOfFF(bl_CanTpChannel_t *channel);
+/** \brief Make the PCI of CF into the local frame.*/
+static void _Cantp_MakePciOfCF(bl_CanTpChannel_t *channel);
+/** \brief Make the PCI of FC into the local frame.*/
+static void _Cantp_MakePciOfFC(bl_CanTpChannel_t *channel);
+/** \brief The Tx confirmation function used for the Idle status of a channel.*/
+static void _Cantp_TxConfirmIdle(bl_CanTpChannel_t *channel);
+/** \brief The Tx confirmation function used for the tranSF status of a channel.*/
+static void _Cantp_TxConfirmSF(bl_CanTpChannel_t *channel);
+/** \brief The Tx confirmation function used for the tranFF status of a channel.*/
+static void _Cantp_TxConfirmFF(bl_CanTpChannel_t *channel);
+/** \brief The Tx confirmation function used for the tranCF status of a channel.*/
+static void _Cantp_TxConfirmCF(bl_CanTpChannel_t *channel);
+/** \brief The Tx confirmation function used for the tranFC status of a channel.*/
+static void _Cantp_TxConfirmFC(bl_CanTpChannel_t *channel);
+/** \brief The Change the status of a channel to Idle.*/
+static void _Cantp_GotoIdle(bl_CanTpChannel_t *channel);
+/** \brief The Change the status of a channel to TranSF.*/
+static void _Cantp_GotoTranSF(bl_CanTpChannel_t *channel);
+/** \brief The Change the status of a channel to TranFF.*/
+static void _Cantp_GotoTranFF(bl_CanTpChannel_t *channel);
+/** \brief The Change the status of a channel to TranCF.*/
+static void _Cantp_GotoTranCF(bl_CanTpChannel_t *channel);
+/** \brief The Change the status of a channel to TranFC.*/
+static void _Cantp_GotoTranFC(bl_CanTpChannel_t *channel, UINT8 fs);
+/** \brief Receive a Single Frame.*/
+static UINT8 _Cantp_ReceiveSF(bl_CanTpChannel_t *channel,
+                                    bl_BufferSize_t size,
+                                    const bl_Buffer_t *buffer);
+/** \brief Receive a First Frame.*/
+static UINT8 _Cantp_ReceiveFF(bl_CanTpChannel_t *channel,
+                                    bl_BufferSize_t size,
+                                    const bl_Buffer_t *buffer);
+/** \brief Receive a Consecutive Frame.*/
+static UINT8 _Cantp_ReceiveCF(bl_CanTpChannel_t *channel,
+                                    bl_BufferSize_t size,
+                                    const bl_Buffer_t *buffer);
+/** \brief Receive a Flow Control Frame.*/
+static UINT8 _Cantp_ReceiveFC(bl_CanTpChannel_t *channel,
+                                    bl_BufferSize_t size,
+                                    const bl_Buffer_t *buffer);
+
+/** \brief The period function of the Idle status of a channel.*/
+static void _Cantp_PeriodIdle(bl_CanTpChannel_t *channel);
+/** \brief The timeout function of the Idle status of a channel.*/
+static UINT8 _Cantp_TimeoutIdle(bl_CanTpChannel_t *channel);
+/** \brief The period function of the RecvSF status of a channel.*/
+static void _Cantp_PeriodRecvSF(bl_CanTpChannel_t *channel);
+/** \brief The timeout function of the RecvSF status of a channel.*/
+static UINT8 _Cantp_TimeoutRecvSF(bl_CanTpChannel_t *channel);
+#if (CANTP_FUN_RX_SF_QUEUE == ON)
+/** \brief Queue a SF received before the last SF is given to the upper layer.*/
+static UINT8 _Cantp_QueueSF(bl_CanTpChannel_t *channel,
+                            const bl_CanTpPciInfo_t *pci,
+                            bl_BufferSize_t size,
+                            const bl_Buffer_t *data);
+/** \brief Load the oldest queued SF into the frame of a channel.*/
+static UINT8 _Cantp_LoadQueuedSF(bl_CanTpChannel_t *channel);
+/** \brief Drop the queued SFs of a channel.*/
+static void _Cantp_DropQueuedSF(bl_CanTpChannel_t *channel);
+/** \brief Give the SF queues and their data to the rx channels.*/
+static void _Cantp_InitSFQueue(void);
+#endif
+/** \brief The period function of the RecvFF status of a channel.*/
+static void _Cantp_PeriodRecvFF(bl_CanTpChannel_t *channel);
+/** \brief The timeout function of the RecvFF status of a channel.*/
+static UINT8 _Cantp_TimeoutRecvFF(bl_CanTpChannel_t *channel);
+/** \brief The period function of the RecvCF status of a channel.*/
+static void _Cantp_PeriodRecvCF(bl_CanTpChannel_t *channel);
+/** \brief The timeout function of the RecvCF status of a channel.*/
+static UINT8 _Cantp_TimeoutRecvCF(bl_CanTpChannel_t *channel);
+/** \brief The period function of the TranFC status of a channel.*/
+static void _Cantp_PeriodTranFC(bl_CanTpChannel_t *channel);
+/** \brief The timeout function of the TranFC status of a channel.*/
+static UINT8 _Cantp_TimeoutTranFC(bl_CanTpChannel_t *channel);
+/** \brief The period function of the TranSF status of a channel.*/
+static void _Cantp_PeriodTranSF(bl_CanTpChannel_t *channel);
+/** \brief The timeout function of the TranSF status of a channel.*/
+static UINT8 _Cantp_TimeoutTranSF(bl_CanTpChannel_t *channel);
+/** \brief The period function of the TranFF status of a channel.*/
+static void _Cantp_PeriodTranFF(bl_CanTpChannel_t *channel);
+/** \brief The timeout function of the TranFF status of a channel.*/
+static UINT8 _Cantp_TimeoutTranFF(bl_CanTpChannel_t *channel);
+/** \brief The period function of the TranCF status of a channel.*/
+static void _Cantp_PeriodTranCF(bl_CanTpChannel_t *channel);
+/** \brief The timeout function of the TranCF status of a channel.*/
+static UINT8 _Cantp_TimeoutTranCF(bl_CanTpChannel_t *channel);
+/** \brief The period function of the RecvFC status of a channel.*/
+static void _Cantp_PeriodRecvFC(bl_CanTpChannel_t *channel);
+/** \brief The timeout function of the RecvFC status of a channel.*/
+static UINT8 _Cantp_TimeoutRecvFC(bl_CanTpChannel_t *channel);
+
+/*****************************************************************************
+ *  Internal Variable Definitions
+ *****************************************************************************/
+/** \brief The PCI used to standard, extanded or mixed channel.*/
+static const bl_CanTpPciInfo_t
+    gs_CanTpPciInfo[CANTP_NUMBER_OF_PCI_LAYOUT][CANTP_NUMBER_OF_PCI_INFO] =
+{
+    /*The channel type is CANTP_TYPE_STANDARD or CANTP_TYPE_STANDARD_CANFD.*/
+    {
+        {
+            0,1,2,1,2,
+            7,/***最大的SF的数据大小***/
+            3,/***最大的FC的数据大小***/
+            8 /***帧的大小***/
+        },
+#if ((ENABLE_CANFD == ON) || (ENABLE_CANXL == ON))
+        {
+            0,1,2,1,2,
+            62,/***最大的SF的数据大小***/
+            3,/***最大的FC的数据大小***/
+            64 /***帧的大小***/
+        },
+#endif
+#if (ENABLE_CANXL == ON)
+        {
+            0,1,2,1,2,
+            255,/***最大的SF的数据大小，SF_DL只有一个字节***/
+            3,/***最大的FC的数据大小***/
+            2048 /***帧的大小***/
+        },
+#endif
+    },
+    /*The channel type is CANTP_TYPE_EXTENDED, CANTP_TYPE_MIXED or their
+      CANFD types, the TA or AE byte shifts the PCI and the data.*/
+    {
+        {
+            1,2,3,2,3,6,4,8
+        },
+#if ((ENABLE_CANFD == ON) || (ENABLE_CANXL == ON))
+        {
+            1,2,3,2,3,
+            61,/***最大的SF的数据大小***/
+            4,/***最大的FC的数据大小***/
+            64 /***帧的大小***/
+        },
+#endif
+#if (ENABLE_CANXL == ON)
+        {
+            1,2,3,2,3,
+            255,/***最大的SF的数据大小，SF_DL只有一个字节***/
+            4,/***最大的FC的数据大小***/
+            2048 /***帧的大小***/
+        },
+#endif
+    },
+};
+
+#if ((CANTP_FUN_TX_FRAME_PADDING == ON) \
+    && (CANTP_MAX_FRAME_SIZE > CANTP_CLASSIC_FRAME_SIZE))
+/** \brief The valid sizes of the CANFD frames bigger than a classic frame.*/
+static const UINT8 gs_CanFdFrameSize[CANTP_NUMBER_OF_CANFD_SIZE] =
+{
+    12u, 16u, 20u, 24u, 32u, 48u, 64u
+};
+#endif
+
+/** \brief The period schedule interface of the Rx channel.*/
+static const bl_CanTpPeriodIF_t gs_RxPeriodList[CANTP_NUMBER_OF_RX_STATUS] =
+{
+    {
+        &_Cantp_PeriodIdle,&_Cantp_TimeoutIdle
+    },
+    {
+        &_Cantp_PeriodRecvSF,&_Cantp_TimeoutRecvSF
+    },
+    {
+        &_Cantp_PeriodRecvFF,&_Cantp_TimeoutRecvFF
+    },
+    {
+        &_Cantp_PeriodRecvCF,&_Cantp_TimeoutRecvCF
+    },
+    {
+        &_Cantp_PeriodTranFC,&_Cantp_TimeoutTranFC
+    },
+};
+
+/** \brief The period schedule interface of the Tx channel.*/
+static const bl_CanTpPeriodIF_t gs_TxPeriodList[CANTP_NUMBER_OF_TX_STATUS] =
+{
+    {
+        &_Cantp_PeriodIdle,&_Cantp_TimeoutIdle
+    },
+    {
+        &_Cantp_PeriodTranSF,&_Cantp_TimeoutTranSF
+    },
+    {
+        &_Cantp_PeriodTranFF,&_Cantp_TimeoutTranFF
+    },
+    {
+        &_Cantp_PeriodTranCF,&_Cantp_TimeoutTranCF
+    },
+    {
+        &_Cantp_PeriodRecvFC,&_Cantp_TimeoutRecvFC
+    },
+};
+/** \brief The Tx confirmation interface of a channel.*/
+static const bl_CanTpTxConfirm_t gs_TxConfirmList[CANTP_NUMBER_OF_TX_STATUS] =
+{
+    &_Cantp_TxConfirmIdle,
+    &_Cantp_TxConfirmSF,
+    &_Cantp_TxConfirmFF,
+    &_Cantp_TxConfirmCF,
+    &_Cantp_TxConfirmFC
+};
+
+/** \brief The Rx process interface of a channel.*/
+static const bl_CanTpRxProcess_t gs_RxProcessList[CANTP_NUMBER_OF_FRAME_TYPE] =
+{
+    &_Cantp_ReceiveSF,
+    &_Cantp_ReceiveFF,
+    &_Cantp_ReceiveCF,
+    &_Cantp_ReceiveFC
+};
+
+
+
+/** \brief The Rx channel list.*/
+static bl_CanTpChannel_t gs_CanTpRxChannel[CANTP_NUMBER_OF_RX_CHANNEL];
+/** \brief The Tx channel list.*/
+static bl_CanTpChannel_t gs_CanTpTxChannel[CANTP_NUMBER_OF_TX_CHANNEL];
+
+/** \brief The transmitting channel list.*/
+static bl_CanTpChannel_t *gs_TransmittingChannel[CANTP_NUMBER_OF_TX_CHANNEL];
+
+/** \brief The tx channel processed firstly in the period function.*/
+static UINT16 gs_TxFirstChannel = 0u;
+
+#if (CANTP_FUN_FIXED_ADDRESSING == ON)
+/** \brief The rx channels of the pool.*/
+static bl_CanTpChannel_t gs_CanTpPoolRxChannel[CANTP_NUMBER_OF_POOL_CHANNEL];
+/** \brief The tx channels of the pool.*/
+static bl_CanTpChannel_t gs_CanTpPoolTxChannel[CANTP_NUMBER_OF_POOL_CHANNEL];
+/** \brief The slots of the pool.*/
+static bl_CanTpPoolSlot_t gs_CanTpPoolSlot[CANTP_NUMBER_OF_POOL_CHANNEL];
+/** \brief The slot used by each SA, or CANTP_POOL_NONE.*/
+static UINT8 gs_CanTpPoolMap[CANTP_NUMBER_OF_ADDRESS];
+/** \brief The slot checked firstly when a new peer is added.*/
+static UINT8 gs_CanTpPoolNext;
+/** \brief The SA of the peer of the last request.*/
+static UINT16 gs_CanTpFixedPeer;
+#endif
+
+#if (CANTP_FUN_FRAME_POOL == ON)
+/** \brief The frame buffers of CANTP_MAX_FRAME_SIZE bytes.*/
+static bl_Buffer_t gs_CanTpFrameBuffer[CANTP_NUMBER_OF_FRAME_BUFFER]
+                                        [CANTP_MAX_FRAME_SIZE];
+/** \brief The frame buffers of CANTP_CLASSIC_FRAME_SIZE bytes.*/
+static bl_Buffer_t gs_CanTpClassicBuffer[CANTP_NUMBER_OF_CLASSIC_BUFFER]
+                                        [CANTP_CLASSIC_FRAME_SIZE];
+/** \brief The frame buffers are borrowed by the channels.*/
+static UINT8 gs_CanTpFrameBufferUsed[CANTP_NUMBER_OF_FRAME_BUFFER];
+static UINT8 gs_CanTpClassicBufferUsed[CANTP_NUMBER_OF_CLASSIC_BUFFER];
+#endif
+
+#if (CANTP_FUN_CHANNEL_SOA == ON)
+/** \brief The status of each channel slot, only these dense arrays are read
+    by the period function for an idle channel.*/
+static UINT8 gs_CanTpChannelStatus[CANTP_NUMBER_OF_CHANNEL_SLOT];
+/** \brief The timer of each channel slot.*/
+static UINT16 gs_CanTpChannelTimer[CANTP_NUMBER_OF_CHANNEL_SLOT];
+/** \brief The rxId of each channel slot, searched by the frame dispatch
+    without loading the channels and their configurations.*/
+static UINT32 gs_CanTpChannelRxId[CANTP_NUMBER_OF_CHANNEL_SLOT];
+#endif
+
+#if (CANTP_FUN_FUNCTIONAL_MULTICAST == ON)
+/** \brief The mode of the multicast transfer on the functional channels.*/
+static UINT8 gs_CanTpMulticastMode = CANTP_MULTICAST_OFF;
+#endif
+
+#if (CANTP_FUN_RX_SF_QUEUE == ON)
+/** \brief The SF queues of the rx channels.*/
+static bl_CanTpSFQueue_t gs_CanTpSFQueue[CANTP_NUMBER_OF_SF_QUEUE];
+/** \brief The data of the queued SFs.*/
+static bl_Buffer_t gs_CanTpSFQueueData[CANTP_RX_SF_QUEUE_DATA_SIZE];
+#endif
+
+#if (CANTP_FUN_RX_QUEUE == ON)
+/** \brief The frames queued by the CAN ISR.*/
+static bl_CanTpQueuedFrame_t gs_CanTpRxQueue[CANTP_RX_QUEUE_SIZE];
+/** \brief The count of the frames queued, only written by the ISR.*/
+static volatile UINT16 gs_CanTpRxQueueHead;
+/** \brief The count of the frames processed, only written by the task.*/
+static volatile UINT16 gs_CanTpRxQueueTail;
+/** \brief The count of the frames lost by the full queue, only written by
+    the ISR.*/
+static volatile UINT32 gs_CanTpRxQueueOverflow;
+#endif
+
+/*************************************************************************************************************
+                                          Function Definitions
+ ************************************************************************************************************/
+/*************************************************************************************************************
+* Function Name  : FblCanTpColdInit
+* Description    : 
+* Input          : None
+* Output         : None
+* Return         : TRUE/FALSE
+*************************************************************************************************************/
+UINT8 FblCanTpColdInit(void)
+{       
+    //FblTpInit();
+    CanTp_Init();
+#if (CANTP_FUN_WARM_HANDOVER == ON)
+    /*The no-init RAM is not valid after the power on.*/
+    CANTP_HANDOVER_RECORD->magic = 0uL;
+#endif
+    return INIT_SUCCESS;
+}
+
+/*************************************************************************************************************
+* Function Name  : FblCanTpWarmInit
+* Description    : 
+* Input          : None
+* Output         : None
+* Return         : TRUE/FALSE
+*************************************************************************************************************/
+UINT8 FblCanTpWarmInit(void)
+{
+    //FblTpInit();
+    CanTp_Init();
+#if (CANTP_FUN_WARM_HANDOVER == ON)
+    _Cantp_RestoreHandover();
+#endif
+    return INIT_SUCCESS;
+}
+
+/*************************************************************************************************************
+* Function Name  : FblCanTpTask
+* Description    : 
+* Input          : uwEventId
+                 : pucData
+* Output         : None
+* Return         : None
+*************************************************************************************************************/
+void FblCanTpTask(UINT16 uwEventId,UINT8 *pucData)
+{
+    /*Parameter validity check*/
+    RETURN_IF_FAIL(NULL != pucData);
+    
+    if(uwEventId & EVENT_MSG_READY){
+        FblCanTpMsgHandle(pucData);
+    } 
+
+    if(uwEventId & EVENT_READY){
+        FblCanTpEventHandle(uwEventId); 
+    } 
+}
+
+/*************************************************************************************************************
+* Function Name  : FblCanTpMsgHandle
+* Description    : 
+* Input          : None
+* Output         : None
+* Return         : None
+*************************************************************************************************************/
+static void FblCanTpMsgHandle(UINT8 *pucData)
+{
+    (void)pucData;
+
+#if (CANTP_FUN_RX_QUEUE == ON)
+    _Cantp_DrainRxQueue();
+#endif
+}
+
+/*************************************************************************************************************
+* Function Name  : FblCanTpEventHandle
+* Description    : 
+* Input          : uwEventId
+* Output         : None
+* Return         : None
+*************************************************************************************************************/
+static void FblCanTpEventHandle(UINT16 uwEventId)
+{
+    if(uwEventId & EVENT_SCAN_TIMER)
+    {
+#if (CANTP_FUN_RX_QUEUE == ON)
+        /*Process the queued frames before the timers are checked.*/
+        _Cantp_DrainRxQueue();
+#endif
+        Cantp_PeriodFunction();
+    }
+}
+
+/**************************************************************************//**
+ *
+ *  \details    Initialize the can TP module.
+ *
+ *  \return None.
+ *
+ *  \since  V1.0.0
+ *
+ *****************************************************************************/
+static void CanTp_Init(void)
+{
+    bl_CanTpHandle_t handle;
+    bl_CanTpChannel_t *channel;
+    const bl_CanTpChannelCfg_t *channelCfg;
+
+    /*Initialize the RX channels*/
+    for (handle = 0; handle < CANTP_NUMBER_OF_RX_CHANNEL; handle++)
+    {
+        channel = &gs_CanTpRxChannel[handle];
+        channelCfg = &g_CanTpRxChnsCfg[handle];
+#if (CANTP_FUN_CHANNEL_SOA == ON)
+        channel->slot = (UINT16)(CANTP_RX_CHANNEL_SLOT + handle);
+#endif
+        _Cantp_InitChannel(channel, channelCfg);
+#if (CANTP_FUN_FIXED_ADDRESSING == ON)
+        channel->handle = handle;
+#endif
+    }
+
+    /*Initialize the TX channels*/
+    for (handle = 0; handle < CANTP_NUMBER_OF_TX_CHANNEL; handle++)
+    {
+        channel = &gs_CanTpTxChannel[handle];
+        channelCfg = &g_CanTpTxChnsCfg[handle];
+#if (CANTP_FUN_CHANNEL_SOA == ON)
+        channel->slot = (UINT16)(CANTP_TX_CHANNEL_SLOT + handle);
+#endif
+        _Cantp_InitChannel(channel, channelCfg);
+#if (CANTP_FUN_FIXED_ADDRESSING == ON)
+        channel->handle = handle;
+#endif
+    }
+
+#if(CANTP_COMMUNICATION_DUPLEX == CANTP_HALF_DUPLEX)
+    /*Link the rx and tx channels which use the same connection*/
+    for (handle = 0; handle < CANTP_NUMBER_OF_RX_CHANNEL; handle++)
+    {
+        channel = &gs_CanTpRxChannel[handle];
+        channel->pair = _Cantp_GetChannelByRxId(channel->chnCfg->ctrl,
+                                                channel->chnCfg->rxId,
+                                                CANTP_NUMBER_OF_TX_CHANNEL,
+                                                gs_CanTpTxChannel);
+    }
+
+    for (handle = 0; handle < CANTP_NUMBER_OF_TX_CHANNEL; handle++)
+    {
+        channel = &gs_CanTpTxChannel[handle];
+        channel->pair = _Cantp_GetChannelByRxId(channel->chnCfg->ctrl,
+                                                channel->chnCfg->rxId,
+                                                CANTP_NUMBER_OF_RX_CHANNEL,
+                                                gs_CanTpRxChannel);
+    }
+#endif
+
+#if (CANTP_FUN_FIXED_ADDRESSING == ON)
+    _Cantp_InitPool();
+#endif
+
+#if (CANTP_FUN_FRAME_POOL == ON)
+    _Cantp_InitFramePool();
+#endif
+
+#if (CANTP_FUN_RX_SF_QUEUE == ON)
+    _Cantp_InitSFQueue();
+#endif
+
+#if (CANTP_FUN_RX_QUEUE == ON)
+    /*The frames queued before the initialization are dropped.*/
+    gs_CanTpRxQueueTail = gs_CanTpRxQueueHead;
+    gs_CanTpRxQueueOverflow = 0uL;
+#endif
+
+#if (CANTP_FUN_CLIENT_SCHEDULER == ON)
+    CanTpSched_Init();
+#endif
+
+#if (CANTP_FUN_GATEWAY_ROUTING == ON)
+    CanTpRoute_Init();
+#endif
+
+#if (CANTP_FUN_DOIP_GATEWAY == ON)
+    CanTpDoIp_Init();
+#endif
+
+#if (CANTP_FUN_RX_STREAM == ON)
+    CanTpStream_Init();
+#endif
+
+    return ;
+}
+
+/**************************************************************************//**
+ *
+ *  \details Transmit the data.
+ *
+ *  \param[in]  handle - Tx handle.
+ *  \param[in]  size - the size of the data.
+ *
+ *  \return If the message is started returns ERR_OK. If the channel can not
+ *          transmit the message, e.g. multiple frames on a functional
+ *          channel, returns ERR_OVERFLOW. Otherwise the channel is busy and
+ *          returns ERR_ERROR.
+ *
+ *  \since  V2.0.0
+ *
+ *****************************************************************************/
+UINT8 Cantp_Transmit(bl_CanTpHandle_t handle, bl_BufferSize_t size)
+{
+    UINT8  ret = ERR_ERROR;
+#if (CANTP_FUN_TX_REQUEST_QUEUE == ON)
+    bl_CanTpTxRequest_t request;
+#else
+    bl_CanTpChannel_t *channel;
+#endif
+
+    BL_DEBUG_ASSERT_PARAM(handle < CANTP_NUMBER_OF_TX_CHANNEL);
+    BL_DEBUG_ASSERT_PARAM(size != 0);
+
+#if (CANTP_FUN_TX_REQUEST_QUEUE == ON)
+    request.size = size;
+    request.data = NULL_PTR;
+#if (CANTP_FUN_RESUMABLE_TRANSFER == ON)
+    request.skipSize = 0u;
+#endif
+    ret = _Cantp_TransmitRequest(handle, &request);
+#else
+    channel = _Cantp_GetTxChannel(handle);
+    
+    if((channel != NULL_PTR) && (CANTP_STATUS_IS_IDLE(channel)))
+    {
+        ret = _Cantp_StartTransmit(channel, size);
+    }
+#endif
+
+    return ret;
+}
+
+#if (CANTP_FUN_TX_REQUEST_QUEUE == ON)
+/**************************************************************************//**
+ *
+ *  \details    Transmit the data of a buffer of the upper layer. The message
+ *              is queued as Cantp_Transmit if the channel is busy, and the
+ *              channel copies the data from the buffer instead of the upper
+ *              layer, so the buffer shall be kept until the message is
+ *              confirmed.
+ *
+ *  \param[in]  handle - Tx handle.
+ *  \param[in]  size - the size of the data.
+ *  \param[in]  data - the data of the message.
+ *
+ *  \return If the message is started or queued returns ERR_OK. If the
+ *          channel can not transmit the message returns ERR_OVERFLOW,
+ *          otherwise returns ERR_ERROR.
+ *
+ *  \since  V5.2.0
+ *
+ *****************************************************************************/
+UINT8 Cantp_TransmitData(bl_CanTpHandle_t handle,
+                            bl_BufferSize_t size,
+                            const bl_Buffer_t *data)
+{
+    bl_CanTpTxRequest_t request;
+
+    BL_DEBUG_ASSERT_PARAM(handle < CANTP_NUMBER_OF_TX_CHANNEL);
+    BL_DEBUG_ASSERT_PARAM(size != 0);
+    BL_DEBUG_ASSERT_PARAM(data != NULL_PTR);
+
+    request.size = size;
+    request.data = data;
+#if (CANTP_FUN_RESUMABLE_TRANSFER == ON)
+    request.skipSize = 0u;
+#endif
+
+    return _Cantp_TransmitRequest(handle, &request);
+}
+#endif
+
+/**************************************************************************//**
+ *
+ *  \details    Start to transmit a message by an idle tx channel, the first
+ *              frame is transmitted by the period function.
+ *
+ *  \param[in/out]  channel - the pointer of a tx channel.
+ *  \param[in]  size - the size of the message.
+ *
+ *  \return If the message is started returns ERR_OK. If the channel can not
+ *          transmit the message returns ERR_OVERFLOW, otherwise returns
+ *          ERR_ERROR.
+ *
+ *  \since  V5.2.0
+ *
+ *****************************************************************************/
+static UINT8 _Cantp_StartTransmit(bl_CanTpChannel_t *channel,
+                                    bl_BufferSize_t size)
+{
+    UINT8  ret = ERR_ERROR;
+    const bl_CanTpPciInfo_t *pci;
+    bl_BufferSize_t txDl;
+
+#if (CANTP_FUN_RESUMABLE_TRANSFER == ON)
+    channel->resume = FALSE;
+    channel->resumeOffset = 0u;
+    channel->resumeBase = 0u;
+    channel->skipSize = 0u;
+#endif
+    txDl = channel->chnCfg->txDl;
+#if(CANTP_COMMUNICATION_DUPLEX == CANTP_HALF_DUPLEX)
+    if ((CANTP_TX_DL_AUTO == txDl) && (channel->pair != NULL_PTR))
+    {
+        /*Use the RX_DL of the last request received by the pair.*/
+        txDl = CANTP_CHANNEL_DL(channel->pair);
+    }
+#endif
+    if (txDl > CANTP_GET_MAX_DL(channel))
+    {
+        txDl = CANTP_GET_MAX_DL(channel);
+    }
+    pci = _Cantp_GetPciInfo(channel->chnCfg->type, txDl);
+    channel->pciInfo = pci;
+    /*The FF and the CFs fill the frames of the TX_DL.*/
+    CANTP_SET_CHANNEL_DL(channel,
+                        (txDl > CANTP_CLASSIC_FRAME_SIZE)
+                            ? txDl : pci->frameSize);
+
+    if ((size > CANTP_CHANNEL_SF_DATA_SIZE(channel))
+        && (!CANTP_IS_PHYSICAL_CHANNEL(channel))
+        && (!CANTP_IS_MULTICAST_CHANNEL(channel)))
+    {
+        /*A functional channel only transmits SFs.*/
+        ret = ERR_OVERFLOW;
+    }
+#if (CANTP_FUN_FRAME_POOL == ON)
+    else if (_Cantp_GetFrameBuffer(channel) != ERR_OK)
+    {
+        /*No buffer is free, the upper layer tries again.*/
+        ret = ERR_ERROR;
+    }
+#endif
+    else if (size > CANTP_CHANNEL_SF_DATA_SIZE(channel))
+    {
+        _Cantp_SetMultipleFrameSize(channel,size);
+        _Cantp_GotoTranFF(channel);
+
+        ret = ERR_OK;
+    }
+    else
+    {
+        channel->lastSize = size;
+        _Cantp_GotoTranSF(channel);
+
+        ret = ERR_OK;
+    }
+
+    return ret;
+}
+
+#if (CANTP_FUN_TX_REQUEST_QUEUE == ON)
+/**************************************************************************//**
+ *
+ *  \details    Start a message by an idle tx channel. If the channel is
+ *              busy or has queued messages, the message is queued behind
+ *              them. The queue is only written by the task of the upper
+ *              layer, so a message queued while the channel goes to the idle
+ *              status is started here.
+ *
+ *  \param[in]  handle - Tx handle.
+ *  \param[in]  request - the message.
+ *
+ *  \return If the message is started or queued returns ERR_OK. If the
+ *          channel can not transmit the message returns ERR_OVERFLOW,
+ *          otherwise returns ERR_ERROR.
+ *
+ *  \since  V5.2.0
+ *
+ *****************************************************************************/
+static UINT8 _Cantp_TransmitRequest(bl_CanTpHandle_t handle,
+                                    const bl_CanTpTxRequest_t *request)
+{
+    UINT8 ret = ERR_ERROR;
+    bl_CanTpChannel_t *channel;
+
+    channel = _Cantp_GetTxChannel(handle);
+
+    if (channel != NULL_PTR)
+    {
+        /*The queued messages are transmitted first.*/
+        if ((CANTP_STATUS_IS_IDLE(channel))
+            && (channel->txqTail == channel->txqHead))
+        {
+            ret = _Cantp_StartRequest(channel, request);
+        }
+        else
+        {
+            ret = _Cantp_QueueTransmit(channel, request);
+
+            /*The channel went to the idle status before the message was
+              queued, only the task starts the messages of an idle channel.*/
+            if ((ERR_OK == ret) && (CANTP_STATUS_IS_IDLE(channel)))
+            {
+                _Cantp_StartQueuedTransmit(channel);
+            }
+        }
+    }
+
+    return ret;
+}
+
+/**************************************************************************//**
+ *
+ *  \details    Start a message by an idle tx channel, and set the source of
+ *              its data and the data skipped before it is transmitted.
+ *
+ *  \param[in/out]  channel - the pointer of a idle tx channel.
+ *  \param[in]  request - the message.
+ *
+ *  \return If the message is started returns ERR_OK. If the channel can not
+ *          transmit the message returns ERR_OVERFLOW, otherwise returns
+ *          ERR_ERROR.
+ *
+ *  \since  V5.2.0
+ *
+ *****************************************************************************/
+static UINT8 _Cantp_StartRequest(bl_CanTpChannel_t *channel,
+                                    const bl_CanTpTxRequest_t *request)
+{
+    UINT8 ret;
+
+    channel->txData = request->data;
+    ret = _Cantp_StartTransmit(channel, request->size);
+#if (CANTP_FUN_RESUMABLE_TRANSFER == ON)
+    if (ERR_OK == ret)
+    {
+        channel->skipSize = request->skipSize;
+        channel->resumeOffset = request->skipSize;
+        channel->resumeBase = request->skipSize;
+    }
+#endif
+
+    return ret;
+}
+
+/**************************************************************************//**
+ *
+ *  \details    Queue a message behind the transfer of a tx channel. It is
+ *              started when the channel goes to the idle status, and its data
+ *              is copied from its buffer or from the upper layer after the
+ *              data of the messages queued before it. It is only called by
+ *              the task of the upper layer, which is the only writer of the
+ *              head of the queue.
+ *
+ *  \param[in/out]  channel - the pointer of a tx channel.
+ *  \param[in]  request - the message.
+ *
+ *  \return If the message is queued returns ERR_OK, otherwise the queue is
+ *          full and returns ERR_ERROR.
+ *
+ *  \since  V5.2.0
+ *
+ *****************************************************************************/
+static UINT8 _Cantp_QueueTransmit(bl_CanTpChannel_t *channel,
+                                    const bl_CanTpTxRequest_t *request)
+{
+    UINT8 ret = ERR_ERROR;
+    UINT8 head;
+
+    head = channel->txqHead;
+    if ((UINT8)(head - channel->txqTail) < CANTP_TX_REQUEST_QUEUE_SIZE)
+    {
+        channel->txQueue[head & CANTP_TX_REQUEST_QUEUE_MASK] = *request;
+
+        /*The message is written before it is published.*/
+        CANTP_RX_QUEUE_BARRIER();
+        channel->txqHead = (UINT8)(head + 1u);
+        ret = ERR_OK;
+    }
+
+    return ret;
+}
+
+/**************************************************************************//**
+ *
+ *  \details    Start the oldest queued message of a tx channel which goes to
+ *              the idle status. A message which can not be started is
+ *              confirmed with ERR_ERROR and the next one is tried. It is
+ *              only called when the channel is idle, so it is the only
+ *              writer of the tail of the queue.
+ *
+ *  \param[in/out]  channel - the pointer of a idle tx channel.
+ *
+ *  \return None.
+ *
+ *  \since  V5.2.0
+ *
+ *****************************************************************************/
+static void _Cantp_StartQueuedTransmit(bl_CanTpChannel_t *channel)
+{
+    bl_CanTpTxRequest_t request;
+    UINT8 ret = ERR_ERROR;
+    UINT8 tail;
+
+    tail = channel->txqTail;
+    while ((ret != ERR_OK) && (tail != channel->txqHead))
+    {
+        /*The message is read after its head is read.*/
+        CANTP_RX_QUEUE_BARRIER();
+        request = channel->txQueue[tail & CANTP_TX_REQUEST_QUEUE_MASK];
+        tail = (UINT8)(tail + 1u);
+
+        /*The message is read before its entry is given back.*/
+        CANTP_RX_QUEUE_BARRIER();
+        channel->txqTail = tail;
+
+        ret = _Cantp_StartRequest(channel, &request);
+        if (ret != ERR_OK)
+        {
+            CANTP_TX_CONFIRMATION(channel,ERR_ERROR);
+        }
+    }
+
+    return ;
+}
+
+/**************************************************************************//**
+ *
+ *  \details    Copy the transmitting data of a tx channel from the buffer of
+ *              the message, or from the upper layer if the message has no
+ *              buffer.
+ *
+ *  \param[in/out]  channel - the pointer of a tx channel.
+ *  \param[in]  size - the size of the data.
+ *  \param[out] buffer - the buffer of the data.
+ *
+ *  \return If the data is copied returns ERR_OK, otherwise returns the
+ *          result of the upper layer.
+ *
+ *  \since  V5.2.0
+ *
+ *****************************************************************************/
+static UINT8 _Cantp_CopyTxData(bl_CanTpChannel_t *channel,
+                                bl_BufferSize_t size,
+                                bl_Buffer_t *buffer)
+{
+    UINT8 ret = ERR_OK;
+
+    if (NULL_PTR == channel->txData)
+    {
+        ret = CANTP_UL_COPY_TX_DATA(CANTP_GET_TX_HANDLE(channel),
+                                    size,
+                                    buffer);
+    }
+    else
+    {
+        FblMemCpy(buffer, channel->txData, (UINT16)size);
+        channel->txData = &channel->txData[size];
+    }
+
+    return ret;
+}
+#endif
+
+/**************************************************************************//**
+ *
+ *  \details    Get the tx channel used by a tx handle of the upper layer.
+ *
+ *  \param[in]  handle - tx handle.
+ *
+ *  \return the pointer of the tx channel, or NULL_PTR if the template of
+ *          the fixed addressing has no peer.
+ *
+ *  \since  V5.2.0
+ *
+ *****************************************************************************/
+static bl_CanTpChannel_t *_Cantp_GetTxChannel(bl_CanTpHandle_t handle)
+{
+    bl_CanTpChannel_t *channel;
+
+    channel = &gs_CanTpTxChannel[handle];
+#if (CANTP_FUN_FIXED_ADDRESSING == ON)
+    if (CANTP_IS_FIXED_TYPE(channel->chnCfg->type))
+    {
+        /*The template transmits to the peer of the last request by the
+          tx channel of its slot.*/
+        channel = _Cantp_GetFixedPeerChannel(channel);
+    }
+#endif
+
+    return channel;
+}
+
+/**************************************************************************//**
+ *
+ *  \details    If a tx channel wait for receiving a FC frame, The tx channel
+ *              process this frame. otherwise the rx channel process it.
+ *
+ *  \param[in]  handle - rx handle of the canif.
+ *  \param[in]  size - the size of the data.
+ *  \param[in]  buffer - the content of the data.
+ *
+ *  \return None.
+ *
+ *  \since  V2.0.0
+ *
+ *****************************************************************************/
+void Cantp_RxIndication(UINT32 id,
+                            bl_BufferSize_t size,
+                            const bl_Buffer_t *buffer)
+{
+    Cantp_CtrlRxIndication(CANTP_DEFAULT_CTRL, id, size, buffer);
+
+    return ;
+}
+
+/**************************************************************************//**
+ *
+ *  \details    Indicate a frame received by a CAN controller. It is used when
+ *              the channels are on more than one bus and the same ID may be
+ *              used on each bus.
+ *
+ *  \param[in]  ctrl - the CAN controller receiving the frame.
+ *  \param[in]  id - rx handle of the canif.
+ *  \param[in]  size - the size of the data.
+ *  \param[in]  buffer - the content of the data.
+ *
+ *  \return None.
+ *
+ *  \since  V5.2.0
+ *
+ *****************************************************************************/
+void Cantp_CtrlRxIndication(UINT8 ctrl,
+                            UINT32 id,
+                            bl_BufferSize_t size,
+                            const bl_Buffer_t *buffer)
+{
+    bl_CanTpChannel_t *channel;
+    UINT8 ret;
+
+    /*Check whether the parameters are valid.*/
+    if (CANTP_IS_VALID_FRAME(size, buffer))
+    {
+        channel = _Cantp_GetTxChannelById(ctrl, id);
+        ret = _Cantp_RxIndToTx(ctrl,id,channel,size,buffer);/***仅接收流控帧***/
+        if (ret != ERR_OK)   /*the Tx channel is not process this frame.*/
+        {
+            channel = _Cantp_GetRxChannelById(ctrl, id);
+            (void)_Cantp_RxIndToRxChannel(channel,size,buffer);/***接收除流控帧外的其他帧***/
+
+        }
+    }
+
+    return ;
+}
+
+/**************************************************************************//**
+ *
+ *  \details    Indicate the frames drained from the RX FIFO of a CAN driver
+ *              in one call. The channels are gotten once for each run of
+ *              frames with the same id, and the CFs of a run are given to
+ *              the receiving rx channel without the dispatch of the frame
+ *              types.
+ *
+ *  \param[in]  frames - the frames in the received order.
+ *  \param[in]  count - the number of the frames.
+ *
+ *  \return None.
+ *
+ *  \since  V5.2.0
+ *
+ *****************************************************************************/
+void Cantp_RxIndicationBatch(const bl_CanTpFrame_t *frames, UINT16 count)
+{
+    const bl_CanTpFrame_t *frame;
+    bl_CanTpChannel_t *txChannel = NULL_PTR;
+    bl_CanTpChannel_t *rxChannel = NULL_PTR;
+    UINT8 rxFound = FALSE;
+    UINT8 ret;
+    UINT16 i;
+
+    BL_DEBUG_ASSERT_PARAM((frames != NULL_PTR) || (0u == count));
+
+    for (i = 0; i < count; i++)
+    {
+        frame = &frames[i];
+
+        if (!CANTP_IS_VALID_FRAME(frame->size, frame->buffer))
+        {
+            continue;
+        }
+
+        if ((0u == i) || (frame->id != frames[i - 1u].id)
+            || (frame->ctrl != frames[i - 1u].ctrl))
+        {
+            /*A new run of frames, get its channels once.*/
+            txChannel = _Cantp_GetTxChannelById(frame->ctrl, frame->id);
+            rxChannel = NULL_PTR;
+            rxFound = FALSE;
+        }
+
+        /*A CF is never received by a tx channel, so the CFs following the
+          first frame of a run go to the rx channel directly.*/
+        if ((rxChannel != NULL_PTR)
+            && (CANTP_STATUS_IS_RECVCF(rxChannel))
+            && ((CANTP_IS_STANDARD_CHANNEL(rxChannel))
+                || (rxChannel->chnCfg->ta == frame->buffer[CANTP_TA_OFFSET]))
+            && (CANTP_FRAME_TYPE_CF
+                == CANTP_GET_FRAME_TYPE(CANTP_CHANNEL_PCI(rxChannel),frame->buffer)))
+        {
+            ret = _Cantp_ReceiveCF(rxChannel, frame->size, frame->buffer);
+            if (ERR_OK == ret)
+            {
+                _Cantp_RxChannelReceived(rxChannel);
+            }
+            continue;
+        }
+
+        ret = _Cantp_RxIndToTx(frame->ctrl,
+                                frame->id,
+                                txChannel,
+                                frame->size,
+                                frame->buffer);
+        if (ret != ERR_OK)
+        {
+            if (FALSE == rxFound)
+            {
+                rxChannel = _Cantp_GetRxChannelById(frame->ctrl, frame->id);
+                rxFound = TRUE;
+            }
+
+            (void)_Cantp_RxIndToRxChannel(rxChannel,
+                                            frame->size,
+                                            frame->buffer);
+        }
+    }
+
+    return ;
+}
+
+#if (CANTP_FUN_RX_QUEUE == ON)
+/**************************************************************************//**
+ *
+ *  \details    Copy a frame received by a CAN controller into the rx queue,
+ *              called by the CAN ISR. The frame is processed by the task
+ *              later, the ISR is the only producer of the queue.
+ *
+ *  \param[in]  ctrl - the CAN controller receiving the frame.
+ *  \param[in]  id - the id of the frame.
+ *  \param[in]  size - the size of the frame.
+ *  \param[in]  buffer - the contents of the frame.
+ *
+ *  \return If the frame is queued return ERR_OK, if the queue is full
+ *          return ERR_OVERFLOW, otherwise return ERR_ERROR.
+ *
+ *  \since  V5.2.0
+ *
+ *****************************************************************************/
+UINT8 Cantp_QueueRxIndication(UINT8 ctrl,
+                                UINT32 id,
+                                bl_BufferSize_t size,
+                                const bl_Buffer_t *buffer)
+{
+    bl_CanTpQueuedFrame_t *entry;
+    UINT16 head = gs_CanTpRxQueueHead;
+    UINT8 ret = ERR_ERROR;
+
+    if ((size > CANTP_MAX_FRAME_SIZE) || (!CANTP_IS_VALID_FRAME(size, buffer)))
+    {
+        /*The frame is not received by the cantp module.*/
+    }
+    else if ((UINT16)(head - gs_CanTpRxQueueTail) >= CANTP_RX_QUEUE_SIZE)
+    {
+        gs_CanTpRxQueueOverflow++;
+        ret = ERR_OVERFLOW;
+    }
+    else
+    {
+        entry = &gs_CanTpRxQueue[head & CANTP_RX_QUEUE_MASK];
+        entry->ctrl = ctrl;
+        entry->id = id;
+        entry->size = size;
+        FblMemCpy(entry->data, buffer, size);
+
+        /*The frame shall be written before it is published to the task.*/
+        CANTP_RX_QUEUE_BARRIER();
+        gs_CanTpRxQueueHead = (UINT16)(head + 1u);
+
+        CANTP_RX_QUEUE_NOTIFY();
+        ret = ERR_OK;
+    }
+
+    return ret;
+}
+
+/**************************************************************************//**
+ *
+ *  \details    Get the count of the frames lost because the rx queue is full.
+ *
+ *  \return the count of the lost frames.
+ *
+ *  \since  V5.2.0
+ *
+ *****************************************************************************/
+UINT32 Cantp_GetRxQueueOverflow(void)
+{
+    return gs_CanTpRxQueueOverflow;
+}
+#endif
+
+/**************************************************************************//**
+ *
+ *  \details    If a channel wait for a confirmation, call the confirmation
+ *              function of this channel.
+ *
+ *  \param[in]  handle - tx handle of the canif.
+ *
+ *  \return None.
+ *
+ *  \since  V2.0.0
+ *
+ *****************************************************************************/
+void Cantp_TxConfirmation(UINT32 id)
+{
+    bl_CanTpChannel_t *channel;
+    bl_CanTpTxConfirm_t confirm;
+    UINT16 i;
+
+    for (i = 0; i < CANTP_NUMBER_OF_TX_CHANNEL; i++)
+    {
+        channel = gs_TransmittingChannel[i];
+        if ((channel != NULL_PTR) && (channel->chnCfg->txId == id))
+        {
+            BL_DEBUG_ASSERT_NO_RET(CANTP_CHANNEL_STATUS(channel)<CANTP_NUMBER_OF_TX_STATUS);
+
+            confirm = gs_TxConfirmList[CANTP_CHANNEL_STATUS(channel)];
+
+            confirm(channel);
+
+            gs_TransmittingChannel[i] = NULL_PTR;
+
+            break;
+        }
+    }
+
+    return ;
+}
+
+/**************************************************************************//**
+ *
+ *  \details    When the timer of a channel is not timeout, call the period
+ *              function. If the timer is timeout, call the timeout function.
+ *
+ *  \return None.
+ *
+ *  \since  V2.0.0
+ *
+ *****************************************************************************/
+void Cantp_PeriodFunction(void)
+{
+#if (CANTP_FUN_CLIENT_SCHEDULER == ON)
+    CanTpSched_PeriodFunction();
+#endif
+
+#if (CANTP_FUN_DOIP_GATEWAY == ON)
+    CanTpDoIp_PeriodFunction();
+#endif
+
+    _Cantp_PeriodFunction(CANTP_NUMBER_OF_RX_CHANNEL,
+                            0u,
+                            gs_CanTpRxChannel,
+                            gs_RxPeriodList);
+
+#if ((CANTP_FUN_FIXED_ADDRESSING == ON) && (CANTP_FUN_TX_PRIORITY == ON))
+    /*The FCs of the peers are transmitted before the CFs too.*/
+    _Cantp_PeriodFunction(CANTP_NUMBER_OF_POOL_CHANNEL,
+                            0u,
+                            gs_CanTpPoolRxChannel,
+                            gs_RxPeriodList);
+#endif
+
+#if (CANTP_FUN_TX_PRIORITY == ON)
+    _Cantp_PeriodUrgentTx(CANTP_NUMBER_OF_TX_CHANNEL, gs_CanTpTxChannel);
+#if (CANTP_FUN_FIXED_ADDRESSING == ON)
+    _Cantp_PeriodUrgentTx(CANTP_NUMBER_OF_POOL_CHANNEL, gs_CanTpPoolTxChannel);
+#endif
+#endif
+
+    _Cantp_PeriodFunction(CANTP_NUMBER_OF_TX_CHANNEL,
+                            gs_TxFirstChannel,
+                            gs_CanTpTxChannel,
+                            gs_TxPeriodList);
+
+#if (CANTP_FUN_FIXED_ADDRESSING == ON)
+#if (CANTP_FUN_TX_PRIORITY == OFF)
+    _Cantp_PeriodFunction(CANTP_NUMBER_OF_POOL_CHANNEL,
+                            0u,
+                            gs_CanTpPoolRxChannel,
+                            gs_RxPeriodList);
+#endif
+
+    _Cantp_PeriodFunction(CANTP_NUMBER_OF_POOL_CHANNEL,
+                            0u,
+                            gs_CanTpPoolTxChannel,
+                            gs_TxPeriodList);
+#endif
+
+#if (CANTP_FUN_CLIENT_SCHEDULER == ON)
+    /*Rotate the first tx channel so that each session gets the same chance
+      to use the bus when the frame budget of a period is exhausted.*/
+    gs_TxFirstChannel += 1u;
+    if (gs_TxFirstChannel >= CANTP_NUMBER_OF_TX_CHANNEL)
+    {
+        gs_TxFirstChannel = 0u;
+    }
+#endif
+}
+
+#if (CANTP_FUN_FUNCTIONAL_MULTICAST == ON)
+/**************************************************************************//**
+ *
+ *  \details    Set the mode of the multicast transfer. In the server role, the
+ *              leader receives the multiple frames on the functional channel
+ *              and transmits the FC, the followers receive the same frames
+ *              without transmitting the FC. In the client role, any mode
+ *              except CANTP_MULTICAST_OFF allows the functional tx channel to
+ *              transmit multiple frames, the FC is received from the leader.
+ *
+ *  \param[in]  mode - CANTP_MULTICAST_OFF, CANTP_MULTICAST_LEADER or
+ *                      CANTP_MULTICAST_FOLLOWER.
+ *
+ *  \return If the mode is changed returns ERR_OK, otherwise returns
+ *          ERR_ERROR.
+ *
+ *  \since  V5.2.0
+ *
+ *****************************************************************************/
+UINT8 Cantp_SetMulticastMode(UINT8 mode)
+{
+    UINT8 ret = ERR_ERROR;
+    UINT16 i;
+
+    if (mode <= CANTP_MULTICAST_FOLLOWER)
+    {
+        ret = ERR_OK;
+
+        /*Do NOT change the mode during a multicast transfer.*/
+        for (i = 0; i < CANTP_NUMBER_OF_RX_CHANNEL; i++)
+        {
+            if ((CANTP_IS_FUNCTIONAL_CHANNEL(&gs_CanTpRxChannel[i]))
+                && (CANTP_STATUS_IS_NOT_IDLE(&gs_CanTpRxChannel[i])))
+            {
+                ret = ERR_ERROR;
+            }
+        }
+
+        for (i = 0; i < CANTP_NUMBER_OF_TX_CHANNEL; i++)
+        {
+            if ((CANTP_IS_FUNCTIONAL_CHANNEL(&gs_CanTpTxChannel[i]))
+                && (CANTP_STATUS_IS_NOT_IDLE(&gs_CanTpTxChannel[i])))
+            {
+                ret = ERR_ERROR;
+            }
+        }
+
+        if (ERR_OK == ret)
+        {
+            gs_CanTpMulticastMode = mode;
+        }
+    }
+
+    return ret;
+}
+
+/**************************************************************************//**
+ *
+ *  \details    Get the catch-up offset of the last multicast transfer of a
+ *              rx channel. The data from this offset to the end of the
+ *              message is lost, and shall be transmitted again by the
+ *              physical channel.
+ *
+ *  \param[in]  handle - rx handle.
+ *  \param[out] offset - the size of the data copied to the upper layer.
+ *
+ *  \return If some CF of the last multicast transfer are lost returns
+ *          ERR_OK, otherwise returns ERR_ERROR.
+ *
+ *  \since  V5.2.0
+ *
+ *****************************************************************************/
+UINT8 Cantp_GetCatchUpOffset(bl_CanTpHandle_t handle, bl_BufferSize_t *offset)
+{
+    bl_CanTpChannel_t *channel;
+    UINT8 ret = ERR_ERROR;
+
+    BL_DEBUG_ASSERT_PARAM(handle < CANTP_NUMBER_OF_RX_CHANNEL);
+    BL_DEBUG_ASSERT_PARAM(offset != NULL_PTR);
+
+    channel = &gs_CanTpRxChannel[handle];
+
+    if (channel->catchUp != FALSE)
+    {
+        *offset = channel->catchUpOffset;
+        ret = ERR_OK;
+    }
+
+    return ret;
+}
+
+/**************************************************************************//**
+ *
+ *  \details    Save the size of the data copied to the upper layer when the
+ *              first CF of a multicast transfer is lost.
+ *
+ *  \param[in/out]  channel - the pointer of a rx channel.
+ *
+ *  \return None.
+ *
+ *  \since  V5.2.0
+ *
+ *****************************************************************************/
+static void _Cantp_SaveCatchUpOffset(bl_CanTpChannel_t *channel)
+{
+    if (CANTP_STATUS_IS_RECVCF(channel))
+    {
+        channel->catchUpOffset = _Cantp_GetCommittedSize(channel);
+    }
+    else
+    {
+        /*The buffer is not gotten, all data is lost.*/
+        channel->catchUpOffset = 0u;
+    }
+
+    channel->catchUp = TRUE;
+
+    return ;
+}
+#endif
+
+#if ((CANTP_FUN_FUNCTIONAL_MULTICAST == ON) \
+    || (CANTP_FUN_RESUMABLE_TRANSFER == ON))
+/**************************************************************************//**
+ *
+ *  \details    Get the size of the data of the FF and the CF which are
+ *              transferred by a channel after its FF.
+ *
+ *  \param[in]  channel - the pointer of a channel.
+ *
+ *  \return the size of the data.
+ *
+ *  \since  V5.2.0
+ *
+ *****************************************************************************/
+static bl_BufferSize_t _Cantp_GetCommittedSize(const bl_CanTpChannel_t *channel)
+{
+    bl_BufferSize_t remain = 0u;
+
+    if (channel->cfCnt != 0)
+    {
+        remain = ((bl_BufferSize_t)(channel->cfCnt - 1u)
+                    * CANTP_CHANNEL_CF_DATA_SIZE(channel))
+                    + (bl_BufferSize_t)channel->lastSize;
+    }
+
+    return (bl_BufferSize_t)(channel->totalSize - remain);
+}
+#endif
+
+#if (CANTP_FUN_CHANGE_PARAMETER == ON)
+/**************************************************************************//**
+ *
+ *  \details    Change the BS or the STmin sent in the FC frames by a rx
+ *              channel. The new value is used from the next FC, a reception
+ *              in progress continues with it from its next block. With the
+ *              fixed addressing, the peers of the rx template use it too.
+ *
+ *  \param[in]  handle - rx handle.
+ *  \param[in]  parameter - CANTP_PARAMETER_BS or CANTP_PARAMETER_STMIN.
+ *  \param[in]  value - the BS(0-255), or the STmin(0x00-0x7F, 0xF1-0xF9).
+ *
+ *  \return If the value is changed returns ERR_OK, otherwise returns
+ *          ERR_ERROR.
+ *
+ *  \since  V5.2.0
+ *
+ *****************************************************************************/
+UINT8 Cantp_ChangeParameter(bl_CanTpHandle_t handle,
+                            UINT8 parameter,
+                            UINT16 value)
+{
+    bl_CanTpChannel_t *channel;
+    UINT8 ret = ERR_ERROR;
+#if (CANTP_FUN_FIXED_ADDRESSING == ON)
+    UINT16 i;
+#endif
+
+    BL_DEBUG_ASSERT_PARAM(handle < CANTP_NUMBER_OF_RX_CHANNEL);
+
+    channel = &gs_CanTpRxChannel[handle];
+
+    if ((CANTP_PARAMETER_BS == parameter) && (value <= 0xFFu))
+    {
+        channel->fcBs = (UINT8)value;
+        ret = ERR_OK;
+    }
+    else if ((CANTP_PARAMETER_STMIN == parameter)
+        && ((value <= CANTP_MAX_STMIN_VALUE)
+            || ((value > CANTP_MIN_STMIN_VALUE_US)
+                && (value < CANTP_MAX_STMIN_VALUE_US))))
+    {
+        CANTP_SET_STMIN(channel, value);
+        ret = ERR_OK;
+    }
+    else
+    {
+        /*The parameter or the value is not valid.*/
+    }
+
+#if (CANTP_FUN_FIXED_ADDRESSING == ON)
+    if (ERR_OK == ret)
+    {
+        for (i = 0; i < CANTP_NUMBER_OF_POOL_CHANNEL; i++)
+        {
+            if (gs_CanTpPoolSlot[i].rxTmpl == channel)
+            {
+                gs_CanTpPoolRxChannel[i].fcBs = channel->fcBs;
+                gs_CanTpPoolRxChannel[i].st = channel->st;
+            }
+        }
+    }
+#endif
+
+    return ret;
+}
+
+/**************************************************************************//**
+ *
+ *  \details    Read the BS or the STmin sent in the FC frames by a rx
+ *              channel.
+ *
+ *  \param[in]  handle - rx handle.
+ *  \param[in]  parameter - CANTP_PARAMETER_BS or CANTP_PARAMETER_STMIN.
+ *  \param[out] value - the value of the parameter.
+ *
+ *  \return If the parameter is valid returns ERR_OK, otherwise returns
+ *          ERR_ERROR.
+ *
+ *  \since  V5.2.0
+ *
+ *****************************************************************************/
+UINT8 Cantp_ReadParameter(bl_CanTpHandle_t handle,
+                            UINT8 parameter,
+                            UINT16 *value)
+{
+    const bl_CanTpChannel_t *channel;
+    UINT8 ret = ERR_OK;
+
+    BL_DEBUG_ASSERT_PARAM(handle < CANTP_NUMBER_OF_RX_CHANNEL);
+    BL_DEBUG_ASSERT_PARAM(value != NULL_PTR);
+
+    channel = &gs_CanTpRxChannel[handle];
+
+    if (CANTP_PARAMETER_BS == parameter)
+    {
+        *value = (UINT16)channel->fcBs;
+    }
+    else if (CANTP_PARAMETER_STMIN == parameter)
+    {
+        *value = (UINT16)channel->st;
+    }
+    else
+    {
+        ret = ERR_ERROR;
+    }
+
+    return ret;
+}
+#endif
+
+#if (CANTP_FUN_RESUMABLE_TRANSFER == ON)
+/**************************************************************************//**
+ *
+ *  \details    Get the checkpoint of the last reception of a rx channel
+ *              which is aborted by a wrong SN or the Cr timeout. The data
+ *              before this offset is committed to the upper layer, and the
+ *              rest of the message can be transmitted again from it. The
+ *              offset is from the beginning of the whole message, a
+ *              resumed reception adds the offset set by Cantp_ReceiveFrom.
+ *              The checkpoint is valid until the next FF is received, so it
+ *              shall be gotten when the upper layer is indicated the error.
+ *
+ *  \param[in]  handle - rx handle.
+ *  \param[out] offset - the offset in the whole message of the data not
+ *                       committed to the upper layer.
+ *
+ *  \return If the last reception is aborted returns ERR_OK, otherwise
+ *          returns ERR_ERROR.
+ *
+ *  \since  V5.2.0
+ *
+ *****************************************************************************/
+UINT8 Cantp_GetRxResumeOffset(bl_CanTpHandle_t handle,
+                                bl_BufferSize_t *offset)
+{
+    bl_CanTpChannel_t *channel;
+    UINT8 ret = ERR_ERROR;
+
+    BL_DEBUG_ASSERT_PARAM(handle < CANTP_NUMBER_OF_RX_CHANNEL);
+    BL_DEBUG_ASSERT_PARAM(offset != NULL_PTR);
+
+    channel = &gs_CanTpRxChannel[handle];
+
+    if (channel->resume != FALSE)
+    {
+        *offset = channel->resumeOffset;
+        ret = ERR_OK;
+    }
+
+    return ret;
+}
+
+/**************************************************************************//**
+ *
+ *  \details    Get the checkpoint of the last transmission of a tx channel
+ *              which is aborted. The data before this offset is acknowledged
+ *              by the last CTS of the receiver. The offset is from the
+ *              beginning of the whole message, so it is given to
+ *              Cantp_TransmitFrom as it is, also for a message transmitted
+ *              from an offset.
+ *
+ *  \param[in]  handle - tx handle.
+ *  \param[out] offset - the offset in the whole message of the data not
+ *                       acknowledged by the receiver.
+ *
+ *  \return If the last transmission is aborted returns ERR_OK, otherwise
+ *          returns ERR_ERROR.
+ *
+ *  \since  V5.2.0
+ *
+ *****************************************************************************/
+UINT8 Cantp_GetTxResumeOffset(bl_CanTpHandle_t handle,
+                                bl_BufferSize_t *offset)
+{
+    bl_CanTpChannel_t *channel;
+    UINT8 ret = ERR_ERROR;
+
+    BL_DEBUG_ASSERT_PARAM(handle < CANTP_NUMBER_OF_TX_CHANNEL);
+    BL_DEBUG_ASSERT_PARAM(offset != NULL_PTR);
+
+    channel = &gs_CanTpTxChannel[handle];
+
+    if (channel->resume != FALSE)
+    {
+        *offset = channel->resumeOffset;
+        ret = ERR_OK;
+    }
+
+    return ret;
+}
+
+/**************************************************************************//**
+ *
+ *  \details    Transmit a message from an offset. The upper layer copies the
+ *              message from its beginning as Cantp_Transmit, the data before
+ *              the offset is skipped by the channel and the rest is
+ *              transmitted as a message of (size - offset) bytes. The
+ *              checkpoint of the message is from the beginning of the whole
+ *              message.
+ *
+ *  \param[in]  handle - tx handle.
+ *  \param[in]  size - the size of the whole message.
+ *  \param[in]  offset - the offset of the first transmitted data.
+ *
+ *  \return If the message is accepted returns ERR_OK, otherwise returns
+ *          ERR_ERROR.
+ *
+ *  \since  V5.2.0
+ *
+ *****************************************************************************/
+UINT8 Cantp_TransmitFrom(bl_CanTpHandle_t handle,
+                            bl_BufferSize_t size,
+                            bl_BufferSize_t offset)
+{
+    UINT8 ret = ERR_ERROR;
+#if (CANTP_FUN_TX_REQUEST_QUEUE == ON)
+    bl_CanTpTxRequest_t request;
+#else
+    bl_CanTpChannel_t *channel;
+#endif
+
+    if (offset < size)
+    {
+#if (CANTP_FUN_TX_REQUEST_QUEUE == ON)
+        request.size = (bl_BufferSize_t)(size - offset);
+        request.data = NULL_PTR;
+        request.skipSize = offset;
+        ret = _Cantp_TransmitRequest(handle, &request);
+#else
+        ret = Cantp_Transmit(handle, (bl_BufferSize_t)(size - offset));
+        if (ERR_OK == ret)
+        {
+            channel = _Cantp_GetTxChannel(handle);
+            BL_DEBUG_ASSERT_NO_RET(channel != NULL_PTR);
+
+            channel->skipSize = offset;
+            channel->resumeOffset = offset;
+            channel->resumeBase = offset;
+        }
+#endif
+    }
+
+    return ret;
+}
+
+/**************************************************************************//**
+ *
+ *  \details    Set the offset in the whole message of the next multiple
+ *              frames reception of a rx channel, when the upper layer asks
+ *              the peer to transmit the rest of an aborted message from its
+ *              checkpoint. The offset is used until the reception is
+ *              completed or aborted, so the checkpoint of a resumed
+ *              reception is from the beginning of the whole message too.
+ *
+ *  \param[in]  handle - rx handle.
+ *  \param[in]  offset - the offset of the first received data.
+ *
+ *  \return None.
+ *
+ *  \since  V5.2.0
+ *
+ *****************************************************************************/
+void Cantp_ReceiveFrom(bl_CanTpHandle_t handle,
+                        bl_BufferSize_t offset)
+{
+    BL_DEBUG_ASSERT_NO_RET(handle < CANTP_NUMBER_OF_RX_CHANNEL);
+
+    gs_CanTpRxChannel[handle].resumeBase = offset;
+
+    return ;
+}
+
+/**************************************************************************//**
+ *
+ *  \details    Save the checkpoint of a transfer aborted by a channel. A rx
+ *              channel saves the data committed to the upper layer after its
+ *              base offset, and a tx channel keeps the offset saved by the
+ *              last CTS.
+ *
+ *  \param[in/out]  channel - the pointer of a channel.
+ *
+ *  \return None.
+ *
+ *  \since  V5.2.0
+ *
+ *****************************************************************************/
+static void _Cantp_SaveResumeOffset(bl_CanTpChannel_t *channel)
+{
+    if (CANTP_STATUS_IS_RECVCF(channel))
+    {
+        channel->resumeOffset = channel->resumeBase
+                                + _Cantp_GetCommittedSize(channel);
+        /*The base is used by one reception.*/
+        channel->resumeBase = 0u;
+    }
+
+    channel->resume = TRUE;
+
+    return ;
+}
+
+/**************************************************************************//**
+ *
+ *  \details    Copy the data before the offset of a message from the upper
+ *              layer and drop it, before the first frame is transmitted.
+ *
+ *  \param[in/out]  channel - the pointer of a tx channel.
+ *
+ *  \return If all data is skipped returns ERR_OK, otherwise the data is not
+ *          ready and it is tried again during the next period.
+ *
+ *  \since  V5.2.0
+ *
+ *****************************************************************************/
+static UINT8 _Cantp_SkipTxData(bl_CanTpChannel_t *channel)
+{
+    bl_BufferSize_t dataSize;
+    UINT8 ret = ERR_OK;
+
+    while ((channel->skipSize != 0u) && (ERR_OK == ret))
+    {
+        dataSize = channel->skipSize;
+        /*The frame buffer of a classic channel may be a classic buffer.*/
+        if (dataSize > CANTP_GET_MAX_DL(channel))
+        {
+            dataSize = CANTP_GET_MAX_DL(channel);
+        }
+
+        ret = CANTP_COPY_TX_DATA(channel, dataSize, channel->frame);
+        if (ERR_OK == ret)
+        {
+            channel->skipSize -= dataSize;
+        }
+    }
+
+    return ret;
+}
+#endif
+
+#if (CANTP_FUN_FRAME_POOL == ON)
+/**************************************************************************//**
+ *
+ *  \details    Initialize the pool of the frame buffers, all buffers are
+ *              free.
+ *
+ *  \return None.
+ *
+ *  \since  V5.2.0
+ *
+ *****************************************************************************/
+static void _Cantp_InitFramePool(void)
+{
+    Bl_MemSet(gs_CanTpFrameBufferUsed,
+                FALSE,
+                (UINT16)sizeof(gs_CanTpFrameBufferUsed));
+    Bl_MemSet(gs_CanTpClassicBufferUsed,
+                FALSE,
+                (UINT16)sizeof(gs_CanTpClassicBufferUsed));
+
+    return ;
+}
+
+/**************************************************************************//**
+ *
+ *  \details    Borrow a frame buffer from the pool when a channel leaves the
+ *              idle status. A channel whose frames are not bigger than the
+ *              classic frame borrows a classic buffer firstly.
+ *
+ *  \param[in/out]  channel - the pointer of a channel.
+ *
+ *  \return If the channel has a frame buffer returns ERR_OK, otherwise
+ *          returns ERR_ERROR.
+ *
+ *  \since  V5.2.0
+ *
+ *****************************************************************************/
+static UINT8 _Cantp_GetFrameBuffer(bl_CanTpChannel_t *channel)
+{
+    UINT8 ret = ERR_OK;
+    UINT8 i;
+
+    if (NULL_PTR == channel->frame)
+    {
+        ret = ERR_ERROR;
+
+        CANTP_FRAME_POOL_LOCK();
+        if (CANTP_GET_MAX_DL(channel) <= CANTP_CLASSIC_FRAME_SIZE)
+        {
+            for (i = 0; i < CANTP_NUMBER_OF_CLASSIC_BUFFER; i++)
+            {
+                if (FALSE == gs_CanTpClassicBufferUsed[i])
+                {
+                    gs_CanTpClassicBufferUsed[i] = TRUE;
+                    channel->frame = gs_CanTpClassicBuffer[i];
+                    channel->frameBuffer = (UINT8)(i | CANTP_FRAME_BUFFER_CLASSIC);
+                    ret = ERR_OK;
+                    break;
+                }
+            }
+        }
+
+        for (i = 0; (ERR_OK != ret) && (i < CANTP_NUMBER_OF_FRAME_BUFFER); i++)
+        {
+            if (FALSE == gs_CanTpFrameBufferUsed[i])
+            {
+                gs_CanTpFrameBufferUsed[i] = TRUE;
+                channel->frame = gs_CanTpFrameBuffer[i];
+                channel->frameBuffer = i;
+                ret = ERR_OK;
+            }
+        }
+        CANTP_FRAME_POOL_UNLOCK();
+    }
+
+    return ret;
+}
+
+/**************************************************************************//**
+ *
+ *  \details    Give back the frame buffer of a channel to the pool when the
+ *              channel goes to the idle status.
+ *
+ *  \param[in/out]  channel - the pointer of a channel.
+ *
+ *  \return None.
+ *
+ *  \since  V5.2.0
+ *
+ *****************************************************************************/
+static void _Cantp_FreeFrameBuffer(bl_CanTpChannel_t *channel)
+{
+    UINT8 index = channel->frameBuffer;
+
+    if (index != CANTP_FRAME_BUFFER_NONE)
+    {
+        channel->frame = NULL_PTR;
+        channel->frameBuffer = CANTP_FRAME_BUFFER_NONE;
+
+        CANTP_FRAME_POOL_LOCK();
+        if ((index & CANTP_FRAME_BUFFER_CLASSIC) != 0u)
+        {
+            gs_CanTpClassicBufferUsed[index & (~CANTP_FRAME_BUFFER_CLASSIC)]
+                = FALSE;
+        }
+        else
+        {
+            gs_CanTpFrameBufferUsed[index] = FALSE;
+        }
+        CANTP_FRAME_POOL_UNLOCK();
+    }
+
+    return ;
+}
+#endif
+
+#if (CANTP_FUN_WARM_HANDOVER == ON)
+/**************************************************************************//**
+ *
+ *  \details    Save a pending request received by a rx channel in the record
+ *              of the warm handover, before the application resets into the
+ *              bootloader. The request shall fit in a classic SF.
+ *
+ *  \param[in]  handle - rx handle receiving the request.
+ *  \param[in]  size - the size of the request.
+ *  \param[in]  buffer - the request.
+ *
+ *  \return If the record is saved returns ERR_OK, otherwise returns
+ *          ERR_ERROR.
+ *
+ *  \since  V5.2.0
+ *
+ *****************************************************************************/
+UINT8 Cantp_SaveHandover(bl_CanTpHandle_t handle,
+                            bl_BufferSize_t size,
+                            const bl_Buffer_t *buffer)
+{
+    bl_CanTpHandover_t *record = CANTP_HANDOVER_RECORD;
+    const bl_CanTpChannel_t *channel;
+    const bl_CanTpChannel_t *txChannel;
+    const bl_CanTpPciInfo_t *pci;
+    UINT32 id;
+
+    BL_DEBUG_ASSERT_PARAM(handle < CANTP_NUMBER_OF_RX_CHANNEL);
+    BL_DEBUG_ASSERT_PARAM(buffer != NULL_PTR);
+
+    channel = &gs_CanTpRxChannel[handle];
+    pci = _Cantp_GetPciInfo(channel->chnCfg->type, CANTP_CLASSIC_FRAME_SIZE);
+    id = channel->chnCfg->rxId;
+
+    if ((0u == size) || (size > pci->maxSFDataSize))
+    {
+        return ERR_ERROR;
+    }
+
+#if (CANTP_FUN_FIXED_ADDRESSING == ON)
+    if (CANTP_IS_FIXED_TYPE(channel->chnCfg->type))
+    {
+        if (CANTP_FIXED_PEER_NONE == gs_CanTpFixedPeer)
+        {
+            return ERR_ERROR;
+        }
+        /*The template receives the requests of all peers.*/
+        id |= (UINT32)gs_CanTpFixedPeer;
+    }
+#endif
+
+    Bl_MemSet(record->frame,
+                CANTP_FRAME_PADDING_VALUE,
+                (UINT16)CANTP_CLASSIC_FRAME_SIZE);
+    if (!CANTP_IS_STANDARD_CHANNEL(channel))
+    {
+        record->frame[CANTP_TA_OFFSET] = channel->chnCfg->ta;
+    }
+    record->frame[CANTP_PCI_POS(pci)] = (bl_Buffer_t)size;
+    FblMemCpy(&record->frame[CANTP_DATA_POS(pci)], buffer, (UINT16)size);
+
+    record->id = id;
+    record->ctrl = channel->chnCfg->ctrl;
+    record->st = channel->chnCfg->st;
+    txChannel = _Cantp_GetTxChannelById(record->ctrl, id);
+    if (txChannel != NULL_PTR)
+    {
+        record->st = txChannel->st;
+    }
+
+    record->checksum = _Cantp_GetHandoverChecksum(record);
+    record->magic = CANTP_HANDOVER_MAGIC;
+
+    return ERR_OK;
+}
+
+/**************************************************************************//**
+ *
+ *  \details    Restore the record of the warm handover after the channels
+ *              are initialized. The SF of the pending request is received
+ *              again, and it is given to the upper layer by the first
+ *              period. The record is used only once.
+ *
+ *  \return None.
+ *
+ *  \since  V5.2.0
+ *
+ *****************************************************************************/
+static void _Cantp_RestoreHandover(void)
+{
+    bl_CanTpHandover_t *record = CANTP_HANDOVER_RECORD;
+    bl_CanTpChannel_t *txChannel;
+
+    if ((CANTP_HANDOVER_MAGIC == record->magic)
+        && (_Cantp_GetHandoverChecksum(record) == record->checksum))
+    {
+        txChannel = _Cantp_GetTxChannelById(record->ctrl, record->id);
+        if (txChannel != NULL_PTR)
+        {
+            /*The STmin of the peer until its next FC.*/
+            txChannel->st = record->st;
+        }
+
+        Cantp_CtrlRxIndication(record->ctrl,
+                                record->id,
+                                CANTP_CLASSIC_FRAME_SIZE,
+                                record->frame);
+    }
+
+    record->magic = 0uL;
+
+    return ;
+}
+
+/**************************************************************************//**
+ *
+ *  \details    Calculate the checksum of the record of the warm handover, it
+ *              is the complement of the sum of the bytes except the magic
+ *              and the checksum.
+ *
+ *  \param[in]  record - the record of the handover.
+ *
+ *  \return the checksum.
+ *
+ *  \since  V5.2.0
+ *
+ *****************************************************************************/
+static UINT16 _Cantp_GetHandoverChecksum(const bl_CanTpHandover_t *record)
+{
+    UINT16 sum;
+    UINT8 i;
+
+    sum = (UINT16)(record->id >> 16) + (UINT16)record->id;
+    sum += (UINT16)record->ctrl + (UINT16)record->st;
+    for (i = 0; i < CANTP_CLASSIC_FRAME_SIZE; i++)
+    {
+        sum += (UINT16)record->frame[i];
+    }
+
+    return (UINT16)(~sum);
+}
+#endif
+
+/**************************************************************************//**
+ *
+ *  \details Initialize the channel of the cantp module.
+ *
+ *  \param[in]  channel     - the pointer of a cantp channel.
+ *  \param[in]  channelCfg  - the pointer of a cantp channel cfg in ROM.
+ *
+ *  \note   The slot of the channel shall be set before, if the status and
+ *          the timer are in the dense arrays.
+ *
+ *  \return None.
+ *
+ *  \since  V2.0.0
+ *
+ *****************************************************************************/
+static void _Cantp_InitChannel(bl_CanTpChannel_t *channel,
+                                const bl_CanTpChannelCfg_t *channelCfg)
+{
+    BL_DEBUG_ASSERT_NO_RET(channel != NULL_PTR);
+    BL_DEBUG_ASSERT_NO_RET(channelCfg != NULL_PTR);
+#if (CANTP_FUN_STATIC_PCI_LAYOUT == ON)
+    /*The channel shall use the PCI layout of the build.*/
+    BL_DEBUG_ASSERT_NO_RET((CANTP_STATIC_PCI_LAYOUT == CANTP_STANDARD_PCI_LAYOUT)
+                            == (CANTP_IS_STANDARD_TYPE(channelCfg->type)));
+#endif
+    
+    CANTP_STATUS_GOTO_IDLE(channel);
+    CANTP_SUB_STATUS_GOTO_IDLE(channel);
+
+    CANTP_INIT_STMIN_BY_CFG(channel, channelCfg);
+    CANTP_INIT_BS_BY_CFG(channel, channelCfg);
+    CANTP_INIT_MAXWFT_BY_CFG(channel, channelCfg);
+    CANTP_INIT_TATYPE_BY_CFG(channel, channelCfg);
+#if (CANTP_FUN_CHANGE_PARAMETER == ON)
+    channel->fcBs = channelCfg->bs;
+#endif
+
+    CANTP_INIT_TIMER(channel);
+
+#if (CANTP_FUN_FRAME_POOL == ON)
+    channel->frame = NULL_PTR;
+    channel->frameBuffer = CANTP_FRAME_BUFFER_NONE;
+#endif
+
+#if (CANTP_FUN_RESUMABLE_TRANSFER == ON)
+    channel->resume = FALSE;
+    channel->resumeOffset = 0u;
+    channel->resumeBase = 0u;
+    channel->skipSize = 0u;
+#endif
+#if (CANTP_FUN_TX_REQUEST_QUEUE == ON)
+    channel->txData = NULL_PTR;
+    channel->txqHead = 0u;
+    channel->txqTail = 0u;
+#endif
+
+    /*The rx channels and the tx channels of CANTP_TX_DL_AUTO start with
+      the classic frames.*/
+    channel->pciInfo = _Cantp_GetPciInfo(channelCfg->type, channelCfg->txDl);
+    CANTP_SET_CHANNEL_DL(channel,channel->pciInfo->frameSize);
+
+    channel->chnCfg = channelCfg;
+#if (CANTP_FUN_CHANNEL_SOA == ON)
+    gs_CanTpChannelRxId[channel->slot] = channelCfg->rxId;
+#endif
+    return ;
+}
+
+/**************************************************************************//**
+ *
+ *  \details Get the PCI used by a channel type for the frames of a size. It
+ *           is used to select the TX_DL of a tx channel and to detect the
+ *           RX_DL from the size of a received SF or FF frame.
+ *
+ *  \param[in]  type      - the type of a cantp channel.
+ *  \param[in]  frameSize - the size of the frames.
+ *
+ *  \return the pointer of the PCI.
+ *
+ *  \since  V5.2.0
+ *
+ *****************************************************************************/
+static const bl_CanTpPciInfo_t *_Cantp_GetPciInfo(UINT8 type,
+                                                bl_BufferSize_t frameSize)
+{
+    UINT8 layout = CANTP_EXTENDED_PCI_LAYOUT;
+    UINT8 info = CANTP_CLASSIC_PCI_INFO;
+
+    if (CANTP_IS_STANDARD_TYPE(type))
+    {
+        layout = CANTP_STANDARD_PCI_LAYOUT;
+    }
+#if ((ENABLE_CANFD == OFF) && (ENABLE_CANXL == OFF))
+    (void)frameSize;
+#endif
+#if ((ENABLE_CANFD == ON) || (ENABLE_CANXL == ON))
+    if (frameSize > CANTP_CLASSIC_FRAME_SIZE)
+    {
+        info = CANTP_CANFD_PCI_INFO;
+    }
+#endif
+#if (ENABLE_CANXL == ON)
+    if (frameSize > CANTP_CANFD_FRAME_SIZE)
+    {
+        info = CANTP_CANXL_PCI_INFO;
+    }
+#endif
+
+    return &gs_CanTpPciInfo[layout][info];
+}
+
+/**************************************************************************//**
+ *
+ *  \details Get the cantp channel by the receiving handle.
+ *
+ *  \param[in]  ctrl    - the CAN controller of the receiving handle.
+ *  \param[in]  handle  - the receiving handle of the canif moudle.
+ *  \param[in]  chnNum  - the number of channels.
+ *  \param[in]  chnList - the channels
+ *
+ *  \return If the rxId of a channel equal to the handle then return a pointer
+ *          of the channel, otherwise returns NULL_PTR.
+ *
+ *  \since  V2.0.0
+ *
+ *****************************************************************************/
+static bl_CanTpChannel_t * _Cantp_GetChannelByRxId(UINT8 ctrl,
+                                                    UINT32 id,
+                                                    UINT16 chnNum,
+                                                    bl_CanTpChannel_t *chnList)
+{
+    bl_CanTpChannel_t *channel = NULL_PTR;
+    UINT16 i;
+#if (CANTP_FUN_CHANNEL_SOA == ON)
+    const UINT32 *rxId;
+
+    if (0u == chnNum)
+    {
+        return NULL_PTR;
+    }
+
+    /*Only the channel of a matched id is loaded to check the controller.*/
+    rxId = &gs_CanTpChannelRxId[chnList[0].slot];
+    for (i = 0; i < chnNum; i++)
+    {
+        if ((rxId[i] == id)
+            && (chnList[i].chnCfg->ctrl == ctrl))
+        {
+            channel = &chnList[i];
+            break;
+        }
+    }
+#else
+    for (i = 0; i < chnNum; i++)
+    {
+        if ((chnList[i].chnCfg->rxId == id)
+            && (chnList[i].chnCfg->ctrl == ctrl))
+        {
+            channel = &chnList[i];
+            break;
+        }
+    }
+#endif
+
+    return channel;
+}
+
+/**************************************************************************//**
+ *
+ *  \details Get the tx channel which may receive a FC frame of an id.
+ *
+ *  \param[in]  ctrl - the CAN controller receiving the frame.
+ *  \param[in]  id   - the id of the frame.
+ *
+ *  \return the pointer of the tx channel, or NULL_PTR.
+ *
+ *  \since  V5.2.0
+ *
+ *****************************************************************************/
+static bl_CanTpChannel_t *_Cantp_GetTxChannelById(UINT8 ctrl, UINT32 id)
+{
+#if (CANTP_FUN_FIXED_ADDRESSING == ON)
+    return _Cantp_GetFixedTxChannel(ctrl, id);
+#else
+    return _Cantp_GetChannelByRxId(ctrl,
+                                    id,
+                                    CANTP_NUMBER_OF_TX_CHANNEL,
+                                    gs_CanTpTxChannel);
+#endif
+}
+
+/**************************************************************************//**
+ *
+ *  \details Get the rx channel which may receive the frames of an id.
+ *
+ *  \param[in]  ctrl - the CAN controller receiving the frame.
+ *  \param[in]  id   - the id of the frame.
+ *
+ *  \return the pointer of the rx channel, or NULL_PTR.
+ *
+ *  \since  V5.2.0
+ *
+ *****************************************************************************/
+static bl_CanTpChannel_t *_Cantp_GetRxChannelById(UINT8 ctrl, UINT32 id)
+{
+#if (CANTP_FUN_FIXED_ADDRESSING == ON)
+    return _Cantp_GetFixedRxChannel(ctrl, id);
+#else
+    return _Cantp_GetChannelByRxId(ctrl,
+                                    id,
+                                    CANTP_NUMBER_OF_RX_CHANNEL,
+                                    gs_CanTpRxChannel);
+#endif
+}
+
+#if (CANTP_FUN_FIXED_ADDRESSING == ON)
+/**************************************************************************//**
+ *
+ *  \details Initialize the pool of the fixed addressing, no peer uses a slot.
+ *
+ *  \return None.
+ *
+ *  \since  V5.2.0
+ *
+ *****************************************************************************/
+static void _Cantp_InitPool(void)
+{
+    UINT16 i;
+
+    for (i = 0; i < CANTP_NUMBER_OF_POOL_CHANNEL; i++)
+    {
+        gs_CanTpPoolSlot[i].used = FALSE;
+        gs_CanTpPoolSlot[i].rxTmpl = NULL_PTR;
+#if (CANTP_FUN_CHANNEL_SOA == ON)
+        gs_CanTpPoolRxChannel[i].slot = (UINT16)(CANTP_POOL_RX_CHANNEL_SLOT
+                                                    + i);
+        gs_CanTpPoolTxChannel[i].slot = (UINT16)(CANTP_POOL_TX_CHANNEL_SLOT
+                                                    + i);
+#endif
+        _Cantp_InitChannel(&gs_CanTpPoolRxChannel[i],
+                            &gs_CanTpPoolSlot[i].rxCfg);
+        _Cantp_InitChannel(&gs_CanTpPoolTxChannel[i],
+                            &gs_CanTpPoolSlot[i].txCfg);
+    }
+
+    for (i = 0; i < CANTP_NUMBER_OF_ADDRESS; i++)
+    {
+        gs_CanTpPoolMap[i] = CANTP_POOL_NONE;
+    }
+
+    gs_CanTpPoolNext = 0u;
+    gs_CanTpFixedPeer = CANTP_FIXED_PEER_NONE;
+
+    return ;
+}
+
+/**************************************************************************//**
+ *
+ *  \details Get the slot of the pool used by a peer. If the peer has no slot,
+ *           a free or idle slot is given to it, and its rx and tx channels
+ *           are created from the templates, the SA of the peer is put in
+ *           the ids of the templates.
+ *
+ *  \param[in]  rxTmpl - the rx template channel receiving the requests.
+ *  \param[in]  txTmpl - the tx template channel transmitting the responses.
+ *  \param[in]  sa     - the SA of the peer.
+ *
+ *  \return the index of the slot, or CANTP_POOL_NONE if all slots are busy.
+ *
+ *  \since  V5.2.0
+ *
+ *****************************************************************************/
+static UINT8 _Cantp_GetPoolSlot(const bl_CanTpChannel_t *rxTmpl,
+                                const bl_CanTpChannel_t *txTmpl,
+                                UINT8 sa)
+{
+    bl_CanTpPoolSlot_t *slot;
+    bl_CanTpChannel_t *rxChannel;
+    bl_CanTpChannel_t *txChannel;
+    UINT8 index = gs_CanTpPoolMap[sa];
+    UINT16 i;
+
+    if (index != CANTP_POOL_NONE)
+    {
+        if (gs_CanTpPoolSlot[index].rxTmpl == rxTmpl)
+        {
+            return index;
+        }
+
+        /*The peer uses other templates, create its channels again.*/
+        if (CANTP_STATUS_IS_NOT_IDLE(&gs_CanTpPoolRxChannel[index])
+            || CANTP_STATUS_IS_NOT_IDLE(&gs_CanTpPoolTxChannel[index]))
+        {
+            return CANTP_POOL_NONE;
+        }
+    }
+    else
+    {
+        for (i = 0; i < CANTP_NUMBER_OF_POOL_CHANNEL; i++)
+        {
+            index = gs_CanTpPoolNext;
+            gs_CanTpPoolNext = (UINT8)((gs_CanTpPoolNext + 1u)
+                                        % CANTP_NUMBER_OF_POOL_CHANNEL);
+
+            if ((FALSE == gs_CanTpPoolSlot[index].used)
+                || (CANTP_STATUS_IS_IDLE(&gs_CanTpPoolRxChannel[index])
+                    && CANTP_STATUS_IS_IDLE(&gs_CanTpPoolTxChannel[index])))
+            {
+                break;
+            }
+
+            index = CANTP_POOL_NONE;
+        }
+
+        if (CANTP_POOL_NONE == index)
+        {
+            return CANTP_POOL_NONE;
+        }
+
+        if (gs_CanTpPoolSlot[index].used != FALSE)
+        {
+            gs_CanTpPoolMap[gs_CanTpPoolSlot[index].sa] = CANTP_POOL_NONE;
+        }
+    }
+
+    slot = &gs_CanTpPoolSlot[index];
+    slot->used = TRUE;
+    slot->sa = sa;
+    slot->rxTmpl = rxTmpl;
+
+    /*The TA of a received id is the ECU and the SA is the peer, they are
+      exchanged in a transmitted id.*/
+    slot->rxCfg = *(rxTmpl->chnCfg);
+    slot->rxCfg.rxId |= (UINT32)sa;
+    slot->rxCfg.txId |= ((UINT32)sa << 8);
+    slot->txCfg = *(txTmpl->chnCfg);
+    slot->txCfg.rxId |= (UINT32)sa;
+    slot->txCfg.txId |= ((UINT32)sa << 8);
+
+    rxChannel = &gs_CanTpPoolRxChannel[index];
+    txChannel = &gs_CanTpPoolTxChannel[index];
+    _Cantp_InitChannel(rxChannel, &slot->rxCfg);
+    _Cantp_InitChannel(txChannel, &slot->txCfg);
+#if (CANTP_FUN_RX_SF_QUEUE == ON)
+    /*The SFs of the last peer of the slot are dropped.*/
+    _Cantp_DropQueuedSF(rxChannel);
+#endif
+    rxChannel->handle = rxTmpl->handle;
+    rxChannel->sa = sa;
+#if (CANTP_FUN_CHANGE_PARAMETER == ON)
+    /*The FC parameters changed on the template are used by the peer.*/
+    rxChannel->fcBs = rxTmpl->fcBs;
+    rxChannel->st = rxTmpl->st;
+#endif
+    txChannel->handle = txTmpl->handle;
+    txChannel->sa = sa;
+#if(CANTP_COMMUNICATION_DUPLEX == CANTP_HALF_DUPLEX)
+    rxChannel->pair = txChannel;
+    txChannel->pair = rxChannel;
+#endif
+
+    gs_CanTpPoolMap[sa] = index;
+
+    return index;
+}
+
+/**************************************************************************//**
+ *
+ *  \details Check if a peer other than the SA is served by the channels of a
+ *           template, i.e. its request is being received or its response
+ *           is being transmitted. The upper layer has one buffer for the
+ *           requests of a template, so the peers are served one by one.
+ *
+ *  \param[in]  rxTmpl - the rx template channel.
+ *  \param[in]  sa     - the SA of the peer.
+ *
+ *  \return TRUE or FALSE.
+ *
+ *  \since  V5.2.0
+ *
+ *****************************************************************************/
+static UINT8 _Cantp_IsOtherPeerBusy(const bl_CanTpChannel_t *rxTmpl, UINT8 sa)
+{
+    UINT8 busy = FALSE;
+    UINT16 i;
+
+    for (i = 0; (i < CANTP_NUMBER_OF_POOL_CHANNEL) && (FALSE == busy); i++)
+    {
+        if ((gs_CanTpPoolSlot[i].used != FALSE)
+            && (gs_CanTpPoolSlot[i].rxTmpl == rxTmpl)
+            && (gs_CanTpPoolSlot[i].sa != sa)
+            && (CANTP_STATUS_IS_NOT_IDLE(&gs_CanTpPoolRxChannel[i])
+                || CANTP_STATUS_IS_NOT_IDLE(&gs_CanTpPoolTxChannel[i])))
+        {
+            busy = TRUE;
+        }
+    }
+
+    return busy;
+}
+
+/**************************************************************************//**
+ *
+ *  \details Get the rx channel receiving a frame. If the 29-bit id matches a
+ *           template of the fixed addressing without the SA, a functional
+ *           frame is received by the template and a physical frame is
+ *           received by the channel of the peer in the pool. Otherwise the
+ *           channel is searched by the id. The frames of a peer are ignored
+ *           while other peer is served by the template.
+ *
+ *  \param[in]  ctrl - the CAN controller receiving the frame.
+ *  \param[in]  id   - the id of the frame.
+ *
+ *  \return the pointer of the rx channel, or NULL_PTR.
+ *
+ *  \since  V5.2.0
+ *
+ *****************************************************************************/
+static bl_CanTpChannel_t *_Cantp_GetFixedRxChannel(UINT8 ctrl, UINT32 id)
+{
+    bl_CanTpChannel_t *tmpl = NULL_PTR;
+    bl_CanTpChannel_t *txTmpl;
+    bl_CanTpChannel_t *channel;
+    UINT8 sa = CANTP_GET_ID_SA(id);
+    UINT8 index;
+
+    if ((id & CANTP_ID_EXTENDED) != 0u)
+    {
+        tmpl = _Cantp_GetChannelByRxId(ctrl,
+                                        id & (~CANTP_FIXED_ID_SA_MASK),
+                                        CANTP_NUMBER_OF_RX_CHANNEL,
+                                        gs_CanTpRxChannel);
+    }
+
+    if ((tmpl != NULL_PTR) && (CANTP_IS_FIXED_TYPE(tmpl->chnCfg->type)))
+    {
+        channel = NULL_PTR;
+
+        if (CANTP_IS_FUNCTIONAL_CHANNEL(tmpl))
+        {
+            /*The SA is kept until the request is given to the upper layer.*/
+            if (CANTP_STATUS_IS_IDLE(tmpl) || (tmpl->sa == sa))
+            {
+                tmpl->sa = sa;
+                channel = tmpl;
+            }
+        }
+        else
+        {
+            /*The template of the responses uses the same rx id.*/
+            txTmpl = _Cantp_GetChannelByRxId(ctrl,
+                                            tmpl->chnCfg->rxId,
+                                            CANTP_NUMBER_OF_TX_CHANNEL,
+                                            gs_CanTpTxChannel);
+            if ((txTmpl != NULL_PTR)
+                && (FALSE == _Cantp_IsOtherPeerBusy(tmpl, sa)))
+            {
+                index = _Cantp_GetPoolSlot(tmpl, txTmpl, sa);
+                if (index != CANTP_POOL_NONE)
+                {
+                    channel = &gs_CanTpPoolRxChannel[index];
+                }
+            }
+        }
+    }
+    else
+    {
+        channel = _Cantp_GetChannelByRxId(ctrl,
+                                            id,
+                                            CANTP_NUMBER_OF_RX_CHANNEL,
+                                            gs_CanTpRxChannel);
+    }
+
+    return channel;
+}
+
+/**************************************************************************//**
+ *
+ *  \details Get the tx channel receiving a FC frame. The slot of the SA in
+ *           the id is checked firstly, then the channel is searched by the
+ *           id. A slot is never created by a FC frame.
+ *
+ *  \param[in]  ctrl - the CAN controller receiving the frame.
+ *  \param[in]  id   - the id of the frame.
+ *
+ *  \return the pointer of the tx channel, or NULL_PTR.
+ *
+ *  \since  V5.2.0
+ *
+ *****************************************************************************/
+static bl_CanTpChannel_t *_Cantp_GetFixedTxChannel(UINT8 ctrl, UINT32 id)
+{
+    bl_CanTpChannel_t *channel = NULL_PTR;
+    UINT8 index;
+
+    if ((id & CANTP_ID_EXTENDED) != 0u)
+    {
+        index = gs_CanTpPoolMap[CANTP_GET_ID_SA(id)];
+        if ((index != CANTP_POOL_NONE)
+            && (gs_CanTpPoolSlot[index].txCfg.rxId == id)
+            && (gs_CanTpPoolSlot[index].txCfg.ctrl == ctrl))
+        {
+            channel = &gs_CanTpPoolTxChannel[index];
+        }
+    }
+
+    if (NULL_PTR == channel)
+    {
+        channel = _Cantp_GetChannelByRxId(ctrl,
+                                            id,
+                                            CANTP_NUMBER_OF_TX_CHANNEL,
+                                            gs_CanTpTxChannel);
+    }
+
+    return channel;
+}
+
+/**************************************************************************//**
+ *
+ *  \details Get the tx channel of the pool transmitting to the peer of the
+ *           last request. The slot is created if the peer only sent the
+ *           functional requests.
+ *
+ *  \param[in]  txTmpl - the tx template channel.
+ *
+ *  \return the pointer of the tx channel, or NULL_PTR.
+ *
+ *  \since  V5.2.0
+ *
+ *****************************************************************************/
+static bl_CanTpChannel_t *_Cantp_GetFixedPeerChannel(bl_CanTpChannel_t *txTmpl)
+{
+    bl_CanTpChannel_t *channel = NULL_PTR;
+    bl_CanTpChannel_t *rxTmpl;
+    UINT8 index;
+
+    if (gs_CanTpFixedPeer != CANTP_FIXED_PEER_NONE)
+    {
+        rxTmpl = _Cantp_GetChannelByRxId(txTmpl->chnCfg->ctrl,
+                                            txTmpl->chnCfg->rxId,
+                                            CANTP_NUMBER_OF_RX_CHANNEL,
+                                            gs_CanTpRxChannel);
+        if (rxTmpl != NULL_PTR)
+        {
+            index = _Cantp_GetPoolSlot(rxTmpl,
+                                        txTmpl,
+                                        (UINT8)gs_CanTpFixedPeer);
+            if (index != CANTP_POOL_NONE)
+            {
+                channel = &gs_CanTpPoolTxChannel[index];
+            }
+        }
+    }
+
+    return channel;
+}
+
+/**************************************************************************//**
+ *
+ *  \details Save the SA of a request received successfully by a channel of
+ *           the fixed addressing, the response is transmitted to it.
+ *
+ *  \param[in]  channel - the pointer of a rx channel.
+ *  \param[in]  result  - the result of the reception.
+ *
+ *  \return None.
+ *
+ *  \since  V5.2.0
+ *
+ *****************************************************************************/
+static void _Cantp_SetFixedPeer(const bl_CanTpChannel_t *channel,
+                                bl_CanTpResult_t result)
+{
+    if ((ERR_OK == result)
+        && (CANTP_IS_FIXED_TYPE(channel->chnCfg->type)))
+    {
+        gs_CanTpFixedPeer = channel->sa;
+    }
+
+    return ;
+}
+#endif
+
+/**************************************************************************//**
+ *
+ *  \details calculate the CF count and the size of last CF by the total size
+ *           of transmitting or receiving data.
+ *
+ *  \param[in]  channel - the pointer of a cantp channel.
+ *  \param[in]  size    - the total size of transmitting or receiving data.
+ *
+ *  \return None.
+ *
+ *  \since  V5.1.0
+ *
+ *****************************************************************************/
+static void _Cantp_SetMultipleFrameSize(bl_CanTpChannel_t *channel,
+                                        bl_BufferSize_t size)
+{
+    bl_BufferSize_t tmpSize;
+    bl_BufferSize_t cfDataSize;
+    UINT16 tmpCnt;
+    const bl_CanTpPciInfo_t *pci = CANTP_CHANNEL_PCI(channel);
+
+    tmpSize = CANTP_GET_FF_DATA_SIZE(pci,CANTP_CHANNEL_DL(channel),size);
+    cfDataSize = CANTP_CHANNEL_CF_DATA_SIZE(channel);
+
+    BL_DEBUG_ASSERT_NO_RET(size > tmpSize);
+    BL_DEBUG_ASSERT_NO_RET(cfDataSize != 0);
+
+    /*The data after the FF is transmitted by the CF.*/
+    tmpSize = size - tmpSize;
+
+    tmpCnt = (UINT16)(((tmpSize - 1u) / cfDataSize) + 1u);
+
+    tmpSize -= (bl_BufferSize_t)(tmpCnt - 1u) * cfDataSize;
+
+    CANTP_SET_TOTAL_SIZE(channel,size);
+    CANTP_SET_LAST_SIZE(channel,tmpSize);
+    CANTP_SET_CFCNT(channel,tmpCnt);
+
+    return ;
+}
+
+#if (CANTP_FUN_INLINE_FLOW_CONTROL == ON)
+/**************************************************************************//**
+ *
+ *  \details    Run the RecvFF and TranFC period functions of a rx channel in
+ *              the context of the received frame, so the FC is transmitted
+ *              without waiting for the next periods. If the buffer is busy
+ *              or the frame is not granted, the periods retry as before.
+ *
+ *  \param[in/out]  channel - the pointer of a rx channel.
+ *
+ *  \return None.
+ *
+ *  \since  V5.2.0
+ *
+ *****************************************************************************/
+static void _Cantp_InlineFlowControl(bl_CanTpChannel_t *channel)
+{
+    if (CANTP_STATUS_IS_RECVFF(channel))
+    {
+        _Cantp_PeriodRecvFF(channel);
+    }
+
+    if ((CANTP_STATUS_IS_TRANFC(channel))
+        && (CANTP_SUB_STATUS_IS_IDLE(channel)))
+    {
+        _Cantp_PeriodTranFC(channel);
+    }
+
+    return ;
+}
+#endif
+
+#if (CANTP_FUN_RX_QUEUE == ON)
+/**************************************************************************//**
+ *
+ *  \details    Process the frames in the rx queue as a batch, the task is the
+ *              only consumer of the queue. At most CANTP_RX_QUEUE_BUDGET
+ *              frames are processed at once, the task is notified again if
+ *              frames are left.
+ *
+ *  \return None.
+ *
+ *  \since  V5.2.0
+ *
+ *****************************************************************************/
+static void _Cantp_DrainRxQueue(void)
+{
+    bl_CanTpFrame_t frames[CANTP_RX_QUEUE_BUDGET];
+    const bl_CanTpQueuedFrame_t *entry;
+    UINT16 tail = gs_CanTpRxQueueTail;
+    UINT16 count = (UINT16)(gs_CanTpRxQueueHead - tail);
+    UINT16 i;
+
+    if (count > CANTP_RX_QUEUE_BUDGET)
+    {
+        count = CANTP_RX_QUEUE_BUDGET;
+        CANTP_RX_QUEUE_NOTIFY();
+    }
+
+    /*The frames shall be read after the head is read.*/
+    CANTP_RX_QUEUE_BARRIER();
+
+    for (i = 0; i < count; i++)
+    {
+        entry = &gs_CanTpRxQueue[(UINT16)(tail + i) & CANTP_RX_QUEUE_MASK];
+        frames[i].ctrl = entry->ctrl;
+        frames[i].id = entry->id;
+        frames[i].size = entry->size;
+        frames[i].buffer = entry->data;
+    }
+
+    Cantp_RxIndicationBatch(frames, count);
+
+    /*The entries are released to the ISR after they are processed.*/
+    CANTP_RX_QUEUE_BARRIER();
+    gs_CanTpRxQueueTail = (UINT16)(tail + count);
+
+    return ;
+}
+#endif
+
+#if (CANTP_FUN_RX_BLOCK_HOLD == ON)
+/**************************************************************************//**
+ *
+ *  \details    Calculate the size of the data which is received in the next
+ *              block of a rx channel.
+ *
+ *  \param[in]  channel - the pointer of a rx channel.
+ *
+ *  \return the size of the data in the next block.
+ *
+ *  \since  V5.2.0
+ *
+ *****************************************************************************/
+static bl_BufferSize_t _Cantp_GetBlockSize(const bl_CanTpChannel_t *channel)
+{
+    bl_BufferSize_t remain = 0u;
+    bl_BufferSize_t blockSize;
+
+    if (channel->cfCnt != 0)
+    {
+        remain = ((bl_BufferSize_t)(channel->cfCnt - 1u)
+                    * CANTP_CHANNEL_CF_DATA_SIZE(channel))
+                    + (bl_BufferSize_t)channel->lastSize;
+    }
+
+    blockSize = remain;
+    if (channel->bs != 0)
+    {
+        blockSize = (bl_BufferSize_t)channel->bs
+                        * CANTP_CHANNEL_CF_DATA_SIZE(channel);
+        if (blockSize > remain)
+        {
+            blockSize = remain;
+        }
+    }
+
+    return blockSize;
+}
+#endif
+
+/**************************************************************************//**
+ *
+ *  \details    Calculate the STmin according to ISO 15765-2
+ *
+ *  \param[in]  st - The STmin is received from the tester.
+ *
+ *  \return the STmin used by cantp channel.
+ *
+ *  \since  V5.1.0
+ *
+ *****************************************************************************/
+static UINT8 _Cantp_GetSTMinFromFC(UINT8 st)
+{
+    UINT8 retSTMin;
+
+    if (st > CANTP_MAX_STMIN_VALUE)
+    {
+        if ((st > CANTP_MIN_STMIN_VALUE_US) && (st < CANTP_MAX_STMIN_VALUE_US))
+        {
+            retSTMin = CANTP_SCHEDULE_PERIOD;
+        }
+        else
+        {
+#if (CANTP_SCHEDULE_PERIOD == 1)
+            retSTMin = CANTP_MAX_STMIN_VALUE;
+#else
+            retSTMin = (CANTP_MAX_STMIN_VALUE / CANTP_SCHEDULE_PERIOD) + 1;
+#endif
+        }
+
+    }
+    else
+    {
+#if (CANTP_SCHEDULE_PERIOD == 1)
+        retSTMin = st + 1;
+#else
+        retSTMin = (st / CANTP_SCHEDULE_PERIOD) + 1;
+#endif
+
+    }
+
+    return retSTMin;
+}
+
+/**************************************************************************//**
+ *
+ *  \details    Pad a frame according to ISO 15765-2 and get the size of the
+ *              frame on the bus. A frame not bigger than a classic frame is
+ *              padded to 8 bytes, a CANFD frame is padded to the next valid
+ *              DLC and a CANXL frame bigger than 64 bytes is sent as it is.
+ *
+ *  \param[in/out]  frame - the frame.
+ *  \param[in]      size - the size of the PCI and the data in the frame.
+ *
+ *  \return the size of the frame on the bus.
+ *
+ *  \since  V5.2.0
+ *
+ *****************************************************************************/
+static bl_BufferSize_t _Cantp_PadFrame(bl_Buffer_t *frame,
+                                        bl_BufferSize_t size)
+{
+    bl_BufferSize_t frameSize = size;
+#if ((CANTP_FUN_TX_FRAME_PADDING == ON) \
+    && (CANTP_MAX_FRAME_SIZE > CANTP_CLASSIC_FRAME_SIZE))
+    UINT8 i;
+#endif
+
+#if (CANTP_FUN_TX_FRAME_PADDING == ON)
+    if (size <= CANTP_CLASSIC_FRAME_SIZE)
+    {
+        frameSize = CANTP_CLASSIC_FRAME_SIZE;
+    }
+#if (CANTP_MAX_FRAME_SIZE > CANTP_CLASSIC_FRAME_SIZE)
+    else
+    {
+        for (i = 0; i < CANTP_NUMBER_OF_CANFD_SIZE; i++)
+        {
+            if (size <= gs_CanFdFrameSize[i])
+            {
+                frameSize = gs_CanFdFrameSize[i];
+                break;
+            }
+        }
+    }
+#endif
+
+    Bl_MemSet(&frame[size],
+                CANTP_FRAME_PADDING_VALUE,
+                (UINT16)(frameSize - size));
+#else
+    (void)frame;
+#endif
+
+    return frameSize;
+}
+
+/**************************************************************************//**
+ *
+ *  \details the period function of the cantp module.
+ *
+ *  \param[in]  num - The number of the channels in the list.
+ *  \param[in]  first - the index of the channel processed firstly.
+ *  \param[in]  channelList - the list of the channels.
+ *  \param[in]  periodList - the list of the period and timeout interface of
+ *                           the channel.
+ *
+ *  \return None.
+ *
+ *  \since  V5.0.0
+ *
+ *****************************************************************************/
+static void _Cantp_PeriodFunction(UINT16 num,
+                                    UINT16 first,
+                                    bl_CanTpChannel_t *channelList,
+                                    const bl_CanTpPeriodIF_t *periodList)
+{
+    bl_CanTpChannel_t *channel;
+    UINT8 ret;
+    UINT16 i;
+    UINT16 index = first;
+#if (CANTP_FUN_CHANNEL_SOA == ON)
+    const UINT8 *status;
+    const UINT16 *timer;
+
+    if (0u == num)
+    {
+        return ;
+    }
+
+    /*The slots of a channel list are contiguous.*/
+    status = &gs_CanTpChannelStatus[channelList[0].slot];
+    timer = &gs_CanTpChannelTimer[channelList[0].slot];
+#endif
+
+    for (i = 0; i < num; i++)
+    {
+#if (CANTP_FUN_CHANNEL_SOA == ON)
+        /*The timeout of an idle channel does nothing, so the channel is not
+          loaded.*/
+        if ((CANTP_STATUS_IDLE == status[index]) && (0u == timer[index]))
+        {
+            index += 1u;
+            if (index >= num)
+            {
+                index = 0u;
+            }
+            continue;
+        }
+#endif
+        channel = &channelList[index];
+        index += 1u;
+        if (index >= num)
+        {
+            index = 0u;
+        }
+
+        if (CANTP_IS_TIMEOUT(channel))
+        {
+            ret = periodList[CANTP_CHANNEL_STATUS(channel)].Timeout(channel);
+            if (ERR_OK == ret)
+            {
+                _Cantp_GotoIdle(channel);
+            }
+        }
+        else
+        {
+            CANTP_CHANNEL_TIMER(channel) -= 1u;
+            periodList[CANTP_CHANNEL_STATUS(channel)].Period(channel);
+        }
+    }
+}
+
+#if (CANTP_FUN_TX_PRIORITY == ON)
+/**************************************************************************//**
+ *
+ *  \details Transmit the pending SF of the tx channels before the period
+ *           function of the tx channels, which transmits the CFs. The timers
+ *           are not changed, a SF not transmitted here is tried again by the
+ *           period function of its channel.
+ *
+ *  \param[in]  num - The number of the channels in the list.
+ *  \param[in]  channelList - the list of the tx channels.
+ *
+ *  \return None.
+ *
+ *  \since  V5.2.0
+ *
+ *****************************************************************************/
+static void _Cantp_PeriodUrgentTx(UINT16 num, bl_CanTpChannel_t *channelList)
+{
+    bl_CanTpChannel_t *channel;
+    UINT16 i;
+
+    for (i = 0; i < num; i++)
+    {
+        channel = &channelList[i];
+        if ((CANTP_STATUS_IS_TRANSF(channel))
+            && (!CANTP_IS_TIMEOUT(channel)))
+        {
+            _Cantp_PeriodTranSF(channel);
+        }
+    }
+
+    return ;
+}
+#endif
+
+/**************************************************************************//**
+ *
+ *  \details Indicate a rx channel to receive a frame data.
+ *
+ *  \param[in]  channel - the pointer of a rx channel.
+ *  \param[in]  size - the size of received data
+ *  \param[in]  buffer - the contents of received data.
+ *
+ *  \return If the received data can be processed by the rx channel, returns
+ *          the ERR_OK. Otherwise returns ERR_ERROR.
+ *
+ *  \since  V5.0.0
+ *
+ *****************************************************************************/
+static UINT8 _Cantp_RxIndToRxChannel(bl_CanTpChannel_t *channel,
+                                            bl_BufferSize_t size,
+                                            const bl_Buffer_t *buffer)
+{
+    bl_CanTpRxProcess_t processor;
+    UINT8 frameType;
+    UINT8 ret = ERR_ERROR;
+
+    if (channel != NULL_PTR)
+    {
+        if ((CANTP_IS_STANDARD_CHANNEL(channel))
+            || (channel->chnCfg->ta == buffer[CANTP_TA_OFFSET]))
+        {
+            frameType = CANTP_GET_FRAME_TYPE(CANTP_CHANNEL_PCI(channel),buffer);
+            if (frameType < CANTP_FRAME_TYPE_FC)
+            {
+                processor = gs_RxProcessList[frameType];
+                ret = processor(channel,size,buffer);
+            }
+        }
+    }
+
+    if (ERR_OK == ret)
+    {
+        _Cantp_RxChannelReceived(channel);
+    }
+
+    return ret;
+}
+
+/**************************************************************************//**
+ *
+ *  \details Finish a frame received by a rx channel, the frame is charged to
+ *           the session by the scheduler and the FC of a received FF or
+ *           the last CF of a block is transmitted at once. It is used by
+ *           each path giving a frame to a rx channel.
+ *
+ *  \param[in/out]  channel - the pointer of a rx channel.
+ *
+ *  \return None.
+ *
+ *  \since  V5.2.0
+ *
+ *****************************************************************************/
+static void _Cantp_RxChannelReceived(bl_CanTpChannel_t *channel)
+{
+#if (CANTP_FUN_CLIENT_SCHEDULER == ON)
+    CanTpSched_FrameReceived(CANTP_GET_RX_HANDLE(channel));
+#endif
+
+#if (CANTP_FUN_INLINE_FLOW_CONTROL == ON)
+    _Cantp_InlineFlowControl(channel);
+#else
+    (void)channel;
+#endif
+
+    return ;
+}
+
+/**************************************************************************//**
+ *
+ *  \details Indicate the tx channels to receive a frame, only the FC frames
+ *           are received by the tx channels.
+ *
+ *  \param[in]  ctrl - the CAN controller receiving the frame.
+ *  \param[in]  id   - the id of the frame.
+ *  \param[in]  channel - the tx channel of the id, or NULL_PTR.
+ *  \param[in]  size - the size of received data
+ *  \param[in]  buffer - the contents of received data.
+ *
+ *  \return If the received data is processed by a tx channel, returns
+ *          the ERR_OK. Otherwise returns ERR_ERROR.
+ *
+ *  \since  V5.2.0
+ *
+ *****************************************************************************/
+static UINT8 _Cantp_RxIndToTx(UINT8 ctrl,
+                                UINT32 id,
+                                bl_CanTpChannel_t *channel,
+                                bl_BufferSize_t size,
+                                const bl_Buffer_t *buffer)
+{
+    UINT8 ret;
+
+    ret = _Cantp_RxIndToTxChannel(channel,size,buffer);
+#if ((CANTP_FUN_FUNCTIONAL_MULTICAST == ON) && (CANTP_ROLE == CANTP_ROLE_CLIENT))
+    if (ret != ERR_OK)
+    {
+        /*The FC of the leader is received by the functional tx channel.*/
+        channel = &gs_CanTpTxChannel[CANTP_FUNCATION_CHANNEL_TX];
+        if ((channel->chnCfg->rxId == id)
+            && (channel->chnCfg->ctrl == ctrl))
+        {
+            ret = _Cantp_RxIndToTxChannel(channel,size,buffer);
+        }
+    }
+#else
+    (void)ctrl;
+    (void)id;
+#endif
+
+    return ret;
+}
+
+/**************************************************************************//**
+ *
+ *  \details Indicate a tx channel to receive a frame data.
+ *
+ *  \param[in]  channel - the pointer of a tx channel.
+ *  \param[in]  size - the size of received data
+ *  \param[in]  buffer - the contents of received data.
+ *
+ *  \return If the received data can be processed by the tx channel, returns
+ *          the ERR_OK. Otherwise returns ERR_ERROR.
+ *
+ *  \since  V5.0.0
+ *
+ *****************************************************************************/
+static UINT8 _Cantp_RxIndToTxChannel(bl_CanTpChannel_t *channel,
+                                            bl_BufferSize_t size,
+                                            const bl_Buffer_t *buffer)
+{
+    bl_CanTpRxProcess_t processor;
+    UINT8 frameType;
+    UINT8 ret = ERR_ERROR;
+    
+    if (channel != NULL_PTR)
+    {
+        if ((CANTP_IS_STANDARD_CHANNEL(channel))
+            || (channel->chnCfg->ta == buffer[CANTP_TA_OFFSET]))
+        {
+            frameType = CANTP_GET_FRAME_TYPE(CANTP_CHANNEL_PCI(channel),buffer);
+            if (frameType == CANTP_FRAME_TYPE_FC)
+            {
+                processor = gs_RxProcessList[frameType];
+                ret = processor(channel,size,buffer);
+            }
+        }
+    }
+
+#if (CANTP_FUN_CLIENT_SCHEDULER == ON)
+    if (ERR_OK == ret)
+    {
+        CanTpSched_FrameReceived(CANTP_GET_TX_HANDLE(channel));
+    }
+#endif
+
+    return ret;
+}
+
+/**************************************************************************//**
+ *
+ *  \details    receive a frame according to the Single Frame in
+ *              the ISO 15765-2.
+ *
+ *  \param[in]  channel - the pointer of a channel.
+ *  \param[in]  size - the size of received data
+ *  \param[in]  buffer - the contents of received data.
+ *
+ *  \return If the received data can be processed by the channel, returns
+ *          the ERR_OK. Otherwise returns ERR_ERROR.
+ *
+ *  \since  V5.0.0
+ *
+ *****************************************************************************/
+static UINT8 _Cantp_ReceiveSF(bl_CanTpChannel_t *channel,
+                                    bl_BufferSize_t size,
+                                    const bl_Buffer_t *buffer)
+{
+    const bl_CanTpPciInfo_t *pci;
+    UINT8 ret = ERR_ERROR;
+    UINT8 dataPos;
+    bl_BufferSize_t tmpSize;
+
+    if (size > CANTP_GET_MAX_DL(channel))
+    {
+        return ret;
+    }
+
+    /*The RX_DL is detected from the size of the frame.*/
+    pci = _Cantp_GetPciInfo(channel->chnCfg->type, size);
+#if(CANTP_COMMUNICATION_DUPLEX == CANTP_HALF_DUPLEX)
+    if((CANTP_PAIR_IS_IDLE(channel)) 
+        || (CANTP_IS_FUNCTIONAL_CHANNEL(channel)))
+    {
+#endif
+        /***获得SF_DL***/
+        if(size <= CANTP_CLASSIC_FRAME_SIZE)
+        {
+            tmpSize = CANTP_GET_SF_DATASIZE(buffer[CANTP_PCI_POS(pci)]);
+            dataPos = CANTP_DATA_POS(pci);
+        }
+        else
+        {
+            /*The SF_DL of the escape sequence is a whole byte.*/
+            tmpSize = buffer[CANTP_PCI_POS(pci) + 1];
+            dataPos = CANTP_DATA_POS(pci) + CANTP_FRAME_SF_ESC_SIZE;
+            if((0x00 != CANTP_GET_SF_DATASIZE(buffer[CANTP_PCI_POS(pci)]))
+              ||(!CANTP_IS_SF_ESCAPE(pci,tmpSize)))
+            {
+                return ret;
+            }
+        }
+
+        if ((tmpSize != 0) && (tmpSize <= pci->maxSFDataSize)
+            && ((tmpSize + dataPos) <= size))
+        {
+#if (CANTP_FUN_RX_SF_QUEUE == ON)
+            /*The last SF is not given to the upper layer, this SF is given
+              after it.*/
+            if (CANTP_STATUS_IS_RECVSF(channel))
+            {
+                return _Cantp_QueueSF(channel, pci, tmpSize, &buffer[dataPos]);
+            }
+#endif
+            /*  When continuous SF is received in one channel during
+                a timeout period,It maybe break other channel.
+                So If a channel do not get the buffer from DCM module,
+                do NOT indicate.*/
+            if(CANTP_IS_GETTING_BUFFER(channel))
+
+            {
+                CANTP_RX_INDICATION(channel, ERR_ERROR);
+            }
+#if (CANTP_FUN_FRAME_POOL == ON)
+            if (_Cantp_GetFrameBuffer(channel) != ERR_OK)
+            {
+                /*No buffer is free, the SF is ignored.*/
+                _Cantp_GotoIdle(channel);
+                return ret;
+            }
+#endif
+            FblMemCpy(channel->frame, &buffer[dataPos], (UINT16)tmpSize);
+            channel->pciInfo = pci;
+            CANTP_SET_CHANNEL_DL(channel,pci->frameSize);
+            channel->lastSize = tmpSize;
+
+            CANTP_STATUS_GOTO_RECVSF(channel);
+            CANTP_INIT_TIMER_B(channel);
+
+            ret = ERR_OK;
+        }
+#if(CANTP_COMMUNICATION_DUPLEX == CANTP_HALF_DUPLEX)
+    }
+#endif
+    return ret;
+}
+/**************************************************************************//**
+ *
+ *  \details    receive a frame according to the First Frame in
+ *              the ISO 15765-2.
+ *
+ *  \param[in]  channel - the pointer of a channel.
+ *  \param[in]  size - the size of received data
+ *  \param[in]  buffer - the contents of received data.
+ *
+ *  \return If the received data can be processed by the channel, returns
+ *          the ERR_OK. Otherwise returns ERR_ERROR.
+ *
+ *  \since  V5.0.0
+ *
+ *****************************************************************************/
+static UINT8 _Cantp_ReceiveFF(bl_CanTpChannel_t *channel,
+                                    bl_BufferSize_t size,
+                                    const bl_Buffer_t *buffer)
+{
+    const bl_CanTpPciInfo_t *pci;
+    UINT8 ret = ERR_ERROR;
+    UINT8 dataPos;
+    UINT32 escSize;
+    bl_BufferSize_t totalSize;
+    bl_BufferSize_t ffSize;
+
+    if (((CANTP_IS_PHYSICAL_CHANNEL(channel))
+        || (CANTP_IS_MULTICAST_CHANNEL(channel)))
+        && (size <= CANTP_GET_MAX_DL(channel)))
+    {
+        /*The RX_DL is detected from the size of the frame.*/
+        pci = _Cantp_GetPciInfo(channel->chnCfg->type, size);
+#if(CANTP_COMMUNICATION_DUPLEX == CANTP_HALF_DUPLEX)
+        if(CANTP_PAIR_IS_IDLE(channel))
+        {
+#endif
+            totalSize = CANTP_GET_FF_DATASIZE(buffer[CANTP_PCI_POS(pci)],buffer[CANTP_PCI_POS(pci) + 1]);
+            dataPos = CANTP_FF_DATA_POS(pci);
+
+            if(totalSize == 0x0000)/***FF_DL>4095***/
+            {
+                escSize = CANTP_GET_FF_DATASIZE2(buffer[CANTP_PCI_POS(pci) + 2],buffer[CANTP_PCI_POS(pci) + 3], \
+                                                 buffer[CANTP_PCI_POS(pci) + 4],buffer[CANTP_PCI_POS(pci) + 5]);
+                if ((!CANTP_IS_FF_ESCAPE(escSize))
+                    || (escSize > CANTP_MAX_MESSAGE_SIZE))
+                {
+                    return ret;
+                }
+
+                totalSize = (bl_BufferSize_t)escSize;
+                dataPos += CANTP_FRAME_FF_ESC_SIZE;
+            }
+
+            /*The FF fills a frame of the RX_DL, the CFs use it too.*/
+            ffSize = CANTP_GET_FF_DATA_SIZE(pci,size,totalSize);
+            if ((size >= CANTP_CLASSIC_FRAME_SIZE) && (totalSize > ffSize))
+            {
+                /*  When continuous FF is received in one channel during
+                    a timeout period,It maybe break other physical channel.
+                    So If a channel do not get the buffer from DCM module,
+                    do NOT indicate.*/
+                if(CANTP_IS_GETTING_BUFFER(channel))
+                {
+                    CANTP_RX_INDICATION(channel, ERR_ERROR);
+                }
+#if (CANTP_FUN_FRAME_POOL == ON)
+                if (_Cantp_GetFrameBuffer(channel) != ERR_OK)
+                {
+                    /*No buffer is free, the FF is ignored.*/
+                    _Cantp_GotoIdle(channel);
+                    return ret;
+                }
+#endif
+                FblMemCpy(channel->frame,&buffer[dataPos],(UINT16)ffSize);
+                channel->pciInfo = pci;
+                CANTP_SET_CHANNEL_DL(channel,size);
+                _Cantp_SetMultipleFrameSize(channel,totalSize);
+
+                CANTP_INIT_SN(channel);
+                CANTP_INIT_MAXWFT_BY_CFG(channel,channel->chnCfg);
+#if (CANTP_FUN_FUNCTIONAL_MULTICAST == ON)
+                channel->catchUp = FALSE;
+                channel->catchUpOffset = 0u;
+#endif
+#if (CANTP_FUN_RESUMABLE_TRANSFER == ON)
+                channel->resume = FALSE;
+                channel->resumeOffset = 0u;
+#endif
+#if (CANTP_FUN_RX_SF_QUEUE == ON)
+                /*The FF drops the SFs not given to the upper layer.*/
+                _Cantp_DropQueuedSF(channel);
+#endif
+                CANTP_STATUS_GOTO_RECVFF(channel);
+                CANTP_INIT_TIMER_B(channel);
+#if (CANTP_FUN_FUNCTIONAL_MULTICAST == ON)
+                if (CANTP_IS_MULTICAST_FOLLOWER(channel))
+                {
+                    /*The CFs may follow the FC of the leader at once, so
+                      the buffer is gotten in this context.*/
+                    _Cantp_PeriodRecvFF(channel);
+                }
+#endif
+
+                ret = ERR_OK;
+            }
+#if(CANTP_COMMUNICATION_DUPLEX == CANTP_HALF_DUPLEX)
+        }
+#endif
+    }
+
+    return ret;
+}
+
+/**************************************************************************//**
+ *
+ *  \details    receive a frame according to the Consecutive Frame in
+ *              the ISO 15765-2.
+ *
+ *  \param[in]  channel - the pointer of a channel.
+ *  \param[in]  size - the size of received data
+ *  \param[in]  buffer - the contents of received data.
+ *
+ *  \return If the received data can be processed by the channel, returns
+ *          the ERR_OK. Otherwise returns ERR_ERROR.
+ *
+ *  \since  V5.0.0
+ *
+ *****************************************************************************/
+static UINT8 _Cantp_ReceiveCF(bl_CanTpChannel_t *channel,
+                                    bl_BufferSize_t size,
+                                    const bl_Buffer_t *buffer)
+{
+    const bl_CanTpPciInfo_t *pci;
+    UINT8 ret = ERR_ERROR;
+    UINT8 expectedSN;
+    UINT8 recvSN;
+    bl_BufferSize_t tmpSize;
+#if (CANTP_FUN_FUNCTIONAL_MULTICAST == ON)
+    UINT8 lostCnt;
+    UINT8 fcBs;
+#endif
+
+    pci = CANTP_CHANNEL_PCI(channel);
+#if(CANTP_COMMUNICATION_DUPLEX == CANTP_HALF_DUPLEX)
+    if(CANTP_PAIR_IS_IDLE(channel))
+    {
+#endif
+        do
+        {
+#if (CANTP_FUN_FUNCTIONAL_MULTICAST == ON)
+            if ((CANTP_IS_MULTICAST_FOLLOWER(channel))
+                && (CANTP_STATUS_IS_RECVFF(channel)))
+            {
+                /*  The buffer is still busy when the CFs arrive, count the
+                    CFs until the end of the transfer and catch up the whole
+                    message.*/
+                _Cantp_SaveCatchUpOffset(channel);
+                CANTP_STATUS_GOTO_RECVCF(channel);
+                CANTP_INIT_TIMER_C(channel);
+            }
+#endif
+            if (CANTP_STATUS_IS_NOT_RECVCF(channel)
+                || (0 == channel->cfCnt))   /*avoid unwanted CF*/
+            {
+                break;
+            }
+#if (CANTP_FUN_RX_FRAME_PADDING == OFF)
+            if (1 == channel->cfCnt)        /*the last CF*/
+            {
+                if (size < channel->lastSize)
+                {
+                    break;
+                }
+            }
+            else
+            {
+                if (size < CANTP_CHANNEL_DL(channel))
+                {
+                    break;
+                }
+            }
+#else
+            (void)size;
+#endif
+
+            expectedSN = GET_LOW_HALF(channel->sn + 1);
+            recvSN = CANTP_GET_CF_SN(pci,buffer);
+            if (recvSN == expectedSN)
+            {
+                channel->sn = expectedSN;
+            }
+#if (CANTP_FUN_FUNCTIONAL_MULTICAST == ON)
+            else if ((CANTP_IS_MULTICAST_CHANNEL(channel))
+                    && (recvSN == channel->sn))
+            {
+                /*A repeated CF, its data is already received.*/
+                ret = ERR_OK;
+                break;
+            }
+            else if (CANTP_IS_MULTICAST_CHANNEL(channel))
+            {
+                /*  Do NOT break the stream of the other receivers, the data
+                    after the lost CF is received by the catch-up path.*/
+                if (FALSE == channel->catchUp)
+                {
+                    _Cantp_SaveCatchUpOffset(channel);
+                }
+                /*Count the lost CF to find the end of the transfer.*/
+                lostCnt = GET_LOW_HALF(recvSN - expectedSN);
+                if (lostCnt >= channel->cfCnt)
+                {
+                    lostCnt = (UINT8)(channel->cfCnt - 1u);
+                }
+                channel->cfCnt -= lostCnt;
+                /*The lost CF are also counted in the blocks of the leader.*/
+                if (channel->bs > lostCnt)
+                {
+                    channel->bs -= lostCnt;
+                }
+                else if (channel->bs != 0)
+                {
+                    /*The current block is ended by the lost CF, the received
+                      CF is in one of the next blocks.*/
+                    fcBs = CANTP_GET_CHANNEL_FC_BS(channel);
+                    channel->bs = (UINT8)(fcBs - ((lostCnt - channel->bs) % fcBs));
+                }
+                else
+                {
+                    /*The blocks are not limited.*/
+                }
+                channel->sn = recvSN;
+            }
+#endif
+            else
+            {
+#if (CANTP_FUN_RESUMABLE_TRANSFER == ON)
+                _Cantp_SaveResumeOffset(channel);
+#endif
+                CANTP_RX_INDICATION(channel, ERR_ERROR);
+                _Cantp_GotoIdle(channel);
+                break;
+            }
+
+            channel->cfCnt -= 1;
+            if (0 == channel->cfCnt)
+            {
+                tmpSize = channel->lastSize;
+            }
+            else
+            {
+                tmpSize = CANTP_CHANNEL_CF_DATA_SIZE(channel);
+            }
+
+#if (CANTP_FUN_FUNCTIONAL_MULTICAST == ON)
+            if (channel->catchUp != FALSE)
+            {
+                /*Only count the CF until the end of the multicast transfer.*/
+                ret = ERR_OK;
+            }
+            else
+#endif
+            {
+                /*Immediately copy data to buffer avoid continuous CF during a period*/
+                ret = CANTP_COPY_RX_DATA(channel,tmpSize,&buffer[CANTP_DATA_POS(pci)]);
+            }
+
+            if (ERR_OK == ret)
+            {
+                /*reset the timer of this channel.*/
+                CANTP_INIT_TIMER_C(channel);
+
+                if (CANTP_IS_MULTICAST_FOLLOWER(channel))
+                {
+                    /*The FC is transmitted by the leader.*/
+                }
+                else if ((channel->bs != 0) && (channel->cfCnt != 0))
+                {
+                    channel->bs -= 1;
+                    if (0 == channel->bs)
+                    {
+                        _Cantp_GotoTranFC(channel, CANTP_FC_FRAME_CTS);
+                    }
+                }
+            }
+            else
+            {
+                BL_DEBUG_ASSERT_NO_RET(0);
+                CANTP_RX_INDICATION(channel, ERR_ERROR);
+                _Cantp_GotoIdle(channel);
+            }
+        }while(0);/*lint !e717*/
+#if(CANTP_COMMUNICATION_DUPLEX == CANTP_HALF_DUPLEX)
+    }
+#endif
+    return ret;
+}
+
+/**************************************************************************//**
+ *
+ *  \details    receive a frame according to the Flow Control Frame in
+ *              the ISO 15765-2.
+ *
+ *  \param[in]  channel - the pointer of a channel.
+ *  \param[in]  size - the size of received data
+ *  \param[in]  buffer - the contents of received data.
+ *
+ *  \return If the received data can be processed by the channel, returns
+ *          the ERR_OK. Otherwise returns ERR_ERROR.
+ *
+ *  \since  V5.0.0
+ *
+ *****************************************************************************/
+static UINT8 _Cantp_ReceiveFC(bl_CanTpChannel_t *channel,
+                                    bl_BufferSize_t size,
+                                    const bl_Buffer_t *buffer)
+{
+    const bl_CanTpPciInfo_t *pci;
+    UINT8 ret = ERR_ERROR;
+    UINT8 fs;
+    UINT8 tmpSt;
+    pci = CANTP_CHANNEL_PCI(channel);
+
+#if(CANTP_COMMUNICATION_DUPLEX == CANTP_HALF_DUPLEX)
+    if(CANTP_PAIR_IS_IDLE(channel))
+    {
+#endif
+        /*if the status of this channel is not waiting for FC*/
+#if (CANTP_FUN_RX_FRAME_PADDING == OFF)
+        if (CANTP_STATUS_IS_RECVFC(channel) && (size >= pci->maxFCDataSize))
+#else
+        (void)size;
+
+        if (CANTP_STATUS_IS_RECVFC(channel))
+#endif
+        {
+            fs = CANTP_GET_FC_FS(CANTP_CHANNEL_PCI(channel),buffer);
+
+            switch(fs)
+            {
+                case CANTP_FC_FRAME_CTS:
+                    channel->bs = CANTP_GET_FC_BS(CANTP_CHANNEL_PCI(channel),buffer);
+                    tmpSt = CANTP_GET_FC_STMIN(pci,buffer);
+                    channel->st = _Cantp_GetSTMinFromFC(tmpSt);
+#if (CANTP_FUN_RESUMABLE_TRANSFER == ON)
+                    /*The data transmitted before the CTS is received.*/
+                    channel->resumeOffset = channel->resumeBase
+                                            + _Cantp_GetCommittedSize(channel);
+#endif
+
+                    _Cantp_GotoTranCF(channel);
+                    break;
+                case CANTP_FC_FRAME_WAIT:
+                    CANTP_INIT_TIMER_B(channel);
+                    break;
+                case CANTP_FC_FRAME_OVERFLOW:
+                    CANTP_TX_CONFIRMATION(channel,ERR_OVERFLOW);
+                    _Cantp_GotoIdle(channel);
+                    break;
+                default:
+#if (CANTP_FUN_RESUMABLE_TRANSFER == ON)
+                    _Cantp_SaveResumeOffset(channel);
+#endif
+                    CANTP_TX_CONFIRMATION(channel,ERR_ERROR);
+                    _Cantp_GotoIdle(channel);
+                    break;
+            }
+
+            ret = ERR_OK;
+        }
+#if(CANTP_COMMUNICATION_DUPLEX == CANTP_HALF_DUPLEX)
+    }
+#endif
+    return ret;
+
+}
+
+
+/**************************************************************************//**
+ *
+ *  \details    Make the PCI information according to Single Frame and save it
+ *              to the local frame of the channel.
+ *
+ *  \param[in/out]  channel - the pointer of a tx channel.
+ *
+ *  \return None
+ *
+ *  \since  V5.1.0
+ *
+ *****************************************************************************/
+static void _Cantp_MakePciOfSF(bl_CanTpChannel_t *channel)
+{
+    const bl_CanTpPciInfo_t *pci = CANTP_CHANNEL_PCI(channel);
+    bl_Buffer_t *frame = channel->frame;
+
+    if (!CANTP_IS_STANDARD_CHANNEL(channel))
+    {
+        frame[CANTP_TA_OFFSET] = channel->chnCfg->ta;
+    }
+
+    if (CANTP_IS_SF_ESCAPE(pci,channel->lastSize))
+    {
+        /*The SF_DL does not fit in a classic frame, use the escape sequence.*/
+        frame[CANTP_PCI_POS(pci)] = CANTP_FRAME_SF_VALUE;
+        frame[CANTP_PCI_POS(pci) + 1] = (UINT8)(channel->lastSize);
+    }
+    else
+    {
+        frame[CANTP_PCI_POS(pci)] = GET_LOW_HALF(channel->lastSize);
+    }
+
+    return ;
+}
+
+/**************************************************************************//**
+ *
+ *  \details    Make the PCI information according to First Frame and save it
+ *              to the local frame of the channel.
+ *
+ *  \param[in/out]  channel - the pointer of a tx channel.
+ *
+ *  \return None
+ *
+ *  \since  V5.1.0
+ *
+ *****************************************************************************/
+static void _Cantp_MakePciOfFF(bl_CanTpChannel_t *channel)
+{
+    const bl_CanTpPciInfo_t *pci = CANTP_CHANNEL_PCI(channel);
+    bl_Buffer_t *frame = channel->frame;
+    bl_BufferSize_t totalSize = channel->totalSize;
+
+    if (!CANTP_IS_STANDARD_CHANNEL(channel))
+    {
+        frame[CANTP_TA_OFFSET] = channel->chnCfg->ta;
+    }
+
+    if (CANTP_IS_FF_ESCAPE(totalSize))
+    {
+        /*The FF_DL is bigger than 4095, use the escape sequence.*/
+        frame[CANTP_PCI_POS(pci)] = CANTP_FRAME_FF_VALUE;
+        frame[CANTP_PCI_POS(pci) + 1] = 0x00u;
+        frame[CANTP_PCI_POS(pci) + 2] = (UINT8)((UINT32)totalSize >> 24);
+        frame[CANTP_PCI_POS(pci) + 3] = (UINT8)((UINT32)totalSize >> 16);
+        frame[CANTP_PCI_POS(pci) + 4] = (UINT8)(totalSize >> 8);
+        frame[CANTP_PCI_POS(pci) + 5] = (UINT8)(totalSize);
+    }
+    else
+    {
+        totalSize = (totalSize & CANTP_FRAME_FF_DATASIZE_MASK)
+                    + CANTP_FRAME_FF_VAULE_16BITS;
+        frame[CANTP_PCI_POS(pci)] = (UINT8)(totalSize >> 8);
+        frame[CANTP_PCI_POS(pci) + 1] = (UINT8)(totalSize);
+    }
+
+    return ;
+}
+
+/**************************************************************************//**
+ *
+ *  \details    Make the PCI information according to Consecutive Frame and
+ *              save it to the local frame of the channel.
+ *
+ *  \param[in/out]  channel - the pointer of a tx channel.
+ *
+ *  \return None
+ *
+ *  \since  V5.1.0
+ *
+ *****************************************************************************/
+static void _Cantp_MakePciOfCF(bl_CanTpChannel_t *channel)
+{
+    const bl_CanTpPciInfo_t *pci = CANTP_CHANNEL_PCI(channel);
+    bl_Buffer_t *frame = channel->frame;
+
+    if (!CANTP_IS_STANDARD_CHANNEL(channel))
+    {
+        frame[CANTP_TA_OFFSET] = channel->chnCfg->ta;
+    }
+
+    frame[CANTP_PCI_POS(pci)] = CANTP_FRAME_CF_VALUE + GET_LOW_HALF(channel->sn);
+
+    return ;
+}
+
+/**************************************************************************//**
+ *
+ *  \details    Make the PCI information according to Flow Control Frame and
+ *              save it to the local frame of the channel.
+ *
+ *  \param[in/out]  channel - the pointer of a tx channel.
+ *
+ *  \return None
+ *
+ *  \since  V5.1.0
+ *
+ *****************************************************************************/
+static void _Cantp_MakePciOfFC(bl_CanTpChannel_t *channel)
+{
+    const bl_CanTpPciInfo_t *pci = CANTP_CHANNEL_PCI(channel);
+    bl_Buffer_t *frame = channel->frame;
+
+    if (!CANTP_IS_STANDARD_CHANNEL(channel))
+    {
+        frame[CANTP_TA_OFFSET] = channel->chnCfg->ta;
+    }
+
+    frame[CANTP_PCI_POS(pci)] = CANTP_FRAME_FC_VALUE
+                            + GET_LOW_HALF(channel->pData);
+    frame[CANTP_FC_BS_POS(pci)] = channel->bs;
+    frame[CANTP_FC_ST_POS(pci)] = channel->st;
+
+    return ;
+}
+
+/**************************************************************************//**
+ *
+ *  \details    The tx confirm function is used for the idle statue of channel.
+ *
+ *  \param[in/out]  channel - the pointer of a tx channel.
+ *
+ *  \return None
+ *
+ *  \since  V5.0.0
+ *
+ *****************************************************************************/
+static void _Cantp_TxConfirmIdle(bl_CanTpChannel_t *channel)
+{
+    (void)channel;
+
+    BL_DEBUG_ASSERT_NO_RET(CANTP_STATUS_IS_NOT_IDLE(channel));
+
+    return ;
+}
+
+/**************************************************************************//**
+ *
+ *  \details    The tx confirm function is used for the tranSF statue of
+ *              channel.
+ *
+ *  \param[in/out]  channel - the pointer of a tx channel.
+ *
+ *  \return None
+ *
+ *  \since  V5.0.0
+ *
+ *****************************************************************************/
+static void _Cantp_TxConfirmSF(bl_CanTpChannel_t *channel)
+{
+    CANTP_TX_CONFIRMATION(channel,ERR_OK);
+
+    _Cantp_GotoIdle(channel);
+
+    return ;
+}
+
+/**************************************************************************//**
+ *
+ *  \details    The tx confirm function is used for the tranFF statue of
+ *              channel.
+ *
+ *  \param[in/out]  channel - the pointer of a tx channel.
+ *
+ *  \return None
+ *
+ *  \since  V5.0.0
+ *
+ *****************************************************************************/
+static void _Cantp_TxConfirmFF(bl_CanTpChannel_t *channel)
+{
+    CANTP_ADD_SN(channel);  /*the First Frame use first SN.*/
+    CANTP_STATUS_GOTO_RECVFC(channel);
+    CANTP_SUB_STATUS_GOTO_IDLE(channel);
+    CANTP_INIT_TIMER_B(channel);
+
+    return ;
+}
+
+/**************************************************************************//**
+ *
+ *  \details    The tx confirm function is used for the tranCF statue of
+ *              channel.
+ *
+ *  \param[in/out]  channel - the pointer of a tx channel.
+ *
+ *  \return None
+ *
+ *  \since  V5.0.0
+ *
+ *****************************************************************************/
+static void _Cantp_TxConfirmCF(bl_CanTpChannel_t *channel)
+{
+    BL_DEBUG_ASSERT_NO_RET(CANTP_SUB_STATUS_IS_TRAN(channel));
+
+    CANTP_SUB_STATUS_GOTO_IDLE(channel);
+    CANTP_ADD_SN(channel);
+
+    if (channel->cfCnt == 0)
+    {
+        CANTP_TX_CONFIRMATION(channel,ERR_OK);
+        _Cantp_GotoIdle(channel);
+    }
+    else
+    {
+        if (channel->bs != 0)
+        {
+            channel->bs -= 1;
+            if (0 == channel->bs)
+            {
+                CANTP_STATUS_GOTO_RECVFC(channel);
+                CANTP_INIT_TIMER_B(channel);
+            }
+            else
+            {
+            	CANTP_SET_TIMER(channel,CANTP_CHNNEL_RX_CR);
+            	CANTP_INIT_TXDELAY(channel);
+            }
+        }
+        else
+        {
+            CANTP_SET_TIMER(channel,CANTP_CHNNEL_RX_CR);
+            CANTP_INIT_TXDELAY(channel);
+        }
+    }
+
+    return ;
+}
+
+/**************************************************************************//**
+ *
+ *  \details    The tx confirm function is used for the tranFC statue of
+ *              channel.
+ *
+ *  \param[in/out]  channel - the pointer of a tx channel.
+ *
+ *  \return None
+ *
+ *  \since  V5.0.0
+ *
+ *****************************************************************************/
+static void _Cantp_TxConfirmFC(bl_CanTpChannel_t *channel)
+{
+    switch(channel->pData)
+    {
+        case CANTP_FC_FRAME_CTS:
+            CANTP_STATUS_GOTO_RECVCF(channel);
+            CANTP_INIT_TIMER_C(channel);
+            break;
+        case CANTP_FC_FRAME_WAIT:
+            CANTP_STATUS_GOTO_RECVFF(channel);
+            CANTP_INIT_TIMER_B(channel);
+            break;
+        case CANTP_FC_FRAME_WAIT_BLOCK:
+            /*Wait for the buffer of the next block again.*/
+            CANTP_SUB_STATUS_GOTO_IDLE(channel);
+            CANTP_INIT_TIMER_A(channel);
+            CANTP_SET_PRIVATE_DATA(channel,CANTP_FC_FRAME_CTS);
+            break;
+        default:
+            _Cantp_GotoIdle(channel);
+            break;
+    }
+
+    return ;
+}
+
+/**************************************************************************//**
+ *
+ *  \details    Change the status of the channel to tranFC status.
+ *
+ *  \param[in/out]  channel - the pointer of a rx channel.
+ *  \param[in] fs - the FS value of the FC frame.
+ *
+ *  \return None
+ *
+ *  \since  V5.1.0
+ *
+ *****************************************************************************/
+static void _Cantp_GotoTranFC(bl_CanTpChannel_t *channel, UINT8 fs)
+{
+    CANTP_STATUS_GOTO_TRANFC(channel);
+    CANTP_SUB_STATUS_GOTO_IDLE(channel);
+    CANTP_INIT_TIMER_A(channel);
+    CANTP_INIT_FC_BS(channel);
+    CANTP_SET_PRIVATE_DATA(channel,fs);
+
+    return ;
+}
+
+/**************************************************************************//**
+ *
+ *  \details    Change the status of the channel to Idle status.
+ *
+ *  \param[in/out]  channel - the pointer of a channel.
+ *
+ *  \return None
+ *
+ *  \since  V5.1.0
+ *
+ *****************************************************************************/
+static void _Cantp_GotoIdle(bl_CanTpChannel_t *channel)
+{
+    CANTP_STATUS_GOTO_IDLE(channel);
+    CANTP_SUB_STATUS_GOTO_IDLE(channel);
+    CANTP_INIT_TIMER(channel);
+#if (CANTP_FUN_FRAME_POOL == ON)
+    _Cantp_FreeFrameBuffer(channel);
+#endif
+#if (CANTP_FUN_TX_REQUEST_QUEUE == ON)
+    /*The next message is started without waiting for the next period.*/
+    if (channel->txqTail != channel->txqHead)
+    {
+        _Cantp_StartQueuedTransmit(channel);
+    }
+#endif
+
+    return ;
+}
+
+/**************************************************************************//**
+ *
+ *  \details    Change the status of the channel to tranSF status.
+ *
+ *  \param[in/out]  channel - the pointer of a tx channel.
+ *
+ *  \return None
+ *
+ *  \since  V5.1.0
+ *
+ *****************************************************************************/
+static void _Cantp_GotoTranSF(bl_CanTpChannel_t *channel)
+{
+    CANTP_STATUS_GOTO_TRANSF(channel);
+    CANTP_SUB_STATUS_GOTO_IDLE(channel);
+    CANTP_INIT_TIMER_A(channel);
+
+    return ;
+}
+
+/**************************************************************************//**
+ *
+ *  \details    Change the status of the channel to tranFF status.
+ *
+ *  \param[in/out]  channel - the pointer of a tx channel.
+ *
+ *  \return None
+ *
+ *  \since  V5.1.0
+ *
+ *****************************************************************************/
+static void _Cantp_GotoTranFF(bl_CanTpChannel_t *channel)
+{
+    CANTP_STATUS_GOTO_TRANFF(channel);
+    CANTP_SUB_STATUS_GOTO_IDLE(channel);
+    CANTP_INIT_SN(channel);
+    CANTP_INIT_TIMER_A(channel);
+
+    return ;
+}
+
+/**************************************************************************//**
+ *
+ *  \details    Change the status of the channel to tranCF status.
+ *
+ *  \param[in/out]  channel - the pointer of a tx channel.
+ *
+ *  \return None
+ *
+ *  \since  V5.1.0
+ *
+ *****************************************************************************/
+static void _Cantp_GotoTranCF(bl_CanTpChannel_t *channel)
+{
+    CANTP_STATUS_GOTO_TRANCF(channel);
+    CANTP_SUB_STATUS_GOTO_IDLE(channel);
+    CANTP_SET_TIMER(channel,CANTP_CHNNEL_RX_CR);
+    CANTP_INIT_TXDELAY(channel);
+
+    return ;
+}
+
+/**************************************************************************//**
+ *
+ *  \details    The period function is used for the Idle status of a channel.
+ *
+ *  \param[in/out]  channel - the pointer of a channel.
+ *
+ *  \return None
+ *
+ *  \note   This function is not called except the timer is not set to zero
+ *          during the status of this channel is changed to IDLE.
+ *
+ *  \since  V5.1.0
+ *
+ *****************************************************************************/
+static void _Cantp_PeriodIdle(bl_CanTpChannel_t *channel)
+{
+    (void)channel;
+    /*  This function is not called except the timer is not set to zero
+        during the status of this channel is changed to IDLE.*/
+    BL_DEBUG_ASSERT_NO_RET(0);
+
+    return ;
+}
+
+/**************************************************************************//**
+ *
+ *  \details    The timeout function is used for the Idle status of a channel.
+ *
+ *  \param[in/out]  channel - the pointer of a channel.
+ *
+ *  \return If the timeout event is processed return ERR_OK, otherwise
+ *          return ERR_ERROR.
+ *
+ *  \note   Avoid unnecessary status switching, this function always returns
+ *          ERR_ERROR.
+ *
+ *  \since  V5.1.0
+ *
+ *****************************************************************************/
+static UINT8 _Cantp_TimeoutIdle(bl_CanTpChannel_t *channel)
+{
+    (void)channel;
+
+    return ERR_ERROR;
+}
+
+/**************************************************************************//**
+ *
+ *  \details    The period function is used for the recvSF status of a channel.
+ *
+ *  \param[in/out]  channel - the pointer of a channel.
+ *
+ *  \return None
+ *
+ *  \since V5.1.0
+ *
+ *****************************************************************************/
+static void _Cantp_PeriodRecvSF(bl_CanTpChannel_t *channel)
+{
+    UINT8 ret;
+
+#if (CANTP_FUN_STREAM_DEDUP == ON)
+    /*A block query is answered by the stream, not given to the Diag.*/
+    if (CanTpStream_RxBlockQuery(channel->lastSize, channel->frame) != FALSE)
+    {
+#if (CANTP_FUN_RX_SF_QUEUE == ON)
+        if (_Cantp_LoadQueuedSF(channel) != ERR_OK)
+#endif
+        {
+            _Cantp_GotoIdle(channel);
+        }
+        return ;
+    }
+#endif
+    /*alloc the buffer from the Dcm*/
+    ret = CANTP_START_OF_RECEPTION(channel,channel->lastSize);
+    /*if success then copy frame to buffer and goto idle*/
+    if (ERR_OK == ret)
+    {
+        ret = CANTP_COPY_RX_DATA(channel,channel->lastSize,channel->frame);
+        if (ERR_OK == ret)
+        {
+            CANTP_RX_INDICATION(channel, ERR_OK);
+        }
+        else
+        {
+            BL_DEBUG_ASSERT_NO_RET(0);
+            CANTP_RX_INDICATION(channel, ERR_ERROR);
+        }
+
+#if (CANTP_FUN_RX_SF_QUEUE == ON)
+        /*The next queued SF is given in the next period.*/
+        if (_Cantp_LoadQueuedSF(channel) != ERR_OK)
+#endif
+        {
+            _Cantp_GotoIdle(channel);
+        }
+    }
+
+    return ;
+}
+
+/**************************************************************************//**
+ *
+ *  \details    The timeout function is used for the recvSF status of a channel.
+ *
+ *  \param[in/out]  channel - the pointer of a channel.
+ *
+ *  \return If the timeout event is processed return ERR_OK, otherwise
+ *          return ERR_ERROR.
+ *
+ *  \since  V5.1.0
+ *
+ *****************************************************************************/
+static UINT8 _Cantp_TimeoutRecvSF(bl_CanTpChannel_t *channel)
+{
+#if (CANTP_FUN_RX_SF_QUEUE == ON)
+    /*The last SF is dropped, the channel keeps the recvSF status if a SF is
+      queued.*/
+    if (_Cantp_LoadQueuedSF(channel) == ERR_OK)
+    {
+        return ERR_ERROR;
+    }
+#else
+    (void)channel;
+#endif
+
+    return ERR_OK;
+}
+
+#if (CANTP_FUN_RX_SF_QUEUE == ON)
+/**************************************************************************//**
+ *
+ *  \details    Give the SF queues to the rx channels and the data of the
+ *              queued SFs from gs_CanTpSFQueueData. The entries of a rx
+ *              channel are sized by its MAX_DL, and the entries of a rx
+ *              channel of the pool are sized by the biggest MAX_DL of the rx
+ *              channels. A channel out of the data queues no SF.
+ *
+ *  \return None.
+ *
+ *  \since  V5.2.0
+ *
+ *****************************************************************************/
+static void _Cantp_InitSFQueue(void)
+{
+    bl_CanTpSFQueue_t *queue;
+    bl_CanTpChannel_t *channel;
+    bl_BufferSize_t maxDl = 0u;
+    bl_BufferSize_t dl;
+    UINT32 pos = 0uL;
+    UINT16 i;
+    UINT8 j;
+
+    for (i = 0; i < CANTP_NUMBER_OF_SF_QUEUE; i++)
+    {
+#if (CANTP_FUN_FIXED_ADDRESSING == ON)
+        /*The pool is after the rx channels, its peers may use any of them.*/
+        if (i >= CANTP_NUMBER_OF_RX_CHANNEL)
+        {
+            channel = &gs_CanTpPoolRxChannel[i - CANTP_NUMBER_OF_RX_CHANNEL];
+            dl = maxDl;
+        }
+        else
+#endif
+        {
+            channel = &gs_CanTpRxChannel[i];
+            dl = CANTP_GET_MAX_DL(channel);
+            if (dl > maxDl)
+            {
+                maxDl = dl;
+            }
+        }
+
+        queue = &gs_CanTpSFQueue[i];
+        queue->head = 0u;
+        queue->tail = 0u;
+        queue->drop = 0u;
+        channel->sfQueue = NULL_PTR;
+
+        BL_DEBUG_ASSERT_NO_RET((pos + ((UINT32)dl * CANTP_RX_SF_QUEUE_SIZE))
+                                <= CANTP_RX_SF_QUEUE_DATA_SIZE);
+        if ((pos + ((UINT32)dl * CANTP_RX_SF_QUEUE_SIZE))
+            <= CANTP_RX_SF_QUEUE_DATA_SIZE)
+        {
+            for (j = 0; j < CANTP_RX_SF_QUEUE_SIZE; j++)
+            {
+                queue->entry[j].data = &gs_CanTpSFQueueData[pos];
+                pos += dl;
+            }
+            channel->sfQueue = queue;
+        }
+    }
+
+    return ;
+}
+
+/**************************************************************************//**
+ *
+ *  \details    Queue a SF received by a channel in the recvSF status. The SF
+ *              is given to the upper layer after the SFs received before it.
+ *              If the queue is full, the SF is ignored. It is only called by
+ *              the ISR, which is the only writer of the head of the queue.
+ *
+ *  \param[in/out]  channel - the pointer of a rx channel.
+ *  \param[in]  pci - the PCI detected from the size of the SF.
+ *  \param[in]  size - the size of data in the SF.
+ *  \param[in]  data - the data of the SF.
+ *
+ *  \return If the SF is queued returns ERR_OK, otherwise returns ERR_ERROR.
+ *
+ *  \since  V5.2.0
+ *
+ *****************************************************************************/
+static UINT8 _Cantp_QueueSF(bl_CanTpChannel_t *channel,
+                            const bl_CanTpPciInfo_t *pci,
+                            bl_BufferSize_t size,
+                            const bl_Buffer_t *data)
+{
+    UINT8 ret = ERR_ERROR;
+    bl_CanTpSFQueue_t *queue = channel->sfQueue;
+    bl_CanTpQueuedSF_t *entry;
+    UINT8 head;
+    UINT8 tail;
+
+    if (queue != NULL_PTR)
+    {
+        head = queue->head;
+        tail = queue->tail;
+        /*The drop given by the task is out of the queue.*/
+        if ((UINT8)(queue->drop - tail) > (UINT8)(head - tail))
+        {
+            queue->drop = tail;
+        }
+
+        if ((UINT8)(head - tail) < CANTP_RX_SF_QUEUE_SIZE)
+        {
+            entry = &queue->entry[head & CANTP_RX_SF_QUEUE_MASK];
+            FblMemCpy(entry->data, data, (UINT16)size);
+            entry->pciInfo = pci;
+            entry->size = size;
+
+            /*The SF is written before it is published to the task.*/
+            CANTP_RX_QUEUE_BARRIER();
+            queue->head = (UINT8)(head + 1u);
+            ret = ERR_OK;
+        }
+    }
+
+    return ret;
+}
+
+/**************************************************************************//**
+ *
+ *  \details    Drop the SFs queued by a channel, e.g. a FF is received. The
+ *              task skips them when it loads the next SF. It is only called
+ *              by the ISR.
+ *
+ *  \param[in/out]  channel - the pointer of a rx channel.
+ *
+ *  \return None.
+ *
+ *  \since  V5.2.0
+ *
+ *****************************************************************************/
+static void _Cantp_DropQueuedSF(bl_CanTpChannel_t *channel)
+{
+    if (channel->sfQueue != NULL_PTR)
+    {
+        channel->sfQueue->drop = channel->sfQueue->head;
+    }
+
+    return ;
+}
+
+/**************************************************************************//**
+ *
+ *  \details    Load the oldest queued SF into the frame of a channel, the
+ *              channel keeps the recvSF status and the timer B is restarted
+ *              for the SF. The SFs dropped by a FF are skipped. It is only
+ *              called by the task, which is the only writer of the tail of
+ *              the queue.
+ *
+ *  \param[in/out]  channel - the pointer of a rx channel.
+ *
+ *  \return If a SF is loaded returns ERR_OK, otherwise returns ERR_ERROR.
+ *
+ *  \since  V5.2.0
+ *
+ *****************************************************************************/
+static UINT8 _Cantp_LoadQueuedSF(bl_CanTpChannel_t *channel)
+{
+    UINT8 ret = ERR_ERROR;
+    bl_CanTpSFQueue_t *queue = channel->sfQueue;
+    const bl_CanTpQueuedSF_t *entry;
+    UINT8 head;
+    UINT8 tail;
+    UINT8 drop;
+
+    if (queue != NULL_PTR)
+    {
+        /*The drop is read before the head, so it is not after the head.*/
+        tail = queue->tail;
+        drop = queue->drop;
+        head = queue->head;
+        if ((UINT8)(drop - tail) <= (UINT8)(head - tail))
+        {
+            tail = drop;
+        }
+
+        if (tail != head)
+        {
+            /*The SF is read after its head is read.*/
+            CANTP_RX_QUEUE_BARRIER();
+            entry = &queue->entry[tail & CANTP_RX_SF_QUEUE_MASK];
+            FblMemCpy(channel->frame, entry->data, (UINT16)entry->size);
+            channel->pciInfo = entry->pciInfo;
+            CANTP_SET_CHANNEL_DL(channel,entry->pciInfo->frameSize);
+            channel->lastSize = entry->size;
+            tail = (UINT8)(tail + 1u);
+
+            CANTP_INIT_TIMER_B(channel);
+            ret = ERR_OK;
+        }
+
+        /*The SF is read before its entry is given back to the ISR.*/
+        CANTP_RX_QUEUE_BARRIER();
+        queue->tail = tail;
+    }
+
+    return ret;
+}
+#endif
+
+/**************************************************************************//**
+ *
+ *  \details    The period function is used for the recvFF status of a channel.
+ *
+ *  \param[in/out]  channel - the pointer of a channel.
+ *
+ *  \return None
+ *
+ *  \since V5.1.0
+ *
+ *****************************************************************************/
+static void _Cantp_PeriodRecvFF(bl_CanTpChannel_t *channel)
+{
+    UINT8 ret;
+    /*Apply for the buffer from the Dcm*/
+    ret = CANTP_START_OF_RECEPTION(channel,channel->totalSize);
+
+    if (ERR_OK == ret)
+    {
+        ret = CANTP_COPY_RX_DATA(channel,
+                                CANTP_GET_FF_DATA_SIZE(CANTP_CHANNEL_PCI(channel),
+                                                        CANTP_CHANNEL_DL(channel),
+                                                        channel->totalSize),
+                                channel->frame);
+        if (ERR_OK == ret)
+        {
+            if (CANTP_IS_MULTICAST_FOLLOWER(channel))
+            {
+                /*The FC is transmitted by the leader, wait for the CF.*/
+                CANTP_STATUS_GOTO_RECVCF(channel);
+                CANTP_INIT_TIMER_C(channel);
+            }
+            else
+            {
+                _Cantp_GotoTranFC(channel, CANTP_FC_FRAME_CTS);
+            }
+        }
+        else
+        {
+            BL_DEBUG_ASSERT_NO_RET(0);
+            CANTP_RX_INDICATION(channel, ERR_ERROR);
+            _Cantp_GotoIdle(channel);
+        }
+    }
+    else if (CANTP_IS_MULTICAST_FOLLOWER(channel))
+    {
+        /*  A follower can not send a FC, the data is received by the
+            catch-up path if the buffer is not gotten.*/
+        if (ERR_OVERFLOW == ret)
+        {
+            _Cantp_GotoIdle(channel);
+        }
+    }
+    else if (ERR_OVERFLOW == ret)
+    {
+        _Cantp_GotoTranFC(channel, CANTP_FC_FRAME_OVERFLOW);
+    }
+    else
+    {
+        /* The buffer busy, wait the next period to alloc again.*/
+    }
+
+    return ;
+
+}
+
+/**************************************************************************//**
+ *
+ *  \details    The timeout function is used for the recvFF status of a channel.
+ *
+ *  \param[in/out]  channel - the pointer of a channel.
+ *
+ *  \return If the timeout event is processed return ERR_OK, otherwise
+ *          return ERR_ERROR.
+ *
+ *  \since  V5.1.0
+ *
+ *****************************************************************************/
+static UINT8 _Cantp_TimeoutRecvFF(bl_CanTpChannel_t *channel)
+{
+    UINT8 ret = ERR_OK;
+
+    if ((channel->wft != 0) && (!CANTP_IS_MULTICAST_FOLLOWER(channel)))
+    {
+        channel->wft -= 1;
+
+        _Cantp_GotoTranFC(channel, CANTP_FC_FRAME_WAIT);
+
+        ret = ERR_ERROR;
+    }
+
+    /* Br timeout, do not indicate the DCM.*/
+    return ret;
+}
+
+/**************************************************************************//**
+ *
+ *  \details    The period function is used for the recvCF status of a channel.
+ *
+ *  \param[in/out]  channel - the pointer of a channel.
+ *
+ *  \return None
+ *
+ *  \since V5.1.0
+ *
+ *****************************************************************************/
+static void _Cantp_PeriodRecvCF(bl_CanTpChannel_t *channel)
+{
+    if (0 == channel->cfCnt)
+    {
+#if (CANTP_FUN_FUNCTIONAL_MULTICAST == ON)
+        if (channel->catchUp != FALSE)
+        {
+            /*Some CF are lost, the upper layer uses the catch-up offset.*/
+            CANTP_RX_INDICATION(channel, ERR_ERROR);
+        }
+        else
+#endif
+        {
+            /*All CF is successfully received.*/
+            CANTP_RX_INDICATION(channel, ERR_OK);
+#if (CANTP_FUN_RESUMABLE_TRANSFER == ON)
+            channel->resumeBase = 0u;
+#endif
+        }
+
+        _Cantp_GotoIdle(channel);
+    }
+
+    return ;
+}
+
+/**************************************************************************//**
+ *
+ *  \details    The timeout function is used for the recvCF status of a channel.
+ *
+ *  \param[in/out]  channel - the pointer of a channel.
+ *
+ *  \return If the timeout event is processed return ERR_OK, otherwise
+ *          return ERR_ERROR.
+ *
+ *  \since  V5.1.0
+ *
+ *****************************************************************************/
+static UINT8 _Cantp_TimeoutRecvCF(bl_CanTpChannel_t *channel)
+{
+#if (CANTP_FUN_FUNCTIONAL_MULTICAST == ON)
+    if ((CANTP_IS_MULTICAST_CHANNEL(channel)) && (FALSE == channel->catchUp))
+    {
+        _Cantp_SaveCatchUpOffset(channel);
+    }
+#endif
+#if (CANTP_FUN_RESUMABLE_TRANSFER == ON)
+    if (!CANTP_IS_MULTICAST_CHANNEL(channel))
+    {
+        _Cantp_SaveResumeOffset(channel);
+    }
+#endif
+
+    /*Cr timeout!*/
+    CANTP_RX_INDICATION(channel, ERR_ERROR);
+
+    return ERR_OK;
+}
+
+/**************************************************************************//**
+ *
+ *  \details    The period function is used for the tranFC status of a channel.
+ *
+ *  \param[in/out]  channel - the pointer of a channel.
+ *
+ *  \return None
+ *
+ *  \since V5.1.0
+ *
+ *****************************************************************************/
+static void _Cantp_PeriodTranFC(bl_CanTpChannel_t *channel)
+{
+    UINT8 ret;
+    UINT8 hold = FALSE;
+    bl_BufferSize_t frameSize;
+    bl_Buffer_t *frame;
+    UINT32 id;
+
+
+    BL_DEBUG_ASSERT_NO_RET(channel != NULL_PTR);
+    BL_DEBUG_ASSERT_NO_RET(CANTP_STATUS_IS_TRANFC(channel));
+
+#if (CANTP_FUN_RX_BLOCK_HOLD == ON)
+    if ((CANTP_SUB_STATUS_IS_IDLE(channel))
+        && (CANTP_FC_FRAME_CTS == channel->pData)
+        && (FALSE == CANTP_UL_RX_READY(CANTP_GET_RX_HANDLE(channel),
+                                        _Cantp_GetBlockSize(channel))))
+    {
+        /*  The buffer of the next block is not ready, hold the CTS. If the
+            hold is too long, transmit a WAIT to restart the Bs timer of
+            the sender.*/
+        if ((CANTP_GET_TIMER(channel) > 1u) || (0u == channel->wft))
+        {
+            hold = TRUE;
+        }
+        else
+        {
+            channel->wft -= 1;
+            CANTP_SET_PRIVATE_DATA(channel,CANTP_FC_FRAME_WAIT_BLOCK);
+        }
+    }
+#endif
+
+    if ((FALSE == hold)
+        && (CANTP_SUB_STATUS_IS_IDLE(channel))
+        && (CANTP_GRANT_FRAME(CANTP_GET_RX_HANDLE(channel))))
+    {
+        _Cantp_MakePciOfFC(channel);
+
+        frameSize = CANTP_CHANNEL_PCI(channel)->maxFCDataSize;
+        frame = channel->frame;
+        id = channel->chnCfg->txId;
+
+        BL_DEBUG_ASSERT_NO_RET(frameSize != 0);
+
+        frameSize = _Cantp_PadFrame(frame, frameSize);
+
+        ret = CANTP_LL_TRANSMIT(channel->chnCfg->ctrl, frame, id,frameSize);
+
+        if (ERR_OK == ret)
+        {
+            CANTP_SUB_STATUS_GOTO_TRAN(channel);
+            CANTP_FRAME_TRANSMITTED(CANTP_GET_RX_HANDLE(channel));
+            gs_TransmittingChannel[0] = channel;
+            Cantp_TxConfirmation(id);
+        }
+    }
+
+    return ;
+
+}
+
+/**************************************************************************//**
+ *
+ *  \details    The timeout function is used for the tranFC status of a channel.
+ *
+ *  \param[in/out]  channel - the pointer of a channel.
+ *
+ *  \return If the timeout event is processed return ERR_OK, otherwise
+ *          return ERR_ERROR.
+ *
+ *  \since  V5.1.0
+ *
+ *****************************************************************************/
+/*lint -e{818}*/
+static UINT8 _Cantp_TimeoutTranFC(bl_CanTpChannel_t *channel)
+{
+    if (channel->pData != CANTP_FC_FRAME_WAIT)
+    {
+        /*  When a FC frame with wait flag is transmitted,
+            this channel do not get a buffer from DCM module.
+            So do NOT indicate the DCM module in order to avoid
+            break other channel.*/
+        CANTP_RX_INDICATION(channel, ERR_ERROR);
+    }
+
+    return ERR_OK;
+}
+
+/**************************************************************************//**
+ *
+ *  \details    The period function is used for the tranSF status of a channel.
+ *
+ *  \param[in/out]  channel - the pointer of a channel.
+ *
+ *  \return None
+ *
+ *  \since V5.1.0
+ *
+ *****************************************************************************/
+static void _Cantp_PeriodTranSF(bl_CanTpChannel_t *channel)
+{
+    UINT8 ret;
+    UINT8 dataPos;
+    bl_BufferSize_t dataSize;
+    bl_BufferSize_t frameSize;
+    bl_Buffer_t *frame;
+    UINT32 id;
+    BL_DEBUG_ASSERT_NO_RET(channel != NULL_PTR);
+    BL_DEBUG_ASSERT_NO_RET(CANTP_STATUS_IS_TRANSF(channel));
+
+#if (CANTP_FUN_RESUMABLE_TRANSFER == ON)
+    if (_Cantp_SkipTxData(channel) != ERR_OK)
+    {
+        return ;
+    }
+#endif
+
+    if ((CANTP_SUB_STATUS_IS_IDLE(channel))
+        && (CANTP_GRANT_FRAME(CANTP_GET_TX_HANDLE(channel))))
+    {
+        _Cantp_MakePciOfSF(channel);
+
+        dataSize = channel->lastSize;
+        frame = channel->frame;
+        dataPos = CANTP_DATA_POS(CANTP_CHANNEL_PCI(channel));
+        if (CANTP_IS_SF_ESCAPE(CANTP_CHANNEL_PCI(channel),dataSize))
+        {
+            dataPos += CANTP_FRAME_SF_ESC_SIZE;
+        }
+        id = channel->chnCfg->txId;
+        frameSize = dataSize + dataPos;
+
+        BL_DEBUG_ASSERT_NO_RET(dataSize != 0);
+        BL_DEBUG_ASSERT_NO_RET(frameSize <= CANTP_MAX_FRAME_SIZE);
+
+        /*If the data is not ready, try again during the next period.*/
+        ret = CANTP_COPY_TX_DATA(channel,dataSize, &frame[dataPos]);
+
+        if (ERR_OK == ret)
+        {
+            frameSize = _Cantp_PadFrame(frame, frameSize);
+
+            ret = CANTP_LL_TRANSMIT(channel->chnCfg->ctrl, frame, id,frameSize);
+        }
+
+        if (ERR_OK == ret)
+        {
+            CANTP_SUB_STATUS_GOTO_TRAN(channel);
+            CANTP_FRAME_TRANSMITTED(CANTP_GET_TX_HANDLE(channel));
+            gs_TransmittingChannel[0] = channel;
+            Cantp_TxConfirmation(id);
+        }
+    }
+
+    return ;
+}
+
+/**************************************************************************//**
+ *
+ *  \details    The timeout function is used for the tranSF status of a channel.
+ *
+ *  \param[in/out]  channel - the pointer of a channel.
+ *
+ *  \return If the timeout event is processed return ERR_OK, otherwise
+ *          return ERR_ERROR.
+ *
+ *  \since  V5.1.0
+ *
+ *****************************************************************************/
+static UINT8 _Cantp_TimeoutTranSF(bl_CanTpChannel_t *channel)
+{
+    (void)channel;
+    /*The As timeout.*/
+    CANTP_TX_CONFIRMATION(channel,ERR_ERROR);
+    return ERR_OK;
+}
+
+/**************************************************************************//**
+ *
+ *  \details    The period function is used for the tranFF status of a channel.
+ *
+ *  \param[in/out]  channel - the pointer of a channel.
+ *
+ *  \return None
+ *
+ *  \since V5.1.0
+ *
+ *****************************************************************************/
+static void _Cantp_PeriodTranFF(bl_CanTpChannel_t *channel)
+{
+    UINT8 ret;
+    UINT8 dataPos;
+    bl_BufferSize_t dataSize;
+    bl_Buffer_t *frame;
+    UINT32 id;
+
+    BL_DEBUG_ASSERT_NO_RET(channel != NULL_PTR);
+    BL_DEBUG_ASSERT_NO_RET(CANTP_STATUS_IS_TRANFF(channel));
+    BL_DEBUG_ASSERT_NO_RET(channel->totalSize != 0);
+
+#if (CANTP_FUN_RESUMABLE_TRANSFER == ON)
+    if (_Cantp_SkipTxData(channel) != ERR_OK)
+    {
+        return ;
+    }
+#endif
+
+    if ((CANTP_SUB_STATUS_IS_IDLE(channel))
+        && (CANTP_GRANT_FRAME(CANTP_GET_TX_HANDLE(channel))))
+    {
+        _Cantp_MakePciOfFF(channel);
+
+        frame = channel->frame;
+        dataPos = CANTP_FF_DATA_POS(CANTP_CHANNEL_PCI(channel));
+        if (CANTP_IS_FF_ESCAPE(channel->totalSize))
+        {
+            dataPos += CANTP_FRAME_FF_ESC_SIZE;
+        }
+        dataSize = CANTP_GET_FF_DATA_SIZE(CANTP_CHANNEL_PCI(channel),
+                                            CANTP_CHANNEL_DL(channel),
+                                            channel->totalSize);
+        id = channel->chnCfg->txId;
+
+        /*If the data is not ready, try again during the next period.*/
+        ret = CANTP_COPY_TX_DATA(channel,dataSize, &frame[dataPos]);
+
+        if (ERR_OK == ret)
+        {
+            ret = CANTP_LL_TRANSMIT(channel->chnCfg->ctrl,
+                                    frame,
+                                    id,
+                                    CANTP_CHANNEL_DL(channel));
+        }
+
+        if (ERR_OK == ret)
+        {
+            CANTP_SUB_STATUS_GOTO_TRAN(channel);
+            CANTP_FRAME_TRANSMITTED(CANTP_GET_TX_HANDLE(channel));
+            gs_TransmittingChannel[0] = channel;
+            Cantp_TxConfirmation(id);
+        }
+    }
+
+    return ;
+}
+
+/**************************************************************************//**
+ *
+ *  \details    The timeout function is used for the tranFF status of a channel.
+ *
+ *  \param[in/out]  channel - the pointer of a channel.
+ *
+ *  \return If the timeout event is processed return ERR_OK, otherwise
+ *          return ERR_ERROR.
+ *
+ *  \since  V5.1.0
+ *
+ *****************************************************************************/
+static UINT8 _Cantp_TimeoutTranFF(bl_CanTpChannel_t *channel)
+{
+    (void)channel;
+    /*The As timeout.*/
+    CANTP_TX_CONFIRMATION(channel,ERR_ERROR);
+    return ERR_OK;
+}
+
+/**************************************************************************//**
+ *
+ *  \details    The period function is used for the tranCF status of a channel.
+ *
+ *  \param[in/out]  channel - the pointer of a channel.
+ *
+ *  \return None
+ *
+ *  \since V5.1.0
+ *
+ *****************************************************************************/
+static void _Cantp_PeriodTranCF(bl_CanTpChannel_t *channel)
+{
+    BL_DEBUG_ASSERT_NO_RET(channel != NULL_PTR);
+    BL_DEBUG_ASSERT_NO_RET(CANTP_STATUS_IS_TRANCF(channel));
+    BL_DEBUG_ASSERT_NO_RET(channel->cfCnt > 0);
+
+    if (CANTP_SUB_STATUS_IS_IDLE(channel))
+    {
+        if (channel->txDelay != 0)
+        {
+            channel->txDelay -= 1;
+        }
+
+        if ((channel->txDelay == 0)
+            && (CANTP_GRANT_FRAME(CANTP_GET_TX_HANDLE(channel))))
+        {
+            _Cantp_TransmitCF(channel);
+        }
+    }
+
+    return ;
+}
+/**************************************************************************//**
+ *
+ *  \details    transmit a frame according to the Flow Control Frame in
+ *              the ISO 15765-2.
+ *              If the frame is not transmitted, try again during the next
+ *              period.
+ *
+ *  \param[in/out]  channel - the pointer of a tx channel.
+ *
+ *  \return None
+ *
+ *  \since  V5.0.0
+ *
+ *****************************************************************************/
+static void _Cantp_TransmitCF(bl_CanTpChannel_t *channel)
+{
+    UINT8 ret;
+    UINT8 dataPos;
+    bl_BufferSize_t dataSize;
+    bl_BufferSize_t frameSize;
+    bl_Buffer_t *frame;
+    UINT32 id;
+    UINT16 cfCounter;
+
+    _Cantp_MakePciOfCF(channel);
+
+    cfCounter = channel->cfCnt - 1;
+    if (0 == cfCounter)
+    {
+        dataSize = channel->lastSize;
+    }
+    else
+    {
+        dataSize = CANTP_CHANNEL_CF_DATA_SIZE(channel);
+    }
+
+    frame = channel->frame;
+    dataPos = CANTP_DATA_POS(CANTP_CHANNEL_PCI(channel));
+    id = channel->chnCfg->txId;
+    frameSize = dataSize + dataPos;
+    BL_DEBUG_ASSERT_NO_RET(dataSize != 0);
+    BL_DEBUG_ASSERT_NO_RET(frameSize <= CANTP_MAX_FRAME_SIZE);
+
+    /*If the data is not ready, try again during the next period.*/
+    ret = CANTP_COPY_TX_DATA(channel,dataSize, &frame[dataPos]);
+
+    if (ERR_OK == ret)
+    {
+        frameSize = _Cantp_PadFrame(frame, frameSize);
+
+        ret = CANTP_LL_TRANSMIT(channel->chnCfg->ctrl, frame, id,frameSize);
+    }
+
+    if (ERR_OK == ret)
+    {
+        channel->cfCnt = cfCounter;
+        CANTP_SUB_STATUS_GOTO_TRAN(channel);
+        CANTP_FRAME_TRANSMITTED(CANTP_GET_TX_HANDLE(channel));
+        gs_TransmittingChannel[0] = channel;
+        Cantp_TxConfirmation(id);
+    }
+
+    return ;
+}
+
+/**************************************************************************//**
+ *
+ *  \details    The timeout function is used for the tranCF status of a channel.
+ *
+ *  \param[in/out]  channel - the pointer of a channel.
+ *
+ *  \return If the timeout event is processed return ERR_OK, otherwise
+ *          return ERR_ERROR.
+ *
+ *  \since  V5.1.0
+ *
+ *****************************************************************************/
+static UINT8 _Cantp_TimeoutTranCF(bl_CanTpChannel_t *channel)
+{
+#if (CANTP_FUN_RESUMABLE_TRANSFER == ON)
+    _Cantp_SaveResumeOffset(channel);
+#else
+    (void)channel;
+#endif
+    /*The As timeout.*/
+    CANTP_TX_CONFIRMATION(channel,ERR_ERROR);
+    return ERR_OK;
+}
+
+/**************************************************************************//**
+ *
+ *  \details    The period function is used for the recvFC status of a channel.
+ *
+ *  \param[in/out]  channel - the pointer of a channel.
+ *
+ *  \return None
+ *
+ *  \since V5.1.0
+ *
+ *****************************************************************************/
+static void _Cantp_PeriodRecvFC(bl_CanTpChannel_t *channel)
+{
+    (void)channel;
+    return ;
+}
+
+/**************************************************************************//**
+ *
+ *  \details    The timeout function is used for the recvFC status of a channel.
+ *
+ *  \param[in/out]  channel - the pointer of a channel.
+ *
+ *  \return If the timeout event is processed return ERR_OK, otherwise
+ *          return ERR_ERROR.
+ *
+ *  \since  V5.1.0
+ *
+ *****************************************************************************/
+static UINT8 _Cantp_TimeoutRecvFC(bl_CanTpChannel_t *channel)
+{
+#if (CANTP_FUN_RESUMABLE_TRANSFER == ON)
+    _Cantp_SaveResumeOffset(channel);
+#else
+    (void)channel;
+#endif
+    /*The Bs timeout.*/
+    CANTP_TX_CONFIRMATION(channel,ERR_ERROR);
+    return ERR_OK;
+}
+
+
+
+/*************************************************************************************************************
+                                          End Of File
+*************************************************************************************************************/
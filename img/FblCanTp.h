@@ -1,119 +1,249 @@
-/*************************************************************************************************************
-*    FileName   :    FblCanTp.h
-*    Description:    FblCanTp module header file. 
-
-*    UpdateDate :    2022/3/7
-*    Version    :    1.0.0
-*    History    :         
-        1. V1.0.0, 2022/3/7, R553, Initial version.
-
-*************************************************************************************************************/
-#ifndef _FBLCANTP_H_   
-#define _FBLCANTP_H_
-
-/*************************************************************************************************************
-                                          Header File Includes
-*************************************************************************************************************/
-#include "typedef.h"
-#include "FblConfig.h"
-
-
-/*************************************************************************************************************
-                                                Macros
-*************************************************************************************************************/
-
-/*****************************************************************************
- *  Macro Definitions
- *****************************************************************************/
-#define CANTP_TYPE_STANDARD         (0u)
-#define CANTP_TYPE_EXTENDED         (1u)
-#define CANTP_TYPE_MIXED            (2u)
-#define CANTP_TYPE_STANDARD_CANFD   (3u)
-#define CANTP_TYPE_EXTENDED_CANFD   (4u)
-#define CANTP_TYPE_MIXED_CANFD      (5u)
-
-#define CANTP_TATYPE_PHYSICAL       (0u)
-#define CANTP_TATYPE_FUNCTIONAL     (1u)
-
-#if (ENABLE_CANFD == ON)
-    #define CANTP_MAX_FRAME_SIZE    (0x40u)    /* CANFD frame max size*/
-
-#else
-    #define CANTP_MAX_FRAME_SIZE    (0x08u)    /* CAN frame max size*/
-#endif
-
-#define CANTP_CHNNEL_RX_CR          (g_CanTpRxChnsCfg[0].timerC)
-
-#define GET_LOW_HALF(byte)          ((byte) & 0x0Fu)
-#define GET_HIGH_HALF(byte)         ((byte) & 0xF0u)
-
-#define CANTP_PHYSICAL_CHANNEL_RX   (0u)
-#define CANTP_FUNCATION_CHANNEL_RX  (1u)
-#define CANTP_PHYSICAL_CHANNEL_TX   (0u)
-
-
-/*****************************************************************************
- *  Structure Definitions
- *****************************************************************************/
-/** \brief The channel configuration informations for the CAN TP.*/
-struct _tag_CanTpChannelCfg
-{
-    UINT8 type;   /**< The type of a tp channel.*/
-    UINT8 taType; /**< The TA type of a tp channel.*/
-    UINT16 rxId;  /**< RX ID from CanIf.*/
-    UINT16 txId;  /**< TX ID to CanIf.*/
-    UINT16 timerA;        /**< The timer A is used to send a can frame.*/
-    UINT16 timerB;        /**< The timer B is used to wait for the FC frame.*/
-    UINT16 timerC;        /**< The timer C is used to wait for the CF frame.*/
-    UINT8 ta;     /**< The TA of a tp channel.*/
-    UINT8 st;     /**< The STmin of a tp channel.*/
-    UINT8 bs;     /**< The block size of a tp channel.*/
-    UINT8 wft;    /**< The max wft of a tp channel.*/
-};
-
-
-
-/*****************************************************************************
- *  Type Declarations
- *****************************************************************************/
-/** \brief A alias of the struct _tag_CanTpChannelCfg.*/
-typedef struct _tag_CanTpChannelCfg bl_CanTpChannelCfg_t;
-/** \brief The can tp handle.*/
-typedef UINT16 bl_CanTpHandle_t;
-/** \brief The Result of the Rx or Tx.*/
-typedef UINT8 bl_CanTpResult_t;
-
-typedef UINT16 bl_BufferSize_t;   /**< The size of a buffer.*/
-typedef UINT8 bl_Buffer_t;        /**< The type for buffer.*/
-
-/*****************************************************************************
- *  External Global Variable Declarations
- *****************************************************************************/
-
-/*****************************************************************************
- *  External Function Prototype Declarations
- *****************************************************************************/
- 
-extern UINT8 FblCanTpColdInit(void);
-
-extern UINT8 FblCanTpWarmInit(void);
-
-extern void FblCanTpTask(UINT16 uwEventId,UINT8 *pucData);
-
-/** \brief the period function of the can tp module*/
-extern void Cantp_PeriodFunction(void);
-/** \brief Transmit a data.*/
-extern UINT8 Cantp_Transmit(bl_CanTpHandle_t handle,
-                                    bl_BufferSize_t size);
-/** \brief Indicate a frame to be received.*/
-extern void Cantp_RxIndication(UINT16 handle,
-                                bl_BufferSize_t size,
-                                const bl_Buffer_t *buffer);
-/** \brief Confire a frame to be transmitted.*/
-extern void Cantp_TxConfirmation(UINT16 id);
-
-/*************************************************************************************************************
-                                               End Of File
-*************************************************************************************************************/
-#endif 
-
+/*************************************************************************************************************
+*    FileName   :    FblCanTp.h
+*    Description:    FblCanTp module header file. 
+
+*    UpdateDate :    2022/3/7
+*    Version    :    1.0.0
+*    History    :         
+        1. V1.0.0, 2022/3/7, R553, Initial version.
+
+*************************************************************************************************************/
+#ifndef _FBLCANTP_H_   
+#define _FBLCANTP_H_
+
+/*************************************************************************************************************
+                                          Header File Includes
+*************************************************************************************************************/
+#include "typedef.h"
+#include "FblConfig.h"
+
+
+/*************************************************************************************************************
+                                                Macros
+*************************************************************************************************************/
+
+/*****************************************************************************
+ *  Macro Definitions
+ *****************************************************************************/
+/* The CANFD types are same as the other types, the frame size of a channel
+   is selected by its TX_DL and the RX_DL of the received frames.*/
+#define CANTP_TYPE_STANDARD         (0u)
+#define CANTP_TYPE_EXTENDED         (1u)
+#define CANTP_TYPE_MIXED            (2u)
+#define CANTP_TYPE_STANDARD_CANFD   (3u)
+#define CANTP_TYPE_EXTENDED_CANFD   (4u)
+#define CANTP_TYPE_MIXED_CANFD      (5u)
+/* The normal fixed and mixed 29-bit types encode the TA and SA in the
+   29-bit id, the PCI layouts are same as the standard and mixed types.*/
+#define CANTP_TYPE_NORMAL_FIXED     (6u)
+#define CANTP_TYPE_MIXED_29         (7u)
+
+#define CANTP_TATYPE_PHYSICAL       (0u)
+#define CANTP_TATYPE_FUNCTIONAL     (1u)
+
+#define CANTP_DEFAULT_CTRL          (0u)
+
+/** \brief The flag of a 29-bit id passed with the CAN driver.*/
+#define CANTP_ID_EXTENDED           (0x80000000uL)
+/** \brief The 29-bit ids of the normal fixed and mixed 29-bit addressing,
+    the TA is in bits 8-15 and the SA is in bits 0-7.*/
+#define CANTP_FIXED_ID_PHYSICAL     (0x18DA0000uL)
+#define CANTP_FIXED_ID_FUNCTIONAL   (0x18DB0000uL)
+#define CANTP_MIXED29_ID_PHYSICAL   (0x18CE0000uL)
+#define CANTP_MIXED29_ID_FUNCTIONAL (0x18CD0000uL)
+#define CANTP_MAKE_FIXED_ID(base,ta,sa) (CANTP_ID_EXTENDED | (UINT32)(base) \
+                                        | ((UINT32)(ta) << 8) | (UINT32)(sa))
+#define CANTP_GET_ID_TA(id)         ((UINT8)((id) >> 8))
+#define CANTP_GET_ID_SA(id)         ((UINT8)(id))
+
+#ifndef ENABLE_CANXL
+    #define ENABLE_CANXL            OFF
+#endif
+
+#define CANTP_CLASSIC_FRAME_SIZE    (0x08u)    /* CAN frame size*/
+#define CANTP_CANFD_FRAME_SIZE      (0x40u)    /* CANFD frame max size*/
+#define CANTP_CANXL_FRAME_SIZE      (0x800u)   /* CANXL frame max size*/
+
+#if (ENABLE_CANXL == ON)
+    #define CANTP_MAX_FRAME_SIZE    CANTP_CANXL_FRAME_SIZE
+#elif (ENABLE_CANFD == ON)
+    #define CANTP_MAX_FRAME_SIZE    CANTP_CANFD_FRAME_SIZE
+
+#else
+    #define CANTP_MAX_FRAME_SIZE    (0x08u)    /* CAN frame max size*/
+#endif
+
+#define CANTP_CHNNEL_RX_CR          (g_CanTpRxChnsCfg[0].timerC)
+
+#define GET_LOW_HALF(byte)          ((byte) & 0x0Fu)
+#define GET_HIGH_HALF(byte)         ((byte) & 0xF0u)
+
+#define CANTP_PHYSICAL_CHANNEL_RX   (0u)
+#define CANTP_FUNCATION_CHANNEL_RX  (1u)
+#define CANTP_PHYSICAL_CHANNEL_TX   (0u)
+
+/** \brief The TX_DL of a tx channel follows the RX_DL of the last frame
+    received by its paired rx channel.*/
+#define CANTP_TX_DL_AUTO            (0u)
+/** \brief The max frame size of a channel is CANTP_MAX_FRAME_SIZE.*/
+#define CANTP_MAX_DL_DEFAULT        (0u)
+
+#define CANTP_MULTICAST_OFF         (0u)
+#define CANTP_MULTICAST_LEADER      (1u)
+#define CANTP_MULTICAST_FOLLOWER    (2u)
+
+/** \brief The FC parameters of a rx channel, read and changed at runtime.*/
+#define CANTP_PARAMETER_BS          (0u)
+#define CANTP_PARAMETER_STMIN       (1u)
+
+
+/*****************************************************************************
+ *  Type Declarations
+ *****************************************************************************/
+/** \brief A alias of the struct _tag_CanTpChannelCfg.*/
+typedef struct _tag_CanTpChannelCfg bl_CanTpChannelCfg_t;
+/** \brief A alias of the struct _tag_CanTpFrame.*/
+typedef struct _tag_CanTpFrame bl_CanTpFrame_t;
+/** \brief The can tp handle.*/
+typedef UINT16 bl_CanTpHandle_t;
+/** \brief The Result of the Rx or Tx.*/
+typedef UINT8 bl_CanTpResult_t;
+
+typedef UINT16 bl_BufferSize_t;   /**< The size of a buffer.*/
+typedef UINT8 bl_Buffer_t;        /**< The type for buffer.*/
+
+/*****************************************************************************
+ *  Structure Definitions
+ *****************************************************************************/
+/** \brief The channel configuration informations for the CAN TP.*/
+struct _tag_CanTpChannelCfg
+{
+    UINT8 type;   /**< The type of a tp channel.*/
+    UINT8 taType; /**< The TA type of a tp channel.*/
+    UINT32 rxId;  /**< RX ID from CanIf.*/
+    UINT32 txId;  /**< TX ID to CanIf.*/
+    UINT16 timerA;        /**< The timer A is used to send a can frame.*/
+    UINT16 timerB;        /**< The timer B is used to wait for the FC frame.*/
+    UINT16 timerC;        /**< The timer C is used to wait for the CF frame.*/
+    UINT8 ta;     /**< The TA of a tp channel.*/
+    UINT8 st;     /**< The STmin of a tp channel.*/
+    UINT8 bs;     /**< The block size of a tp channel.*/
+    UINT8 wft;    /**< The max wft of a tp channel.*/
+    UINT8 ctrl;   /**< The CAN controller of a tp channel.*/
+    UINT16 txDl;  /**< The TX_DL of a tp channel, or CANTP_TX_DL_AUTO.*/
+    UINT16 maxDl; /**< The max size of the frames of a tp channel, or
+                       CANTP_MAX_DL_DEFAULT.*/
+};
+
+
+
+/** \brief A frame indicated by the CAN driver.*/
+struct _tag_CanTpFrame
+{
+    UINT8 ctrl;                 /**< The CAN controller receiving the frame.*/
+    UINT32 id;                  /**< The id of the frame.*/
+    bl_BufferSize_t size;       /**< The size of the frame.*/
+    const bl_Buffer_t *buffer;  /**< The contents of the frame.*/
+};
+
+/*****************************************************************************
+ *  External Global Variable Declarations
+ *****************************************************************************/
+
+/*****************************************************************************
+ *  External Function Prototype Declarations
+ *****************************************************************************/
+ 
+extern UINT8 FblCanTpColdInit(void);
+
+extern UINT8 FblCanTpWarmInit(void);
+
+extern void FblCanTpTask(UINT16 uwEventId,UINT8 *pucData);
+
+/** \brief the period function of the can tp module*/
+extern void Cantp_PeriodFunction(void);
+/** \brief Transmit a data.*/
+extern UINT8 Cantp_Transmit(bl_CanTpHandle_t handle,
+                                    bl_BufferSize_t size);
+/** \brief Indicate a frame to be received.*/
+extern void Cantp_RxIndication(UINT32 id,
+                                bl_BufferSize_t size,
+                                const bl_Buffer_t *buffer);
+/** \brief Indicate a frame to be received by a CAN controller.*/
+extern void Cantp_CtrlRxIndication(UINT8 ctrl,
+                                    UINT32 id,
+                                    bl_BufferSize_t size,
+                                    const bl_Buffer_t *buffer);
+/** \brief Indicate the frames drained from the RX FIFO at once.*/
+extern void Cantp_RxIndicationBatch(const bl_CanTpFrame_t *frames,
+                                    UINT16 count);
+/** \brief Queue a frame received by a CAN controller in the CAN ISR.*/
+extern UINT8 Cantp_QueueRxIndication(UINT8 ctrl,
+                                    UINT32 id,
+                                    bl_BufferSize_t size,
+                                    const bl_Buffer_t *buffer);
+/** \brief Get the count of the frames lost by the full rx queue.*/
+extern UINT32 Cantp_GetRxQueueOverflow(void);
+/** \brief Confire a frame to be transmitted.*/
+extern void Cantp_TxConfirmation(UINT32 id);
+/** \brief Set the mode of the multicast transfer on functional channels.*/
+extern UINT8 Cantp_SetMulticastMode(UINT8 mode);
+/** \brief Get the catch-up offset of the last multicast transfer.*/
+extern UINT8 Cantp_GetCatchUpOffset(bl_CanTpHandle_t handle,
+                                    bl_BufferSize_t *offset);
+/** \brief Get the checkpoint of the last aborted reception.*/
+extern UINT8 Cantp_GetRxResumeOffset(bl_CanTpHandle_t handle,
+                                        bl_BufferSize_t *offset);
+/** \brief Get the checkpoint of the last aborted transmission.*/
+extern UINT8 Cantp_GetTxResumeOffset(bl_CanTpHandle_t handle,
+                                        bl_BufferSize_t *offset);
+/** \brief Save the pending request in the record of the warm handover.*/
+extern UINT8 Cantp_SaveHandover(bl_CanTpHandle_t handle,
+                                bl_BufferSize_t size,
+                                const bl_Buffer_t *buffer);
+/** \brief Transmit a data from a buffer of the upper layer.*/
+extern UINT8 Cantp_TransmitData(bl_CanTpHandle_t handle,
+                                bl_BufferSize_t size,
+                                const bl_Buffer_t *data);
+/** \brief Transmit a data from an offset of the message.*/
+extern UINT8 Cantp_TransmitFrom(bl_CanTpHandle_t handle,
+                                bl_BufferSize_t size,
+                                bl_BufferSize_t offset);
+/** \brief Set the offset of the next reception in the whole message.*/
+extern void Cantp_ReceiveFrom(bl_CanTpHandle_t handle,
+                                bl_BufferSize_t offset);
+/** \brief Change a FC parameter of a rx channel.*/
+extern UINT8 Cantp_ChangeParameter(bl_CanTpHandle_t handle,
+                                    UINT8 parameter,
+                                    UINT16 value);
+/** \brief Read a FC parameter of a rx channel.*/
+extern UINT8 Cantp_ReadParameter(bl_CanTpHandle_t handle,
+                                    UINT8 parameter,
+                                    UINT16 *value);
+
+/*****************************************************************************
+ *  Upper Layer Interfaces Of The Client Role
+ *****************************************************************************/
+/** \brief Request a buffer to receive a response.*/
+extern UINT8 Tester_StartOfReception(bl_CanTpHandle_t handle,
+                                        bl_BufferSize_t size);
+/** \brief Copy the received data of a response.*/
+extern UINT8 Tester_CopyRxData(bl_CanTpHandle_t handle,
+                                bl_BufferSize_t size,
+                                const bl_Buffer_t *buffer);
+/** \brief Indicate a response is received.*/
+extern void Tester_RxIndication(bl_CanTpHandle_t handle,
+                                bl_CanTpResult_t result);
+/** \brief Copy the transmitting data of a request.*/
+extern UINT8 Tester_CopyTxData(bl_CanTpHandle_t handle,
+                                bl_BufferSize_t size,
+                                bl_Buffer_t *buffer);
+/** \brief Confirm a request is transmitted.*/
+extern void Tester_TxConfirmation(bl_CanTpHandle_t handle,
+                                    bl_CanTpResult_t result);
+
+/*************************************************************************************************************
+                                               End Of File
+*************************************************************************************************************/
+#endif 
+
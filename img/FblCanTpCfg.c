@@ -1,89 +1,492 @@
-
-#include "FblCanTpCfg.h"
-
-/*****************************************************************************
- *  Verify The Configurations of Function Macro
- *****************************************************************************/
-
-/*****************************************************************************
- *  Internal Macro Definitions
- *****************************************************************************/
-#define CANTP_MAKE_TIMEOUT(ms)  ((UINT16)((ms)/CANTP_SCHEDULE_PERIOD)) 
-
-/*****************************************************************************
- *  Internal Type Definitions
- *****************************************************************************/
-
-/*****************************************************************************
- *  Internal Structure Definitions
- *****************************************************************************/
-
-/*****************************************************************************
- *  Internal Function Declarations
- *****************************************************************************/
-
-/*****************************************************************************
- *  Internal Variable Definitions
- *****************************************************************************/
-
-/*****************************************************************************
- *  Global Variable Definitions
- *****************************************************************************/
- 
-/** \brief the configurations of the Rx channels.*/
-const bl_CanTpChannelCfg_t g_CanTpRxChnsCfg[CANTP_NUMBER_OF_RX_CHANNEL] =
-{
-    /*Channel 0:Phsical & Standars addressing*/
-    {
-        CANTP_TYPE_STANDARD,
-        CANTP_TATYPE_PHYSICAL,
-        FBL_CAN_RX_ID_PHY,  /* RX ID */
-        FBL_CAN_TX_ID_PHY,  /* TX ID */
-        CANTP_MAKE_TIMEOUT(TPL_TIMER_AR),     /* TIME A */
-        CANTP_MAKE_TIMEOUT(TPL_TIMER_BR),     /* TIME B */
-        CANTP_MAKE_TIMEOUT(TPL_TIMER_CR),    /* TIME C */
-        0,  /* TA */
-        STMIN_ECU,  /* STmin */
-        BS_ECU,  /* BS */
-        15u,  /* WFT */
-    },
-    /*Channel 1:functional & Standars addressing*/
-    {
-        CANTP_TYPE_STANDARD,
-        CANTP_TATYPE_FUNCTIONAL,
-        FBL_CAN_RX_ID_FUN,  /* RX ID */
-        FBL_CAN_TX_ID_PHY,  /* TX ID */
-        CANTP_MAKE_TIMEOUT(TPL_TIMER_AR),     /* TIME A */
-        CANTP_MAKE_TIMEOUT(TPL_TIMER_BR),     /* TIME B */
-        CANTP_MAKE_TIMEOUT(TPL_TIMER_CR),    /* TIME C */
-        0,  /* TA */
-        STMIN_ECU,  /* STmin */
-        BS_ECU,  /* BS */
-        15u,  /* WFT */
-    },
-};
-
-/** \brief the configurations of the Tx channels.*/
-const bl_CanTpChannelCfg_t g_CanTpTxChnsCfg[CANTP_NUMBER_OF_TX_CHANNEL] =
-{
-    /*Channel 0:Phsical & Standars addressing*/
-    {
-        CANTP_TYPE_STANDARD,
-        CANTP_TATYPE_PHYSICAL,
-        FBL_CAN_RX_ID_PHY,  /* RX HANDLE */
-        FBL_CAN_TX_ID_PHY,  /* TX HANDLE */
-        CANTP_MAKE_TIMEOUT(TPL_TIMER_AS),     /* TIME A */
-        CANTP_MAKE_TIMEOUT(TPL_TIMER_BS),    /* TIME B */
-        CANTP_MAKE_TIMEOUT(TPL_TIMER_CS),     /* TIME C */
-        0,  /* TA */
-        STMIN_ECU,  /* STmin */
-        BS_ECU,  /* BS */
-        15u,  /* WFT */
-    },
-};
-
-/*****************************************************************************
- *  Function Definitions
- *****************************************************************************/
-
-
+
+#include "FblCanTpCfg.h"
+#if (CANTP_FUN_GATEWAY_ROUTING == ON)
+#include "FblCanTpRoute.h"
+#endif
+#if (CANTP_FUN_DOIP_GATEWAY == ON)
+#include "FblCanTpDoIp.h"
+#endif
+
+/*****************************************************************************
+ *  Verify The Configurations of Function Macro
+ *****************************************************************************/
+#if ((CANTP_FUN_CLIENT_SCHEDULER == ON) && (CANTP_ROLE != CANTP_ROLE_CLIENT))
+#error "The scheduler of the cantp module is only used by the client role."
+#endif
+
+#if ((CANTP_ROLE == CANTP_ROLE_CLIENT) \
+    && ((CANTP_NUMBER_OF_CLIENT_SESSION < 1) || (CANTP_NUMBER_OF_CLIENT_SESSION > 8)))
+#error "The number of the client sessions shall be 1 to 8."
+#endif
+
+#if ((CANTP_FUN_FIXED_ADDRESSING == ON) && (CANTP_ROLE != CANTP_ROLE_SERVER))
+#error "The pool of the fixed addressing is only used by the server role."
+#endif
+
+#if ((CANTP_FUN_FIXED_ADDRESSING == ON) && (CANTP_NUMBER_OF_POOL_CHANNEL >= 0xFF))
+#error "The pool of the fixed addressing is too large."
+#endif
+
+#if ((CANTP_FUN_RX_QUEUE == ON) \
+    && ((0u == CANTP_RX_QUEUE_SIZE) || (CANTP_RX_QUEUE_SIZE > 0x8000u) \
+        || (0u != (CANTP_RX_QUEUE_SIZE & (CANTP_RX_QUEUE_SIZE - 1u)))))
+#error "The size of the rx queue shall be a power of 2 and not bigger than 0x8000."
+#endif
+
+#if ((CANTP_FUN_RX_QUEUE == ON) \
+    && ((0u == CANTP_RX_QUEUE_BUDGET) || (CANTP_RX_QUEUE_BUDGET > CANTP_RX_QUEUE_SIZE)))
+#error "The budget of the rx queue shall be 1 to the size of the queue."
+#endif
+
+#if ((CANTP_FUN_INLINE_FLOW_CONTROL == ON) && (CANTP_FUN_RX_QUEUE == OFF))
+#error "The inline FC calls the upper layer at once, the frames shall be indicated in the task by the rx queue."
+#endif
+
+#if ((CANTP_FUN_FRAME_POOL == ON) \
+    && ((0u == CANTP_NUMBER_OF_FRAME_BUFFER) \
+        || (0u == CANTP_NUMBER_OF_CLASSIC_BUFFER) \
+        || (CANTP_NUMBER_OF_FRAME_BUFFER >= 0x80u) \
+        || (CANTP_NUMBER_OF_CLASSIC_BUFFER >= 0x80u)))
+#error "The number of each kind of the frame buffers shall be 1 to 127."
+#endif
+
+#if ((CANTP_FUN_RX_SF_QUEUE == ON) \
+    && ((0u == CANTP_RX_SF_QUEUE_SIZE) || (CANTP_RX_SF_QUEUE_SIZE > 0x40u) \
+        || (0u != (CANTP_RX_SF_QUEUE_SIZE & (CANTP_RX_SF_QUEUE_SIZE - 1u)))))
+#error "The size of the SF queue shall be a power of 2, 1 to 64."
+#endif
+
+#if ((CANTP_FUN_TX_REQUEST_QUEUE == ON) \
+    && ((0u == CANTP_TX_REQUEST_QUEUE_SIZE) || (CANTP_TX_REQUEST_QUEUE_SIZE > 0x40u) \
+        || (0u != (CANTP_TX_REQUEST_QUEUE_SIZE & (CANTP_TX_REQUEST_QUEUE_SIZE - 1u)))))
+#error "The size of the tx request queue shall be a power of 2, 1 to 64."
+#endif
+
+#if ((CANTP_FUN_TX_REQUEST_QUEUE == ON) \
+    && ((CANTP_FUN_GATEWAY_ROUTING == ON) || (CANTP_FUN_DOIP_GATEWAY == ON) \
+        || (CANTP_FUN_STREAM_DEDUP == ON)))
+#error "The gateways and the block queries need a busy tx channel to refuse a message."
+#endif
+
+#if ((CANTP_FUN_RX_STREAM == ON) && (CANTP_ROLE != CANTP_ROLE_SERVER))
+#error "The stream of the cantp module is only used by the server role."
+#endif
+
+#if (((CANTP_FUN_STREAM_CRC32 == ON) || (CANTP_FUN_STREAM_SHA256 == ON)) \
+    && (CANTP_FUN_RX_STREAM == OFF))
+#error "The digests of the download are calculated by the stream."
+#endif
+
+#if ((CANTP_FUN_STREAM_DEDUP == ON) && (CANTP_FUN_RX_STREAM == OFF))
+#error "The block queries are answered by the stream."
+#endif
+
+#if ((CANTP_FUN_GATEWAY_ROUTING == ON) && (CANTP_ROLE != CANTP_ROLE_SERVER))
+#error "The routes of the cantp module are only used by the server role."
+#endif
+
+#if ((CANTP_FUN_DOIP_GATEWAY == ON) && (CANTP_ROLE != CANTP_ROLE_SERVER))
+#error "The DoIP gateway of the cantp module is only used by the server role."
+#endif
+
+#if ((CANTP_FUN_DOIP_GATEWAY == ON) && (CANTP_FUN_GATEWAY_ROUTING == ON))
+#error "The DoIP gateway and the routes are not used at the same time."
+#endif
+
+#if ((CANTP_FUN_GATEWAY_ROUTING == ON) && (CANTP_LL_CTRL_TRANSMIT == OFF))
+#error "The routes transmit on the sub bus, the CAN driver shall transmit on each controller."
+#endif
+
+#if ((CANTP_FUN_GATEWAY_ROUTING == ON) \
+    && (CANTP_ROUTE_WINDOW_SIZE < (2u * CANTP_MAX_FRAME_SIZE)))
+#error "The window of the routes shall buffer two frames at least."
+#endif
+
+#if ((CANTP_FUN_DOIP_GATEWAY == ON) && (CANTP_LL_CTRL_TRANSMIT == OFF))
+#error "The DoIP nodes are on their own controllers, the CAN driver shall transmit on each controller."
+#endif
+
+#if ((CANTP_FUN_DOIP_GATEWAY == ON) \
+    && (CANTP_DOIP_BUFFER_SIZE < (2u * CANTP_MAX_FRAME_SIZE)))
+#error "The buffer of the DoIP connections shall buffer two frames at least."
+#endif
+
+/*****************************************************************************
+ *  Internal Macro Definitions
+ *****************************************************************************/
+#define CANTP_MAKE_TIMEOUT(ms)  ((UINT16)((ms)/CANTP_SCHEDULE_PERIOD)) 
+
+#if (CANTP_ROLE == CANTP_ROLE_CLIENT)
+/** \brief The rx channel of a client session, receive the responses.*/
+#define CANTP_CLIENT_RX_CHANNEL(s)  \
+    { \
+        CANTP_TYPE_STANDARD, \
+        CANTP_TATYPE_PHYSICAL, \
+        CANTP_CLIENT_RSP_ID(s),  /* RX ID */ \
+        CANTP_CLIENT_REQ_ID(s),  /* TX ID */ \
+        CANTP_MAKE_TIMEOUT(TPL_TIMER_AR),     /* TIME A */ \
+        CANTP_MAKE_TIMEOUT(TPL_TIMER_BR),     /* TIME B */ \
+        CANTP_MAKE_TIMEOUT(TPL_TIMER_CR),    /* TIME C */ \
+        0,  /* TA */ \
+        CANTP_CLIENT_STMIN,  /* STmin */ \
+        CANTP_CLIENT_BS,  /* BS */ \
+        15u,  /* WFT */ \
+        CANTP_DEFAULT_CTRL,  /* CTRL */ \
+        CANTP_TX_DL_AUTO,  /* TX_DL */ \
+        CANTP_MAX_DL_DEFAULT,  /* MAX_DL */ \
+    }
+/** \brief The tx channel of a client session, transmit the requests.*/
+#define CANTP_CLIENT_TX_CHANNEL(s)  \
+    { \
+        CANTP_TYPE_STANDARD, \
+        CANTP_TATYPE_PHYSICAL, \
+        CANTP_CLIENT_RSP_ID(s),  /* RX HANDLE */ \
+        CANTP_CLIENT_REQ_ID(s),  /* TX HANDLE */ \
+        CANTP_MAKE_TIMEOUT(TPL_TIMER_AS),     /* TIME A */ \
+        CANTP_MAKE_TIMEOUT(TPL_TIMER_BS),    /* TIME B */ \
+        CANTP_MAKE_TIMEOUT(TPL_TIMER_CS),     /* TIME C */ \
+        0,  /* TA */ \
+        CANTP_CLIENT_STMIN,  /* STmin */ \
+        CANTP_CLIENT_BS,  /* BS */ \
+        15u,  /* WFT */ \
+        CANTP_DEFAULT_CTRL,  /* CTRL */ \
+        CANTP_CLIENT_TX_DL,  /* TX_DL */ \
+        CANTP_MAX_DL_DEFAULT,  /* MAX_DL */ \
+    }
+#endif
+
+/*****************************************************************************
+ *  Internal Type Definitions
+ *****************************************************************************/
+
+/*****************************************************************************
+ *  Internal Structure Definitions
+ *****************************************************************************/
+
+/*****************************************************************************
+ *  Internal Function Declarations
+ *****************************************************************************/
+
+/*****************************************************************************
+ *  Internal Variable Definitions
+ *****************************************************************************/
+
+/*****************************************************************************
+ *  Global Variable Definitions
+ *****************************************************************************/
+ 
+#if (CANTP_ROLE == CANTP_ROLE_CLIENT)
+/** \brief the configurations of the Rx channels.*/
+const bl_CanTpChannelCfg_t g_CanTpRxChnsCfg[CANTP_NUMBER_OF_RX_CHANNEL] =
+{
+    /*Channel s:Phsical & Standars addressing, receive the responses of
+      session s.*/
+    CANTP_CLIENT_RX_CHANNEL(0u),
+#if (CANTP_NUMBER_OF_CLIENT_SESSION > 1)
+    CANTP_CLIENT_RX_CHANNEL(1u),
+#endif
+#if (CANTP_NUMBER_OF_CLIENT_SESSION > 2)
+    CANTP_CLIENT_RX_CHANNEL(2u),
+#endif
+#if (CANTP_NUMBER_OF_CLIENT_SESSION > 3)
+    CANTP_CLIENT_RX_CHANNEL(3u),
+#endif
+#if (CANTP_NUMBER_OF_CLIENT_SESSION > 4)
+    CANTP_CLIENT_RX_CHANNEL(4u),
+#endif
+#if (CANTP_NUMBER_OF_CLIENT_SESSION > 5)
+    CANTP_CLIENT_RX_CHANNEL(5u),
+#endif
+#if (CANTP_NUMBER_OF_CLIENT_SESSION > 6)
+    CANTP_CLIENT_RX_CHANNEL(6u),
+#endif
+#if (CANTP_NUMBER_OF_CLIENT_SESSION > 7)
+    CANTP_CLIENT_RX_CHANNEL(7u),
+#endif
+};
+
+/** \brief the configurations of the Tx channels.*/
+const bl_CanTpChannelCfg_t g_CanTpTxChnsCfg[CANTP_NUMBER_OF_TX_CHANNEL] =
+{
+    /*Channel s:Phsical & Standars addressing, transmit the requests of
+      session s.*/
+    CANTP_CLIENT_TX_CHANNEL(0u),
+#if (CANTP_NUMBER_OF_CLIENT_SESSION > 1)
+    CANTP_CLIENT_TX_CHANNEL(1u),
+#endif
+#if (CANTP_NUMBER_OF_CLIENT_SESSION > 2)
+    CANTP_CLIENT_TX_CHANNEL(2u),
+#endif
+#if (CANTP_NUMBER_OF_CLIENT_SESSION > 3)
+    CANTP_CLIENT_TX_CHANNEL(3u),
+#endif
+#if (CANTP_NUMBER_OF_CLIENT_SESSION > 4)
+    CANTP_CLIENT_TX_CHANNEL(4u),
+#endif
+#if (CANTP_NUMBER_OF_CLIENT_SESSION > 5)
+    CANTP_CLIENT_TX_CHANNEL(5u),
+#endif
+#if (CANTP_NUMBER_OF_CLIENT_SESSION > 6)
+    CANTP_CLIENT_TX_CHANNEL(6u),
+#endif
+#if (CANTP_NUMBER_OF_CLIENT_SESSION > 7)
+    CANTP_CLIENT_TX_CHANNEL(7u),
+#endif
+    /*Channel CANTP_FUNCATION_CHANNEL_TX:functional & Standars addressing,
+      transmit the SF requests*/
+    {
+        CANTP_TYPE_STANDARD,
+        CANTP_TATYPE_FUNCTIONAL,
+        FBL_CAN_TX_ID_PHY,  /* RX HANDLE */
+        FBL_CAN_RX_ID_FUN,  /* TX HANDLE */
+        CANTP_MAKE_TIMEOUT(TPL_TIMER_AS),     /* TIME A */
+        CANTP_MAKE_TIMEOUT(TPL_TIMER_BS),    /* TIME B */
+        CANTP_MAKE_TIMEOUT(TPL_TIMER_CS),     /* TIME C */
+        0,  /* TA */
+        CANTP_CLIENT_STMIN,  /* STmin */
+        CANTP_CLIENT_BS,  /* BS */
+        15u,  /* WFT */
+        CANTP_DEFAULT_CTRL,  /* CTRL */
+        CANTP_CLIENT_TX_DL,  /* TX_DL */
+        CANTP_MAX_DL_DEFAULT,  /* MAX_DL */
+    },
+};
+#else
+/** \brief the configurations of the Rx channels.*/
+const bl_CanTpChannelCfg_t g_CanTpRxChnsCfg[CANTP_NUMBER_OF_RX_CHANNEL] =
+{
+    /*Channel 0:Phsical & Standars addressing*/
+    {
+        CANTP_SERVER_TYPE,
+        CANTP_TATYPE_PHYSICAL,
+        CANTP_SERVER_RX_ID_PHY,  /* RX ID */
+        CANTP_SERVER_TX_ID_PHY,  /* TX ID */
+        CANTP_MAKE_TIMEOUT(TPL_TIMER_AR),     /* TIME A */
+        CANTP_MAKE_TIMEOUT(TPL_TIMER_BR),     /* TIME B */
+        CANTP_MAKE_TIMEOUT(TPL_TIMER_CR),    /* TIME C */
+        0,  /* TA */
+        STMIN_ECU,  /* STmin */
+        BS_ECU,  /* BS */
+        15u,  /* WFT */
+        CANTP_DEFAULT_CTRL,  /* CTRL */
+        CANTP_TX_DL_AUTO,  /* TX_DL */
+        CANTP_MAX_DL_DEFAULT,  /* MAX_DL */
+    },
+    /*Channel 1:functional & Standars addressing*/
+    {
+        CANTP_SERVER_TYPE,
+        CANTP_TATYPE_FUNCTIONAL,
+        CANTP_SERVER_RX_ID_FUN,  /* RX ID */
+        CANTP_SERVER_TX_ID_PHY,  /* TX ID */
+        CANTP_MAKE_TIMEOUT(TPL_TIMER_AR),     /* TIME A */
+        CANTP_MAKE_TIMEOUT(TPL_TIMER_BR),     /* TIME B */
+        CANTP_MAKE_TIMEOUT(TPL_TIMER_CR),    /* TIME C */
+        0,  /* TA */
+        STMIN_ECU,  /* STmin */
+        BS_ECU,  /* BS */
+        15u,  /* WFT */
+        CANTP_DEFAULT_CTRL,  /* CTRL */
+        CANTP_TX_DL_AUTO,  /* TX_DL */
+        CANTP_MAX_DL_DEFAULT,  /* MAX_DL */
+    },
+#if (CANTP_FUN_GATEWAY_ROUTING == ON)
+    /*Channel 2:Phsical & Standars addressing, receive the requests routed
+      to the sub bus*/
+    {
+        CANTP_TYPE_STANDARD,
+        CANTP_TATYPE_PHYSICAL,
+        CANTP_ROUTE_REQ_ID,  /* RX ID */
+        CANTP_ROUTE_RSP_ID,  /* TX ID */
+        CANTP_MAKE_TIMEOUT(TPL_TIMER_AR),     /* TIME A */
+        CANTP_MAKE_TIMEOUT(TPL_TIMER_BR),     /* TIME B */
+        CANTP_MAKE_TIMEOUT(TPL_TIMER_CR),    /* TIME C */
+        0,  /* TA */
+        STMIN_ECU,  /* STmin */
+        CANTP_ROUTE_BS,  /* BS */
+        15u,  /* WFT */
+        CANTP_DEFAULT_CTRL,  /* CTRL */
+        CANTP_TX_DL_AUTO,  /* TX_DL */
+        CANTP_MAX_DL_DEFAULT,  /* MAX_DL */
+    },
+    /*Channel 3:Phsical & Standars addressing, receive the responses on
+      the sub bus*/
+    {
+        CANTP_TYPE_STANDARD,
+        CANTP_TATYPE_PHYSICAL,
+        CANTP_ROUTE_RSP_ID,  /* RX ID */
+        CANTP_ROUTE_REQ_ID,  /* TX ID */
+        CANTP_MAKE_TIMEOUT(TPL_TIMER_AR),     /* TIME A */
+        CANTP_MAKE_TIMEOUT(TPL_TIMER_BR),     /* TIME B */
+        CANTP_MAKE_TIMEOUT(TPL_TIMER_CR),    /* TIME C */
+        0,  /* TA */
+        STMIN_ECU,  /* STmin */
+        CANTP_ROUTE_BS,  /* BS */
+        15u,  /* WFT */
+        CANTP_ROUTE_SUB_CTRL,  /* CTRL */
+        CANTP_TX_DL_AUTO,  /* TX_DL */
+        CANTP_MAX_DL_DEFAULT,  /* MAX_DL */
+    },
+#elif (CANTP_FUN_DOIP_GATEWAY == ON)
+    /*Channel 2:Phsical & Standars addressing, receive the responses of
+      the DoIP node 0*/
+    {
+        CANTP_TYPE_STANDARD,
+        CANTP_TATYPE_PHYSICAL,
+        CANTP_DOIP_NODE0_RSP_ID,  /* RX ID */
+        CANTP_DOIP_NODE0_REQ_ID,  /* TX ID */
+        CANTP_MAKE_TIMEOUT(TPL_TIMER_AR),     /* TIME A */
+        CANTP_MAKE_TIMEOUT(TPL_TIMER_BR),     /* TIME B */
+        CANTP_MAKE_TIMEOUT(TPL_TIMER_CR),    /* TIME C */
+        0,  /* TA */
+        STMIN_ECU,  /* STmin */
+        CANTP_DOIP_BS,  /* BS */
+        15u,  /* WFT */
+        CANTP_DOIP_NODE0_CTRL,  /* CTRL */
+        CANTP_TX_DL_AUTO,  /* TX_DL */
+        CANTP_MAX_DL_DEFAULT,  /* MAX_DL */
+    },
+    /*Channel 3:Phsical & Standars addressing, receive the responses of
+      the DoIP node 1*/
+    {
+        CANTP_TYPE_STANDARD,
+        CANTP_TATYPE_PHYSICAL,
+        CANTP_DOIP_NODE1_RSP_ID,  /* RX ID */
+        CANTP_DOIP_NODE1_REQ_ID,  /* TX ID */
+        CANTP_MAKE_TIMEOUT(TPL_TIMER_AR),     /* TIME A */
+        CANTP_MAKE_TIMEOUT(TPL_TIMER_BR),     /* TIME B */
+        CANTP_MAKE_TIMEOUT(TPL_TIMER_CR),    /* TIME C */
+        0,  /* TA */
+        STMIN_ECU,  /* STmin */
+        CANTP_DOIP_BS,  /* BS */
+        15u,  /* WFT */
+        CANTP_DOIP_NODE1_CTRL,  /* CTRL */
+        CANTP_TX_DL_AUTO,  /* TX_DL */
+        CANTP_MAX_DL_DEFAULT,  /* MAX_DL */
+    },
+#endif
+};
+
+/** \brief the configurations of the Tx channels.*/
+const bl_CanTpChannelCfg_t g_CanTpTxChnsCfg[CANTP_NUMBER_OF_TX_CHANNEL] =
+{
+    /*Channel 0:Phsical & Standars addressing*/
+    {
+        CANTP_SERVER_TYPE,
+        CANTP_TATYPE_PHYSICAL,
+        CANTP_SERVER_RX_ID_PHY,  /* RX HANDLE */
+        CANTP_SERVER_TX_ID_PHY,  /* TX HANDLE */
+        CANTP_MAKE_TIMEOUT(TPL_TIMER_AS),     /* TIME A */
+        CANTP_MAKE_TIMEOUT(TPL_TIMER_BS),    /* TIME B */
+        CANTP_MAKE_TIMEOUT(TPL_TIMER_CS),     /* TIME C */
+        0,  /* TA */
+        STMIN_ECU,  /* STmin */
+        BS_ECU,  /* BS */
+        15u,  /* WFT */
+        CANTP_DEFAULT_CTRL,  /* CTRL */
+        CANTP_SERVER_TX_DL,  /* TX_DL */
+        CANTP_MAX_DL_DEFAULT,  /* MAX_DL */
+    },
+#if (CANTP_FUN_GATEWAY_ROUTING == ON)
+    /*Channel 1:Phsical & Standars addressing, transmit the routed requests
+      on the sub bus*/
+    {
+        CANTP_TYPE_STANDARD,
+        CANTP_TATYPE_PHYSICAL,
+        CANTP_ROUTE_RSP_ID,  /* RX HANDLE */
+        CANTP_ROUTE_REQ_ID,  /* TX HANDLE */
+        CANTP_MAKE_TIMEOUT(TPL_TIMER_AS),     /* TIME A */
+        CANTP_MAKE_TIMEOUT(TPL_TIMER_BS),     /* TIME B */
+        CANTP_MAKE_TIMEOUT(TPL_TIMER_CS),    /* TIME C */
+        0,  /* TA */
+        STMIN_ECU,  /* STmin */
+        BS_ECU,  /* BS */
+        15u,  /* WFT */
+        CANTP_ROUTE_SUB_CTRL,  /* CTRL */
+        CANTP_ROUTE_TX_DL,  /* TX_DL */
+        CANTP_MAX_DL_DEFAULT,  /* MAX_DL */
+    },
+    /*Channel 2:Phsical & Standars addressing, transmit the routed responses*/
+    {
+        CANTP_TYPE_STANDARD,
+        CANTP_TATYPE_PHYSICAL,
+        CANTP_ROUTE_REQ_ID,  /* RX HANDLE */
+        CANTP_ROUTE_RSP_ID,  /* TX HANDLE */
+        CANTP_MAKE_TIMEOUT(TPL_TIMER_AS),     /* TIME A */
+        CANTP_MAKE_TIMEOUT(TPL_TIMER_BS),     /* TIME B */
+        CANTP_MAKE_TIMEOUT(TPL_TIMER_CS),    /* TIME C */
+        0,  /* TA */
+        STMIN_ECU,  /* STmin */
+        BS_ECU,  /* BS */
+        15u,  /* WFT */
+        CANTP_DEFAULT_CTRL,  /* CTRL */
+        CANTP_SERVER_TX_DL,  /* TX_DL */
+        CANTP_MAX_DL_DEFAULT,  /* MAX_DL */
+    },
+#elif (CANTP_FUN_DOIP_GATEWAY == ON)
+    /*Channel 1:Phsical & Standars addressing, transmit the requests to
+      the DoIP node 0*/
+    {
+        CANTP_TYPE_STANDARD,
+        CANTP_TATYPE_PHYSICAL,
+        CANTP_DOIP_NODE0_RSP_ID,  /* RX HANDLE */
+        CANTP_DOIP_NODE0_REQ_ID,  /* TX HANDLE */
+        CANTP_MAKE_TIMEOUT(TPL_TIMER_AS),     /* TIME A */
+        CANTP_MAKE_TIMEOUT(TPL_TIMER_BS),     /* TIME B */
+        CANTP_MAKE_TIMEOUT(TPL_TIMER_CS),    /* TIME C */
+        0,  /* TA */
+        STMIN_ECU,  /* STmin */
+        BS_ECU,  /* BS */
+        15u,  /* WFT */
+        CANTP_DOIP_NODE0_CTRL,  /* CTRL */
+        CANTP_DOIP_TX_DL,  /* TX_DL */
+        CANTP_MAX_DL_DEFAULT,  /* MAX_DL */
+    },
+    /*Channel 2:Phsical & Standars addressing, transmit the requests to
+      the DoIP node 1*/
+    {
+        CANTP_TYPE_STANDARD,
+        CANTP_TATYPE_PHYSICAL,
+        CANTP_DOIP_NODE1_RSP_ID,  /* RX HANDLE */
+        CANTP_DOIP_NODE1_REQ_ID,  /* TX HANDLE */
+        CANTP_MAKE_TIMEOUT(TPL_TIMER_AS),     /* TIME A */
+        CANTP_MAKE_TIMEOUT(TPL_TIMER_BS),     /* TIME B */
+        CANTP_MAKE_TIMEOUT(TPL_TIMER_CS),    /* TIME C */
+        0,  /* TA */
+        STMIN_ECU,  /* STmin */
+        BS_ECU,  /* BS */
+        15u,  /* WFT */
+        CANTP_DOIP_NODE1_CTRL,  /* CTRL */
+        CANTP_DOIP_TX_DL,  /* TX_DL */
+        CANTP_MAX_DL_DEFAULT,  /* MAX_DL */
+    },
+#endif
+};
+#endif
+
+#if (CANTP_FUN_GATEWAY_ROUTING == ON)
+/** \brief the configurations of the routes.*/
+const bl_CanTpRouteCfg_t g_CanTpRouteCfg[CANTP_NUMBER_OF_ROUTE] =
+{
+    /*Route 0:the requests from rx channel 2 to tx channel 1*/
+    {2u, 1u},
+    /*Route 1:the responses from rx channel 3 to tx channel 2*/
+    {3u, 2u},
+};
+#endif
+
+#if (CANTP_FUN_DOIP_GATEWAY == ON)
+/** \brief the configurations of the nodes of the DoIP gateway.*/
+const bl_CanTpDoIpCfg_t g_CanTpDoIpCfg[CANTP_NUMBER_OF_DOIP_NODE] =
+{
+    /*Node 0:rx channel 2 and tx channel 1*/
+    {CANTP_DOIP_NODE0_ADDR, 2u, 1u},
+    /*Node 1:rx channel 3 and tx channel 2*/
+    {CANTP_DOIP_NODE1_ADDR, 3u, 2u},
+};
+#endif
+
+/*****************************************************************************
+ *  Function Definitions
+ *****************************************************************************/
+
+
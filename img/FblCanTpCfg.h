@@ -1,46 +1,447 @@
-
-#ifndef _FBL_CAN_TP_CFG_H_
-#define _FBL_CAN_TP_CFG_H_
-#include "FblCanTp.h"
-
-/*****************************************************************************
- *  Macro Definitions
- *****************************************************************************/
-/** \brief The schedule period of the cantp module.*/
-#define CANTP_SCHEDULE_PERIOD           (2)
-
-/** \brief The number of rx channels of the cantp module.*/
-#define CANTP_NUMBER_OF_RX_CHANNEL      (2)
-/** \brief The number of tx channels of the cantp module.*/
-#define CANTP_NUMBER_OF_TX_CHANNEL      (1)
-
-/** \brief The frame padding function.*/
-#define CANTP_FUN_TX_FRAME_PADDING         ON
-#define CANTP_FUN_RX_FRAME_PADDING         ON
-/** \brief The frame padding value.*/
-#define CANTP_FRAME_PADDING_VALUE       (CANTP_FILLER_BYTE)
-
-/** \brief full duplex*/
-#define CANTP_FULL_DUPLEX               (0)
-/** \brief half duplex*/
-#define CANTP_HALF_DUPLEX               (1)
-/** \brief support full- or half-duplex communication*/
-#define CANTP_COMMUNICATION_DUPLEX      CANTP_HALF_DUPLEX
-
-/*****************************************************************************
- *  Structure Definitions
- *****************************************************************************/
-
-/*****************************************************************************
- *  External Global Variable Declarations
- *****************************************************************************/
-extern const bl_CanTpChannelCfg_t g_CanTpRxChnsCfg[CANTP_NUMBER_OF_RX_CHANNEL];
-
-extern const bl_CanTpChannelCfg_t g_CanTpTxChnsCfg[CANTP_NUMBER_OF_TX_CHANNEL];
-
-/*****************************************************************************
- *  External Function Prototype Declarations
- *****************************************************************************/
-
-#endif
-
+
+#ifndef _FBL_CAN_TP_CFG_H_
+#define _FBL_CAN_TP_CFG_H_
+#include "FblCanTp.h"
+
+/*****************************************************************************
+ *  Macro Definitions
+ *****************************************************************************/
+/** \brief The schedule period of the cantp module.*/
+#define CANTP_SCHEDULE_PERIOD           (2)
+
+/** \brief server role, the cantp module receives requests and transmits
+    responses.*/
+#define CANTP_ROLE_SERVER               (0)
+/** \brief client role, the cantp module transmits requests and receives
+    responses.*/
+#define CANTP_ROLE_CLIENT               (1)
+/** \brief the role of the cantp module*/
+#define CANTP_ROLE                      CANTP_ROLE_SERVER
+
+/** \brief The number of the physical sessions of the client role, 1 to 8,
+    each session uses a rx and a tx channel with the same handle.*/
+#define CANTP_NUMBER_OF_CLIENT_SESSION  (1)
+/** \brief The id of the requests of a client session, the session s
+    talks to the ECU of the s-th physical ids after FBL_CAN_RX_ID_PHY.*/
+#define CANTP_CLIENT_REQ_ID(s)          ((UINT32)FBL_CAN_RX_ID_PHY + (UINT32)(s))
+/** \brief The id of the responses of a client session.*/
+#define CANTP_CLIENT_RSP_ID(s)          ((UINT32)FBL_CAN_TX_ID_PHY + (UINT32)(s))
+
+/** \brief The cut-through routing of the messages between two channels,
+    each route pairs a rx channel on a bus with a tx channel on another bus.*/
+#define CANTP_FUN_GATEWAY_ROUTING       OFF
+/** \brief The number of the routes.*/
+#define CANTP_NUMBER_OF_ROUTE           (2)
+/** \brief The size of the sliding window buffered by each route, the BS of
+    a routed rx channel shall make a block not bigger than the window.*/
+#define CANTP_ROUTE_WINDOW_SIZE         (256u)
+/** \brief The controller of the sub bus behind the gateway.*/
+#define CANTP_ROUTE_SUB_CTRL            (1u)
+/** \brief The routed request id, it is same on both buses.*/
+#define CANTP_ROUTE_REQ_ID              (0x7E1u)
+/** \brief The routed response id, it is same on both buses.*/
+#define CANTP_ROUTE_RSP_ID              (0x7E9u)
+/** \brief The BS of the routed rx channels, a block is half of the window.*/
+#define CANTP_ROUTE_BS                  ((UINT8)((CANTP_ROUTE_WINDOW_SIZE / 2u) \
+                                            / (CANTP_MAX_FRAME_SIZE - 1u)))
+
+/** \brief The TX_DL of the tx channels transmitting on the sub bus.*/
+#define CANTP_ROUTE_TX_DL               (CANTP_MAX_FRAME_SIZE)
+
+/** \brief The normal fixed and mixed 29-bit addressing of the server role,
+    the TA and SA are decoded from the 29-bit id and the channels of a peer
+    are created from a pool when its first frame is received.*/
+#define CANTP_FUN_FIXED_ADDRESSING      OFF
+/** \brief The number of the peers served by the pool at once.*/
+#define CANTP_NUMBER_OF_POOL_CHANNEL    (4)
+/** \brief The address of the ECU in the 29-bit ids.*/
+#define CANTP_ECU_ADDRESS               (0x10u)
+/** \brief The functional address in the 29-bit ids.*/
+#define CANTP_FUNCTIONAL_ADDRESS        (0x33u)
+
+/** \brief The type and ids of the channels of the server role.*/
+#if (CANTP_FUN_FIXED_ADDRESSING == ON)
+#define CANTP_SERVER_TYPE               CANTP_TYPE_NORMAL_FIXED
+#define CANTP_SERVER_RX_ID_PHY          CANTP_MAKE_FIXED_ID(CANTP_FIXED_ID_PHYSICAL, \
+                                            CANTP_ECU_ADDRESS, 0u)
+#define CANTP_SERVER_RX_ID_FUN          CANTP_MAKE_FIXED_ID(CANTP_FIXED_ID_FUNCTIONAL, \
+                                            CANTP_FUNCTIONAL_ADDRESS, 0u)
+#define CANTP_SERVER_TX_ID_PHY          CANTP_MAKE_FIXED_ID(CANTP_FIXED_ID_PHYSICAL, \
+                                            0u, CANTP_ECU_ADDRESS)
+#else
+#define CANTP_SERVER_TYPE               CANTP_TYPE_STANDARD
+#define CANTP_SERVER_RX_ID_PHY          FBL_CAN_RX_ID_PHY
+#define CANTP_SERVER_RX_ID_FUN          FBL_CAN_RX_ID_FUN
+#define CANTP_SERVER_TX_ID_PHY          FBL_CAN_TX_ID_PHY
+#endif
+
+/** \brief The DoIP gateway, the diagnostic messages of the DoIP testers
+    are transferred on the cantp channels of the target nodes.*/
+#define CANTP_FUN_DOIP_GATEWAY          OFF
+/** \brief The number of the DoIP connections (TCP sockets) of the testers.*/
+#define CANTP_NUMBER_OF_DOIP_CONN       (2)
+/** \brief The number of the CAN nodes reached by the DoIP gateway, each node
+    uses a rx and a tx channel.*/
+#define CANTP_NUMBER_OF_DOIP_NODE       (2)
+/** \brief The size of the buffer of the responses of a DoIP connection, the
+    BS of the rx channels of the nodes shall make a block not bigger than
+    the buffer.*/
+#define CANTP_DOIP_BUFFER_SIZE          (256u)
+/** \brief The logical address, controller and ids of the node 0.*/
+#define CANTP_DOIP_NODE0_ADDR           (0x1001u)
+#define CANTP_DOIP_NODE0_CTRL           (1u)
+#define CANTP_DOIP_NODE0_REQ_ID         (0x7E0u)
+#define CANTP_DOIP_NODE0_RSP_ID         (0x7E8u)
+/** \brief The logical address, controller and ids of the node 1.*/
+#define CANTP_DOIP_NODE1_ADDR           (0x1002u)
+#define CANTP_DOIP_NODE1_CTRL           (2u)
+#define CANTP_DOIP_NODE1_REQ_ID         (0x7E1u)
+#define CANTP_DOIP_NODE1_RSP_ID         (0x7E9u)
+/** \brief The BS of the rx channels of the nodes.*/
+#define CANTP_DOIP_BS                   ((UINT8)((CANTP_DOIP_BUFFER_SIZE / 2u) \
+                                            / (CANTP_MAX_FRAME_SIZE - 1u)))
+
+/** \brief The TX_DL of the tx channels transmitting to the nodes.*/
+#define CANTP_DOIP_TX_DL                (CANTP_MAX_FRAME_SIZE)
+
+/** \brief The upper layer holds the FC until the next block is buffered.*/
+#if ((CANTP_FUN_GATEWAY_ROUTING == ON) || (CANTP_FUN_DOIP_GATEWAY == ON))
+#define CANTP_FUN_RX_BLOCK_HOLD         ON
+#else
+#define CANTP_FUN_RX_BLOCK_HOLD         OFF
+#endif
+
+#if (CANTP_ROLE == CANTP_ROLE_CLIENT)
+/** \brief The number of rx channels of the cantp module.*/
+#define CANTP_NUMBER_OF_RX_CHANNEL      (CANTP_NUMBER_OF_CLIENT_SESSION)
+/** \brief The number of tx channels of the cantp module.*/
+#define CANTP_NUMBER_OF_TX_CHANNEL      (CANTP_NUMBER_OF_CLIENT_SESSION + 1)
+/** \brief The functional tx channel follows the physical tx channels.*/
+#define CANTP_FUNCATION_CHANNEL_TX      (CANTP_NUMBER_OF_CLIENT_SESSION)
+#elif (CANTP_FUN_GATEWAY_ROUTING == ON)
+/** \brief The number of rx channels of the cantp module, two more rx
+    channels are used by the routes.*/
+#define CANTP_NUMBER_OF_RX_CHANNEL      (4)
+/** \brief The number of tx channels of the cantp module, two more tx
+    channels are used by the routes.*/
+#define CANTP_NUMBER_OF_TX_CHANNEL      (3)
+#elif (CANTP_FUN_DOIP_GATEWAY == ON)
+/** \brief The number of rx channels of the cantp module, a rx channel is
+    used by each node of the DoIP gateway.*/
+#define CANTP_NUMBER_OF_RX_CHANNEL      (2 + CANTP_NUMBER_OF_DOIP_NODE)
+/** \brief The number of tx channels of the cantp module, a tx channel is
+    used by each node of the DoIP gateway.*/
+#define CANTP_NUMBER_OF_TX_CHANNEL      (1 + CANTP_NUMBER_OF_DOIP_NODE)
+#else
+/** \brief The number of rx channels of the cantp module.*/
+#define CANTP_NUMBER_OF_RX_CHANNEL      (2)
+/** \brief The number of tx channels of the cantp module.*/
+#define CANTP_NUMBER_OF_TX_CHANNEL      (1)
+#endif
+
+/** \brief The STmin sent in the FC frame by the client role.*/
+#define CANTP_CLIENT_STMIN              (0x00u)
+/** \brief The BS sent in the FC frame by the client role.*/
+#define CANTP_CLIENT_BS                 (0x00u)
+/** \brief The TX_DL of the requests transmitted by the client role.*/
+#define CANTP_CLIENT_TX_DL              (CANTP_MAX_FRAME_SIZE)
+/** \brief The TX_DL of the responses transmitted by the server role, the
+    responses use the frame size of the requests by default.*/
+#define CANTP_SERVER_TX_DL              (CANTP_TX_DL_AUTO)
+
+/** \brief The scheduler which runs the client sessions at once on one bus.*/
+#define CANTP_FUN_CLIENT_SCHEDULER      OFF
+/** \brief The max number of frames on the bus during a schedule period,
+    e.g. about 8 classic frames per 2ms on a 500kbps bus.*/
+#define CANTP_SCHED_FRAMES_PER_PERIOD   (8u)
+
+/** \brief The frame padding function.*/
+#define CANTP_FUN_TX_FRAME_PADDING         ON
+#define CANTP_FUN_RX_FRAME_PADDING         ON
+/** \brief The frame padding value.*/
+#define CANTP_FRAME_PADDING_VALUE       (CANTP_FILLER_BYTE)
+
+/** \brief full duplex*/
+#define CANTP_FULL_DUPLEX               (0)
+/** \brief half duplex*/
+#define CANTP_HALF_DUPLEX               (1)
+/** \brief support full- or half-duplex communication*/
+#define CANTP_COMMUNICATION_DUPLEX      CANTP_HALF_DUPLEX
+
+/** \brief The multiple frames transfer on the functional channels, a leader
+    transmits the FC and the other receivers only receive the frames.*/
+#define CANTP_FUN_FUNCTIONAL_MULTICAST  OFF
+
+/** \brief The frame buffers are borrowed from a pool by the channels which
+    are not idle, instead of a buffer of CANTP_MAX_FRAME_SIZE in each
+    channel. A channel whose max DL is CANTP_CLASSIC_FRAME_SIZE borrows a
+    classic buffer firstly.*/
+#define CANTP_FUN_FRAME_POOL            OFF
+/** \brief The number of the buffers of CANTP_MAX_FRAME_SIZE bytes.*/
+#define CANTP_NUMBER_OF_FRAME_BUFFER    (4u)
+/** \brief The number of the buffers of CANTP_CLASSIC_FRAME_SIZE bytes.*/
+#define CANTP_NUMBER_OF_CLASSIC_BUFFER  (2u)
+/** \brief Lock the pool when the frames are indicated in the CAN ISR, e.g.
+    disable the CAN interrupts.*/
+#define CANTP_FRAME_POOL_LOCK()
+#define CANTP_FRAME_POOL_UNLOCK()
+
+/** \brief The status and the timer of the channels are kept in dense
+    arrays, apart from the frames and the configurations, so the period
+    function does not load an idle channel, e.g. for the host and gateway
+    builds with thousands of channels.*/
+#define CANTP_FUN_CHANNEL_SOA           OFF
+
+/** \brief All channels use one PCI layout, so the positions of the PCI and
+    the data in the frames are constants instead of the lookups of the PCI
+    of each channel. The PCI sizes are constants too if only the classic
+    frames are used.*/
+#define CANTP_FUN_STATIC_PCI_LAYOUT     OFF
+/** \brief The channels use the standard or normal fixed addressing(ON), or
+    the extended, mixed or mixed 29-bit addressing(OFF).*/
+#define CANTP_STATIC_STANDARD_LAYOUT    ON
+
+/** \brief The checkpoints of the multiple frames transfers, a rx channel
+    saves the size of the data committed to the upper layer when the
+    reception is aborted, and a tx channel restarts the segmentation of a
+    message at an offset, so only the rest of the message is transferred
+    again.*/
+#define CANTP_FUN_RESUMABLE_TRANSFER    OFF
+
+/** \brief The BS and STmin sent in the FC frames by the rx channels are
+    changed at runtime by Cantp_ChangeParameter, e.g. BS 0 and STmin 0
+    during the programming session, instead of the values of the channel
+    configurations.*/
+#define CANTP_FUN_CHANGE_PARAMETER      OFF
+
+/** \brief The SF of the tx channels and the FC of the rx channels are
+    transmitted before the CFs of the bulk transfers in each period, so a
+    short response on a channel is not delayed by the frame budget of the
+    scheduler or the CAN mailbox used by a long transfer on other channel.*/
+#define CANTP_FUN_TX_PRIORITY           OFF
+
+/** \brief The SFs received by a rx channel before its last SF is given to
+    the upper layer are queued and given in order, instead of overwriting
+    the last SF, so a tester can pipeline the short requests. A FF of the
+    channel drops the queued SFs.*/
+#define CANTP_FUN_RX_SF_QUEUE           OFF
+/** \brief The number of the SFs queued by each rx channel, a power of 2.*/
+#define CANTP_RX_SF_QUEUE_SIZE          (4u)
+/** \brief The bytes of the SFs queued by all rx channels. A rx channel takes
+    CANTP_RX_SF_QUEUE_SIZE times its MAX_DL, and a rx channel of the pool
+    of the fixed addressing takes CANTP_RX_SF_QUEUE_SIZE times the biggest
+    MAX_DL of the rx channels. The SFs of a channel out of the bytes are
+    not queued.*/
+#if (CANTP_FUN_FIXED_ADDRESSING == ON)
+#define CANTP_RX_SF_QUEUE_DATA_SIZE     (CANTP_RX_SF_QUEUE_SIZE * CANTP_MAX_FRAME_SIZE \
+                                            * (CANTP_NUMBER_OF_RX_CHANNEL \
+                                                + CANTP_NUMBER_OF_POOL_CHANNEL))
+#else
+#define CANTP_RX_SF_QUEUE_DATA_SIZE     (CANTP_RX_SF_QUEUE_SIZE * CANTP_MAX_FRAME_SIZE \
+                                            * CANTP_NUMBER_OF_RX_CHANNEL)
+#endif
+
+/** \brief Cantp_Transmit queues a message if the tx channel is busy, and
+    the message is started as soon as the channel goes to the idle status.
+    The upper layer copies the data of the queued messages in order, and a
+    message which can not be started is confirmed with ERR_ERROR. The data
+    of a message of Cantp_TransmitData is copied from its own buffer.*/
+#define CANTP_FUN_TX_REQUEST_QUEUE      OFF
+/** \brief The number of the messages queued by each tx channel, a power
+    of 2.*/
+#define CANTP_TX_REQUEST_QUEUE_SIZE     (2u)
+
+/** \brief The streaming stage of the server role between the cantp channels
+    and the Diag. The compressionMethod of a RequestDownload selects the
+    decoder, and the data of each TransferData is decompressed as the CFs
+    arrive and written by the programming callback.*/
+#define CANTP_FUN_RX_STREAM             OFF
+/** \brief The compressionMethod of the dataFormatIdentifier used by LZSS.*/
+#define CANTP_STREAM_METHOD_LZSS        (0x1u)
+/** \brief The compressionMethod of the delta, the data is a patch of the
+    installed image.*/
+#define CANTP_STREAM_METHOD_DELTA       (0x2u)
+/** \brief The size of the output buffer of the stream, the output is written
+    when it is full and when a TransferData is received.*/
+#define CANTP_STREAM_OUTPUT_SIZE        (256u)
+/** \brief The programming callback writing the decompressed data.*/
+#define CANTP_STREAM_WRITE(buf,size)    Diag_WriteStreamData((buf),(size))
+/** \brief Read the installed image at a position for the delta, the output
+    shall not overwrite the installed image, e.g. it is in the other bank.*/
+#define CANTP_STREAM_READ_OLD(pos,buf,size) \
+                                    Diag_ReadInstalledImage((pos),(buf),(size))
+/** \brief The CRC-32 and SHA-256 of the data of a download calculated by the
+    stream while it is received, the Diag gets them when the download is
+    exited instead of reading the flash back.*/
+#define CANTP_FUN_STREAM_CRC32          OFF
+#define CANTP_FUN_STREAM_SHA256         OFF
+/** \brief The block queries of the stream, the tester sends the number and
+    CRC-32 of a block in a SF before its download, and the stream answers
+    if the block in the flash is same and can be skipped.*/
+#define CANTP_FUN_STREAM_DEDUP          OFF
+/** \brief The SID of the block query, a supplier specific service.*/
+#define CANTP_DEDUP_SID                 (0xBAu)
+/** \brief The max number of the blocks in the index.*/
+#define CANTP_DEDUP_NUMBER_OF_BLOCK     (256u)
+/** \brief The index of the block hashes resident in the flash.*/
+#define CANTP_DEDUP_INDEX               ((const bl_CanTpDedupIndex_t *)0x0000C000uL)
+/** \brief The tx channel transmitting the answers.*/
+#define CANTP_DEDUP_TX_HANDLE           (CANTP_PHYSICAL_CHANNEL_TX)
+/** \brief Update the CRC-32 register by the data, the slice-by-8 tables by
+    default, or a hardware CRC unit.*/
+#define CANTP_STREAM_CRC32_UPDATE(crc,buf,size) \
+                                    CanTpStream_UpdateCrc32((crc),(buf),(size))
+
+/** \brief The buffer of a FF is gotten and the FC is transmitted in the
+    context receiving the FF or the last CF of a block, instead of the next
+    periods. The upper layer shall answer synchronously and the frames shall
+    be indicated in the task by the rx queue.*/
+#define CANTP_FUN_INLINE_FLOW_CONTROL   OFF
+
+/** \brief The queue of the received frames between the CAN ISR and the task,
+    the ISR only copies a frame into the queue and the task processes it.*/
+#define CANTP_FUN_RX_QUEUE              OFF
+/** \brief The number of the frames buffered by the queue, a power of 2.*/
+#define CANTP_RX_QUEUE_SIZE             (32u)
+/** \brief The max number of the frames processed by the task at once, the
+    rest frames are processed when the task runs again.*/
+#define CANTP_RX_QUEUE_BUDGET           (8u)
+/** \brief The task running FblCanTpTask.*/
+#define CANTP_TASK_ID                   (TASK_ID_CANTP)
+/** \brief Notify the task that frames are queued, EVENT_MSG_READY of the
+    task drains the queue at once. The queue is also drained by each scan
+    period.*/
+#define CANTP_RX_QUEUE_NOTIFY()         OsSetEvent(CANTP_TASK_ID, EVENT_MSG_READY)
+/** \brief The compiler barrier between the frame and the index of the queue,
+    also used by the SF queue and the tx request queue, a data memory
+    barrier is needed if the ISR runs on another core.*/
+#if defined(__GNUC__)
+#define CANTP_RX_QUEUE_BARRIER()        __asm__ volatile ("" : : : "memory")
+#else
+#define CANTP_RX_QUEUE_BARRIER()
+#endif
+
+/** \brief The warm handover from the application to the bootloader, the
+    application saves the pending request of the programming session in the
+    no-init RAM before the reset, and the warm initialization of the
+    bootloader receives it again and answers it at once.*/
+#define CANTP_FUN_WARM_HANDOVER         OFF
+/** \brief The record of the handover, in a no-init RAM which is at the same
+    address in the application and the bootloader.*/
+#define CANTP_HANDOVER_RECORD           ((bl_CanTpHandover_t *)0x2000FFC0uL)
+
+/** \brief The interfaces of the application using the cantp module.*/
+#if (CANTP_ROLE == CANTP_ROLE_CLIENT)
+#define CANTP_APP_START_OF_RECEPTION(handle,size) \
+                                    Tester_StartOfReception((handle),(size))
+#define CANTP_APP_COPY_RX_DATA(handle,size,buf) \
+                                    Tester_CopyRxData((handle),(size),(buf))
+#define CANTP_APP_RX_INDICATION(handle,taType,result) \
+                                    Tester_RxIndication((handle),(result))
+#define CANTP_APP_COPY_TX_DATA(handle,size,buf) \
+                                    Tester_CopyTxData((handle),(size),(buf))
+#define CANTP_APP_TX_CONFIRMATION(handle,result) \
+                                    Tester_TxConfirmation((handle),(result))
+#elif (CANTP_FUN_RX_STREAM == ON)
+#define CANTP_APP_START_OF_RECEPTION(handle,size) \
+                                    CanTpStream_StartOfReception((handle),(size))
+#define CANTP_APP_COPY_RX_DATA(handle,size,buf) \
+                                    CanTpStream_CopyRxData((handle),(size),(buf))
+#define CANTP_APP_RX_INDICATION(handle,taType,result) \
+                                    CanTpStream_RxIndication((handle),(taType),(result))
+#define CANTP_APP_COPY_TX_DATA(handle,size,buf) \
+                                    CanTpStream_CopyTxData((handle),(size),(buf))
+#define CANTP_APP_TX_CONFIRMATION(handle,result) \
+                                    CanTpStream_TxConfirmation((handle),(result))
+#else
+#define CANTP_APP_START_OF_RECEPTION(handle,size) \
+                                    Diag_StartOfReception(size)
+#define CANTP_APP_COPY_RX_DATA(handle,size,buf) \
+                                    Diag_CopyRxData((size),(buf))
+#define CANTP_APP_RX_INDICATION(handle,taType,result) \
+                                    Diag_RxIndication((taType),(result))
+#define CANTP_APP_COPY_TX_DATA(handle,size,buf) \
+                                    Diag_CopyTxData((size),(buf))
+#define CANTP_APP_TX_CONFIRMATION(handle,result) \
+                                    Diag_TxConfirmation(result)
+#endif
+
+/** \brief The upper layer interfaces of the cantp module.*/
+#if (CANTP_FUN_GATEWAY_ROUTING == ON)
+#define CANTP_UL_START_OF_RECEPTION(handle,size) \
+                                    CanTpRoute_StartOfReception((handle),(size))
+#define CANTP_UL_COPY_RX_DATA(handle,size,buf) \
+                                    CanTpRoute_CopyRxData((handle),(size),(buf))
+#define CANTP_UL_RX_INDICATION(handle,taType,result) \
+                                    CanTpRoute_RxIndication((handle),(taType),(result))
+#define CANTP_UL_COPY_TX_DATA(handle,size,buf) \
+                                    CanTpRoute_CopyTxData((handle),(size),(buf))
+#define CANTP_UL_TX_CONFIRMATION(handle,result) \
+                                    CanTpRoute_TxConfirmation((handle),(result))
+#define CANTP_UL_RX_READY(handle,size) \
+                                    CanTpRoute_RxReady((handle),(size))
+#elif (CANTP_FUN_DOIP_GATEWAY == ON)
+#define CANTP_UL_START_OF_RECEPTION(handle,size) \
+                                    CanTpDoIp_StartOfReception((handle),(size))
+#define CANTP_UL_COPY_RX_DATA(handle,size,buf) \
+                                    CanTpDoIp_CopyRxData((handle),(size),(buf))
+#define CANTP_UL_RX_INDICATION(handle,taType,result) \
+                                    CanTpDoIp_RxIndication((handle),(taType),(result))
+#define CANTP_UL_COPY_TX_DATA(handle,size,buf) \
+                                    CanTpDoIp_CopyTxData((handle),(size),(buf))
+#define CANTP_UL_TX_CONFIRMATION(handle,result) \
+                                    CanTpDoIp_TxConfirmation((handle),(result))
+#define CANTP_UL_RX_READY(handle,size) \
+                                    CanTpDoIp_RxReady((handle),(size))
+#else
+#define CANTP_UL_START_OF_RECEPTION(handle,size) \
+                                    CANTP_APP_START_OF_RECEPTION(handle,size)
+#define CANTP_UL_COPY_RX_DATA(handle,size,buf) \
+                                    CANTP_APP_COPY_RX_DATA(handle,size,buf)
+#define CANTP_UL_RX_INDICATION(handle,taType,result) \
+                                    CANTP_APP_RX_INDICATION(handle,taType,result)
+#define CANTP_UL_COPY_TX_DATA(handle,size,buf) \
+                                    CANTP_APP_COPY_TX_DATA(handle,size,buf)
+#define CANTP_UL_TX_CONFIRMATION(handle,result) \
+                                    CANTP_APP_TX_CONFIRMATION(handle,result)
+#endif
+
+/** \brief The interface of the CAN driver to transmit a frame, the id of a
+    29-bit frame has CANTP_ID_EXTENDED set. CANTP_LL_CTRL_TRANSMIT is ON if
+    the frame is transmitted on the controller of the channel, which is
+    needed by the channels on more than one controller. The classic driver
+    only transmits on the default controller, map CANTP_LL_TRANSMIT to the
+    interface of each controller if the driver has one.*/
+#if (ENABLE_CANXL == ON)
+#define CANTP_LL_CTRL_TRANSMIT          ON
+#define CANTP_LL_TRANSMIT(ctrl,frame,id,size) \
+                                    FblCanXlSendData((ctrl),(frame),(id),(size))
+#else
+#define CANTP_LL_CTRL_TRANSMIT          OFF
+#define CANTP_LL_TRANSMIT(ctrl,frame,id,size) \
+                                    FblCanSendData((frame),(id),(size))
+#endif
+
+/** \brief The interfaces of the TCP sockets of the DoIP connections, each
+    returns the size of the data read or written.*/
+#define CANTP_DOIP_READ(conn,buf,size)  DoIp_SocketRead((conn),(buf),(size))
+#define CANTP_DOIP_WRITE(conn,buf,size) DoIp_SocketWrite((conn),(buf),(size))
+#define CANTP_DOIP_CLOSE(conn)          DoIp_SocketClose(conn)
+
+/*****************************************************************************
+ *  Structure Definitions
+ *****************************************************************************/
+
+/*****************************************************************************
+ *  External Global Variable Declarations
+ *****************************************************************************/
+extern const bl_CanTpChannelCfg_t g_CanTpRxChnsCfg[CANTP_NUMBER_OF_RX_CHANNEL];
+
+extern const bl_CanTpChannelCfg_t g_CanTpTxChnsCfg[CANTP_NUMBER_OF_TX_CHANNEL];
+
+/*****************************************************************************
+ *  External Function Prototype Declarations
+ *****************************************************************************/
+
+#endif
+
@@ -0,0 +1,1008 @@
+/*************************************************************************************************************
+*    FileName   :    FblCanTpDoIp.c
+*    Description:    DoIP gateway of the CAN TP module.
+*                    The diagnostic messages of a DoIP tester are read from
+*                    a TCP socket and transmitted to the CAN node addressed by
+*                    the logical target address. The payload is read from the
+*                    socket only when the tx channel of the node copies the
+*                    data of the next frame, so the TCP window throttles the
+*                    tester and a whole message is never buffered. The
+*                    responses of the node are written to the socket of the
+*                    tester through a small buffer, and the FC of the rx
+*                    channel is held until the buffer can hold a block.
+*                    Each connection streams to its own node, so several
+*                    connections keep several CAN buses busy at once.
+
+*    UpdateDate :    2026/10/18
+*    Version    :    1.0.0
+*    History    :
+        1. V1.0.0, 2026/10/18, Initial version.
+
+*************************************************************************************************************/
+
+/*************************************************************************************************************
+                                             Include Files
+*************************************************************************************************************/
+#include "FblCanTpDoIp.h"
+#include "FblUdsDiag.h"
+#include "FblString.h"
+#if (CANTP_FUN_RX_STREAM == ON)
+#include "FblCanTpStream.h"
+#endif
+
+#if (CANTP_FUN_DOIP_GATEWAY == ON)
+/*************************************************************************************************************
+                                     Local Function Declarations
+ ************************************************************************************************************/
+/** \brief The status of a DoIP connection.*/
+#define CANTP_DOIP_CONN_CLOSED      (0x00u)  /**< The connection is closed.*/
+#define CANTP_DOIP_CONN_HEADER      (0x01u)  /**< Read the generic header.*/
+#define CANTP_DOIP_CONN_ADDR        (0x02u)  /**< Read the SA and TA.*/
+#define CANTP_DOIP_CONN_START       (0x03u)  /**< Start the tx channel.*/
+#define CANTP_DOIP_CONN_DATA        (0x04u)  /**< Transmit the user data.*/
+#define CANTP_DOIP_CONN_DISCARD     (0x05u)  /**< Discard the payload.*/
+
+/** \brief The size of the ACK or NACK of a diagnostic message.*/
+#define CANTP_DOIP_ACK_SIZE         (CANTP_DOIP_HEADER_SIZE \
+                                        + CANTP_DOIP_ADDR_SIZE + 1u)
+/** \brief The max size of a message transmitted by a cantp channel.*/
+#define CANTP_DOIP_MAX_MSG_SIZE     (0xFFFFuL)
+
+/** \brief Get the free size of the response buffer of a connection.*/
+#define CANTP_DOIP_FREE_SIZE(conn)  ((bl_BufferSize_t)(CANTP_DOIP_BUFFER_SIZE \
+                                        - (conn)->count))
+
+/*****************************************************************************
+ *  Internal Type Definitions
+ *****************************************************************************/
+/** \brief A alias of the struct _tag_CanTpDoIpConn.*/
+typedef struct _tag_CanTpDoIpConn bl_CanTpDoIpConn_t;
+/** \brief A alias of the struct _tag_CanTpDoIpNode.*/
+typedef struct _tag_CanTpDoIpNode bl_CanTpDoIpNode_t;
+
+/*****************************************************************************
+ *  Internal Structure Definitions
+ *****************************************************************************/
+/** \brief The runtime data of a DoIP connection.*/
+struct _tag_CanTpDoIpConn
+{
+    UINT8 status;          /**< The status of the connection.*/
+    UINT8 node;            /**< The target node of the current request.*/
+    UINT8 rspNode;         /**< The node whose response is being written.*/
+    UINT8 ackCode;         /**< The pending ACK or NACK code.*/
+    UINT16 ackAddr;        /**< The source address of the pending ACK.*/
+    UINT16 testerAddr;     /**< The logical address of the tester.*/
+    UINT32 remain;         /**< The payload size not read from the socket.*/
+    bl_BufferSize_t hdrSize;    /**< The size of the read header.*/
+    bl_Buffer_t hdr[CANTP_DOIP_HEADER_SIZE + CANTP_DOIP_ADDR_SIZE];
+    bl_BufferSize_t stageSize;  /**< The size of the data of the next frame.*/
+    bl_Buffer_t stage[CANTP_MAX_FRAME_SIZE];
+    bl_BufferSize_t head;       /**< The first data in the response buffer.*/
+    bl_BufferSize_t count;      /**< The size of the data in response buffer.*/
+    bl_Buffer_t buffer[CANTP_DOIP_BUFFER_SIZE];
+};
+
+/** \brief The runtime data of a node.*/
+struct _tag_CanTpDoIpNode
+{
+    UINT8 conn;     /**< The connection which sent the last request.*/
+    UINT8 rspConn;  /**< The connection receiving the current response.*/
+};
+
+/*****************************************************************************
+ *  Internal Function Declarations
+ *****************************************************************************/
+/** \brief Reset the runtime data of a connection.*/
+static void _CanTpDoIp_ResetConn(UINT8 conn, UINT8 status);
+/** \brief Close a connection because the stream can not be continued.*/
+static void _CanTpDoIp_Close(UINT8 conn);
+/** \brief Read the header and discard the payload of a connection.*/
+static void _CanTpDoIp_Receive(UINT8 conn);
+/** \brief Process the complete header of a connection.*/
+static void _CanTpDoIp_ProcessHeader(UINT8 conn);
+/** \brief Process the complete address of a connection.*/
+static void _CanTpDoIp_ProcessAddr(UINT8 conn);
+/** \brief Write the pending ACK or NACK of a connection.*/
+static void _CanTpDoIp_SendAck(UINT8 conn);
+/** \brief Write the response buffer of a connection to the socket.*/
+static void _CanTpDoIp_Flush(UINT8 conn);
+/** \brief Put the data into the response buffer of a connection.*/
+static void _CanTpDoIp_Push(bl_CanTpDoIpConn_t *conn,
+                            const bl_Buffer_t *buffer,
+                            bl_BufferSize_t size);
+/** \brief Put a generic header and the addresses into the response buffer.*/
+static void _CanTpDoIp_PushHeader(bl_CanTpDoIpConn_t *conn,
+                                    UINT16 type,
+                                    UINT32 length,
+                                    UINT16 sa);
+/** \brief Find the node of a logical address.*/
+static UINT8 _CanTpDoIp_FindNode(UINT16 addr);
+
+/*****************************************************************************
+ *  Internal Variable Definitions
+ *****************************************************************************/
+/** \brief The runtime data of the connections.*/
+static bl_CanTpDoIpConn_t gs_CanTpDoIpConn[CANTP_NUMBER_OF_DOIP_CONN];
+/** \brief The runtime data of the nodes.*/
+static bl_CanTpDoIpNode_t gs_CanTpDoIpNode[CANTP_NUMBER_OF_DOIP_NODE];
+/** \brief The node used by each rx channel.*/
+static UINT8 gs_RxNode[CANTP_NUMBER_OF_RX_CHANNEL];
+/** \brief The node used by each tx channel.*/
+static UINT8 gs_TxNode[CANTP_NUMBER_OF_TX_CHANNEL];
+
+/*************************************************************************************************************
+                                          Function Definitions
+ ************************************************************************************************************/
+/**************************************************************************//**
+ *
+ *  \details    Initialize the DoIP gateway, all connections are closed.
+ *
+ *  \return None.
+ *
+ *  \since  V5.2.0
+ *
+ *****************************************************************************/
+void CanTpDoIp_Init(void)
+{
+    UINT16 i;
+
+    for (i = 0; i < CANTP_NUMBER_OF_RX_CHANNEL; i++)
+    {
+        gs_RxNode[i] = CANTP_DOIP_NONE;
+    }
+
+    for (i = 0; i < CANTP_NUMBER_OF_TX_CHANNEL; i++)
+    {
+        gs_TxNode[i] = CANTP_DOIP_NONE;
+    }
+
+    for (i = 0; i < CANTP_NUMBER_OF_DOIP_NODE; i++)
+    {
+        BL_DEBUG_ASSERT_NO_RET(g_CanTpDoIpCfg[i].rxHandle
+                                < CANTP_NUMBER_OF_RX_CHANNEL);
+        BL_DEBUG_ASSERT_NO_RET(g_CanTpDoIpCfg[i].txHandle
+                                < CANTP_NUMBER_OF_TX_CHANNEL);
+
+        gs_RxNode[g_CanTpDoIpCfg[i].rxHandle] = (UINT8)i;
+        gs_TxNode[g_CanTpDoIpCfg[i].txHandle] = (UINT8)i;
+
+        gs_CanTpDoIpNode[i].conn = CANTP_DOIP_NONE;
+        gs_CanTpDoIpNode[i].rspConn = CANTP_DOIP_NONE;
+    }
+
+    for (i = 0; i < CANTP_NUMBER_OF_DOIP_CONN; i++)
+    {
+        _CanTpDoIp_ResetConn((UINT8)i, CANTP_DOIP_CONN_CLOSED);
+    }
+
+    return ;
+}
+
+/**************************************************************************//**
+ *
+ *  \details    The period function of the DoIP gateway. It is called at the
+ *              beginning of the period function of the cantp module, so a
+ *              request started here transmits its FF in the same period.
+ *
+ *  \return None.
+ *
+ *  \since  V5.2.0
+ *
+ *****************************************************************************/
+void CanTpDoIp_PeriodFunction(void)
+{
+    UINT8 i;
+
+    for (i = 0; i < CANTP_NUMBER_OF_DOIP_CONN; i++)
+    {
+        if (gs_CanTpDoIpConn[i].status != CANTP_DOIP_CONN_CLOSED)
+        {
+            _CanTpDoIp_Flush(i);
+            _CanTpDoIp_SendAck(i);
+            _CanTpDoIp_Receive(i);
+        }
+    }
+
+    return ;
+}
+
+/**************************************************************************//**
+ *
+ *  \details    Indicate a DoIP connection is opened by a tester. It is called
+ *              by the socket driver.
+ *
+ *  \param[in]  conn - the index of the connection.
+ *
+ *  \return None.
+ *
+ *  \since  V5.2.0
+ *
+ *****************************************************************************/
+void CanTpDoIp_Connect(UINT8 conn)
+{
+    BL_DEBUG_ASSERT_NO_RET(conn < CANTP_NUMBER_OF_DOIP_CONN);
+
+    CanTpDoIp_Disconnect(conn);
+    _CanTpDoIp_ResetConn(conn, CANTP_DOIP_CONN_HEADER);
+
+    return ;
+}
+
+/**************************************************************************//**
+ *
+ *  \details    Indicate a DoIP connection is closed. It is called by the
+ *              socket driver. The transfers of the nodes using the connection
+ *              are failed by the cantp channels.
+ *
+ *  \param[in]  conn - the index of the connection.
+ *
+ *  \return None.
+ *
+ *  \since  V5.2.0
+ *
+ *****************************************************************************/
+void CanTpDoIp_Disconnect(UINT8 conn)
+{
+    UINT16 i;
+
+    BL_DEBUG_ASSERT_NO_RET(conn < CANTP_NUMBER_OF_DOIP_CONN);
+
+    for (i = 0; i < CANTP_NUMBER_OF_DOIP_NODE; i++)
+    {
+        if (conn == gs_CanTpDoIpNode[i].conn)
+        {
+            gs_CanTpDoIpNode[i].conn = CANTP_DOIP_NONE;
+        }
+
+        if (conn == gs_CanTpDoIpNode[i].rspConn)
+        {
+            gs_CanTpDoIpNode[i].rspConn = CANTP_DOIP_NONE;
+        }
+    }
+
+    _CanTpDoIp_ResetConn(conn, CANTP_DOIP_CONN_CLOSED);
+
+    return ;
+}
+
+/**************************************************************************//**
+ *
+ *  \details    Check if the response buffer of the connection can hold the
+ *              next block received by the rx channel of a node.
+ *
+ *  \param[in]  handle - the rx handle.
+ *  \param[in]  size - the size of the data in the next block.
+ *
+ *  \return If the next block can be received returns TRUE, otherwise
+ *          returns FALSE.
+ *
+ *  \since  V5.2.0
+ *
+ *****************************************************************************/
+UINT8 CanTpDoIp_RxReady(bl_CanTpHandle_t handle, bl_BufferSize_t size)
+{
+    UINT8 node;
+    UINT8 conn;
+    UINT8 ret = TRUE;
+
+    BL_DEBUG_ASSERT_PARAM(handle < CANTP_NUMBER_OF_RX_CHANNEL);
+
+    node = gs_RxNode[handle];
+    if (node != CANTP_DOIP_NONE)
+    {
+        conn = gs_CanTpDoIpNode[node].rspConn;
+        if ((conn != CANTP_DOIP_NONE)
+            && (CANTP_DOIP_FREE_SIZE(&gs_CanTpDoIpConn[conn]) < size))
+        {
+            ret = FALSE;
+        }
+    }
+
+    return ret;
+}
+
+/**************************************************************************//**
+ *
+ *  \details    Start to receive a message. If the rx channel is used by a
+ *              node, the header of the DoIP diagnostic message is written to
+ *              the connection which sent the last request to the node.
+ *
+ *  \param[in]  handle - the rx handle.
+ *  \param[in]  size - the total size of the message.
+ *
+ *  \return If the message can be received returns ERR_OK. If no tester is
+ *          connected returns ERR_OVERFLOW. If the connection is busy
+ *          returns ERR_ERROR, and the rx channel tries again.
+ *
+ *  \since  V5.2.0
+ *
+ *****************************************************************************/
+UINT8 CanTpDoIp_StartOfReception(bl_CanTpHandle_t handle,
+                                    bl_BufferSize_t size)
+{
+    bl_CanTpDoIpConn_t *conn;
+    bl_BufferSize_t needSize;
+    UINT8 node;
+    UINT8 ret = ERR_ERROR;
+
+    BL_DEBUG_ASSERT_PARAM(handle < CANTP_NUMBER_OF_RX_CHANNEL);
+
+    node = gs_RxNode[handle];
+    if (CANTP_DOIP_NONE == node)
+    {
+        ret = CANTP_APP_START_OF_RECEPTION(handle, size);
+    }
+    else if (CANTP_DOIP_NONE == gs_CanTpDoIpNode[node].conn)
+    {
+        ret = ERR_OVERFLOW;
+    }
+    else
+    {
+        conn = &gs_CanTpDoIpConn[gs_CanTpDoIpNode[node].conn];
+
+        /*The header and the data of the SF or FF are written at once.*/
+        needSize = CANTP_DOIP_HEADER_SIZE + CANTP_DOIP_ADDR_SIZE;
+        needSize += (size < CANTP_MAX_FRAME_SIZE) ? size : CANTP_MAX_FRAME_SIZE;
+
+        if ((CANTP_DOIP_NONE == conn->rspNode)
+            && (CANTP_DOIP_FREE_SIZE(conn) >= needSize))
+        {
+            _CanTpDoIp_PushHeader(conn,
+                                    CANTP_DOIP_TYPE_DIAG_MSG,
+                                    (UINT32)size + CANTP_DOIP_ADDR_SIZE,
+                                    g_CanTpDoIpCfg[node].logicalAddr);
+
+            conn->rspNode = node;
+            gs_CanTpDoIpNode[node].rspConn = gs_CanTpDoIpNode[node].conn;
+
+            ret = ERR_OK;
+        }
+    }
+
+    return ret;
+}
+
+/**************************************************************************//**
+ *
+ *  \details    Copy the received data into the response buffer.
+ *
+ *  \param[in]  handle - the rx handle.
+ *  \param[in]  size - the size of the data.
+ *  \param[in]  buffer - the data.
+ *
+ *  \return If the data is buffered returns ERR_OK, otherwise returns
+ *          ERR_ERROR.
+ *
+ *  \since  V5.2.0
+ *
+ *****************************************************************************/
+UINT8 CanTpDoIp_CopyRxData(bl_CanTpHandle_t handle,
+                            bl_BufferSize_t size,
+                            const bl_Buffer_t *buffer)
+{
+    bl_CanTpDoIpConn_t *conn;
+    UINT8 node;
+    UINT8 ret = ERR_ERROR;
+
+    BL_DEBUG_ASSERT_PARAM(handle < CANTP_NUMBER_OF_RX_CHANNEL);
+
+    node = gs_RxNode[handle];
+    if (CANTP_DOIP_NONE == node)
+    {
+        ret = CANTP_APP_COPY_RX_DATA(handle, size, buffer);
+    }
+    else if (gs_CanTpDoIpNode[node].rspConn != CANTP_DOIP_NONE)
+    {
+        conn = &gs_CanTpDoIpConn[gs_CanTpDoIpNode[node].rspConn];
+
+        if (CANTP_DOIP_FREE_SIZE(conn) >= size)
+        {
+            _CanTpDoIp_Push(conn, buffer, size);
+            ret = ERR_OK;
+        }
+    }
+    else
+    {
+        /*The connection is closed during the reception.*/
+    }
+
+    return ret;
+}
+
+/**************************************************************************//**
+ *
+ *  \details    Indicate a message is received. If the response of a node is
+ *              failed, the length in the DoIP header can not be kept, so the
+ *              connection is closed.
+ *
+ *  \param[in]  handle - the rx handle.
+ *  \param[in]  taType - the TA type of the rx channel.
+ *  \param[in]  result - the result of the reception.
+ *
+ *  \return None.
+ *
+ *  \since  V5.2.0
+ *
+ *****************************************************************************/
+void CanTpDoIp_RxIndication(bl_CanTpHandle_t handle,
+                            UINT8 taType,
+                            bl_CanTpResult_t result)
+{
+    UINT8 node;
+    UINT8 conn;
+
+    BL_DEBUG_ASSERT_NO_RET(handle < CANTP_NUMBER_OF_RX_CHANNEL);
+
+    node = gs_RxNode[handle];
+    if (CANTP_DOIP_NONE == node)
+    {
+        CANTP_APP_RX_INDICATION(handle, taType, result);
+    }
+    else if (gs_CanTpDoIpNode[node].rspConn != CANTP_DOIP_NONE)
+    {
+        conn = gs_CanTpDoIpNode[node].rspConn;
+
+        gs_CanTpDoIpNode[node].rspConn = CANTP_DOIP_NONE;
+        gs_CanTpDoIpConn[conn].rspNode = CANTP_DOIP_NONE;
+
+        if (result != ERR_OK)
+        {
+            _CanTpDoIp_Close(conn);
+        }
+    }
+    else
+    {
+        /*The connection is closed during the reception.*/
+    }
+
+    return ;
+}
+
+/**************************************************************************//**
+ *
+ *  \details    Copy the data of the next frame from the socket of the
+ *              request. The data is only read when the tx channel asks for
+ *              it, so the socket is the only buffer of the request.
+ *
+ *  \param[in]  handle - the tx handle.
+ *  \param[in]  size - the size of the data.
+ *  \param[out] buffer - the data.
+ *
+ *  \return If the data is copied returns ERR_OK. If the data is not
+ *          received yet returns ERR_ERROR, and the tx channel tries again.
+ *
+ *  \since  V5.2.0
+ *
+ *****************************************************************************/
+UINT8 CanTpDoIp_CopyTxData(bl_CanTpHandle_t handle,
+                            bl_BufferSize_t size,
+                            bl_Buffer_t *buffer)
+{
+    bl_CanTpDoIpConn_t *conn;
+    bl_BufferSize_t readSize;
+    UINT8 node;
+    UINT8 ret = ERR_ERROR;
+
+    BL_DEBUG_ASSERT_PARAM(handle < CANTP_NUMBER_OF_TX_CHANNEL);
+    BL_DEBUG_ASSERT_PARAM(size <= CANTP_MAX_FRAME_SIZE);
+
+    node = gs_TxNode[handle];
+    if (CANTP_DOIP_NONE == node)
+    {
+        ret = CANTP_APP_COPY_TX_DATA(handle, size, buffer);
+    }
+    else if (gs_CanTpDoIpNode[node].conn != CANTP_DOIP_NONE)
+    {
+        conn = &gs_CanTpDoIpConn[gs_CanTpDoIpNode[node].conn];
+
+        if ((CANTP_DOIP_CONN_DATA == conn->status)
+            && (node == conn->node)
+            && ((UINT32)(size - conn->stageSize) <= conn->remain))
+        {
+            readSize = CANTP_DOIP_READ(gs_CanTpDoIpNode[node].conn,
+                                        &conn->stage[conn->stageSize],
+                                        size - conn->stageSize);
+
+            conn->stageSize += readSize;
+            conn->remain -= readSize;
+
+            if (conn->stageSize == size)
+            {
+                FblMemCpy(buffer, conn->stage, (UINT16)size);
+                conn->stageSize = 0u;
+                ret = ERR_OK;
+            }
+        }
+    }
+    else
+    {
+        /*The connection is closed during the transmission.*/
+    }
+
+    return ret;
+}
+
+/**************************************************************************//**
+ *
+ *  \details    Confirm a message is transmitted. The DoIP diagnostic message
+ *              is ACKed when the tx channel is started, a failed transmission
+ *              is NACKed to the tester.
+ *
+ *  \param[in]  handle - the tx handle.
+ *  \param[in]  result - the result of the transmission.
+ *
+ *  \return None.
+ *
+ *  \since  V5.2.0
+ *
+ *****************************************************************************/
+void CanTpDoIp_TxConfirmation(bl_CanTpHandle_t handle,
+                                bl_CanTpResult_t result)
+{
+    bl_CanTpDoIpConn_t *conn;
+    UINT8 node;
+
+    BL_DEBUG_ASSERT_NO_RET(handle < CANTP_NUMBER_OF_TX_CHANNEL);
+
+    node = gs_TxNode[handle];
+    if (CANTP_DOIP_NONE == node)
+    {
+        CANTP_APP_TX_CONFIRMATION(handle, result);
+    }
+    else if (gs_CanTpDoIpNode[node].conn != CANTP_DOIP_NONE)
+    {
+        conn = &gs_CanTpDoIpConn[gs_CanTpDoIpNode[node].conn];
+
+        if ((CANTP_DOIP_CONN_DATA == conn->status) && (node == conn->node))
+        {
+            if (result != ERR_OK)
+            {
+                /*It replaces the ACK if the ACK is not written yet.*/
+                conn->ackCode = CANTP_DOIP_NACK_TP_ERROR;
+                conn->ackAddr = g_CanTpDoIpCfg[node].logicalAddr;
+            }
+            conn->stageSize = 0u;
+            conn->hdrSize = 0u;
+
+            /*The rest of a failed request is discarded.*/
+            conn->status = (0u == conn->remain) ? CANTP_DOIP_CONN_HEADER
+                                                : CANTP_DOIP_CONN_DISCARD;
+        }
+    }
+    else
+    {
+        /*The connection is closed during the transmission.*/
+    }
+
+    return ;
+}
+
+/**************************************************************************//**
+ *
+ *  \details    Reset the runtime data of a connection.
+ *
+ *  \param[in]  conn - the index of the connection.
+ *  \param[in]  status - the new status of the connection.
+ *
+ *  \return None.
+ *
+ *  \since  V5.2.0
+ *
+ *****************************************************************************/
+static void _CanTpDoIp_ResetConn(UINT8 conn, UINT8 status)
+{
+    bl_CanTpDoIpConn_t *pConn = &gs_CanTpDoIpConn[conn];
+
+    pConn->status = status;
+    pConn->node = CANTP_DOIP_NONE;
+    pConn->rspNode = CANTP_DOIP_NONE;
+    pConn->ackCode = CANTP_DOIP_NONE;
+    pConn->ackAddr = 0u;
+    pConn->testerAddr = 0u;
+    pConn->remain = 0u;
+    pConn->hdrSize = 0u;
+    pConn->stageSize = 0u;
+    pConn->head = 0u;
+    pConn->count = 0u;
+
+    return ;
+}
+
+/**************************************************************************//**
+ *
+ *  \details    Close a connection because the DoIP stream is broken.
+ *
+ *  \param[in]  conn - the index of the connection.
+ *
+ *  \return None.
+ *
+ *  \since  V5.2.0
+ *
+ *****************************************************************************/
+static void _CanTpDoIp_Close(UINT8 conn)
+{
+    CANTP_DOIP_CLOSE(conn);
+    CanTpDoIp_Disconnect(conn);
+
+    return ;
+}
+
+/**************************************************************************//**
+ *
+ *  \details    Read the generic header and the addresses of the next message,
+ *              or discard the payload which is not transmitted to a node.
+ *              The user data of a request is read by the tx channel.
+ *
+ *  \param[in]  conn - the index of the connection.
+ *
+ *  \return None.
+ *
+ *  \since  V5.2.0
+ *
+ *****************************************************************************/
+static void _CanTpDoIp_Receive(UINT8 conn)
+{
+    bl_CanTpDoIpConn_t *pConn = &gs_CanTpDoIpConn[conn];
+    bl_BufferSize_t readSize;
+    UINT8 ret;
+
+    switch (pConn->status)
+    {
+        case CANTP_DOIP_CONN_HEADER:
+            /*Keep the order of the ACKs, the next request waits for the ACK.*/
+            if (CANTP_DOIP_NONE == pConn->ackCode)
+            {
+                readSize = CANTP_DOIP_READ(conn,
+                                            &pConn->hdr[pConn->hdrSize],
+                                            CANTP_DOIP_HEADER_SIZE
+                                                - pConn->hdrSize);
+                pConn->hdrSize += readSize;
+
+                if (CANTP_DOIP_HEADER_SIZE == pConn->hdrSize)
+                {
+                    _CanTpDoIp_ProcessHeader(conn);
+                }
+            }
+            break;
+        case CANTP_DOIP_CONN_ADDR:
+            readSize = CANTP_DOIP_READ(conn,
+                                        &pConn->hdr[pConn->hdrSize],
+                                        CANTP_DOIP_HEADER_SIZE
+                                            + CANTP_DOIP_ADDR_SIZE
+                                            - pConn->hdrSize);
+            pConn->hdrSize += readSize;
+
+            if ((CANTP_DOIP_HEADER_SIZE + CANTP_DOIP_ADDR_SIZE)
+                == pConn->hdrSize)
+            {
+                _CanTpDoIp_ProcessAddr(conn);
+            }
+            break;
+        case CANTP_DOIP_CONN_START:
+            /*If the tx channel is busy, the socket is not read any more.*/
+            ret = Cantp_Transmit(g_CanTpDoIpCfg[pConn->node].txHandle,
+                                    (bl_BufferSize_t)pConn->remain);
+            if (ERR_OK == ret)
+            {
+                gs_CanTpDoIpNode[pConn->node].conn = conn;
+                pConn->stageSize = 0u;
+                pConn->status = CANTP_DOIP_CONN_DATA;
+
+                /*The message is accepted for the routing, ACK it at once.*/
+                pConn->ackCode = CANTP_DOIP_ACK_OK;
+                pConn->ackAddr = g_CanTpDoIpCfg[pConn->node].logicalAddr;
+                _CanTpDoIp_SendAck(conn);
+            }
+            break;
+        case CANTP_DOIP_CONN_DISCARD:
+            readSize = (pConn->remain < CANTP_MAX_FRAME_SIZE)
+                        ? (bl_BufferSize_t)pConn->remain
+                        : (bl_BufferSize_t)CANTP_MAX_FRAME_SIZE;
+            readSize = CANTP_DOIP_READ(conn, pConn->stage, readSize);
+            pConn->remain -= readSize;
+
+            if (0u == pConn->remain)
+            {
+                pConn->hdrSize = 0u;
+                pConn->status = CANTP_DOIP_CONN_HEADER;
+            }
+            break;
+        default:
+            /*The user data is read by the tx channel.*/
+            break;
+    }
+
+    return ;
+}
+
+/**************************************************************************//**
+ *
+ *  \details    Process the generic header of the next message. Only the
+ *              diagnostic messages are transmitted, the payload of the other
+ *              messages is discarded.
+ *
+ *  \param[in]  conn - the index of the connection.
+ *
+ *  \return None.
+ *
+ *  \since  V5.2.0
+ *
+ *****************************************************************************/
+static void _CanTpDoIp_ProcessHeader(UINT8 conn)
+{
+    bl_CanTpDoIpConn_t *pConn = &gs_CanTpDoIpConn[conn];
+    const bl_Buffer_t *hdr = pConn->hdr;
+    UINT16 type;
+    UINT32 length;
+
+    type = (UINT16)(((UINT16)hdr[2] << 8) | hdr[3]);
+    length = ((UINT32)hdr[4] << 24) | ((UINT32)hdr[5] << 16)
+                | ((UINT32)hdr[6] << 8) | (UINT32)hdr[7];
+
+    if (((hdr[0] != CANTP_DOIP_VERSION_2012)
+            && (hdr[0] != CANTP_DOIP_VERSION_2019))
+        || ((UINT8)(hdr[0] ^ hdr[1]) != 0xFFu))
+    {
+        /*The stream is not synchronized any more.*/
+        _CanTpDoIp_Close(conn);
+    }
+    else if (type != CANTP_DOIP_TYPE_DIAG_MSG)
+    {
+        pConn->remain = length;
+        pConn->status = (0u == length) ? CANTP_DOIP_CONN_HEADER
+                                        : CANTP_DOIP_CONN_DISCARD;
+        pConn->hdrSize = 0u;
+    }
+    else if (length <= CANTP_DOIP_ADDR_SIZE)
+    {
+        _CanTpDoIp_Close(conn);
+    }
+    else
+    {
+        pConn->remain = length - CANTP_DOIP_ADDR_SIZE;
+        pConn->status = CANTP_DOIP_CONN_ADDR;
+    }
+
+    return ;
+}
+
+/**************************************************************************//**
+ *
+ *  \details    Process the source and target address of a diagnostic
+ *              message, and select the node of the target address.
+ *
+ *  \param[in]  conn - the index of the connection.
+ *
+ *  \return None.
+ *
+ *  \since  V5.2.0
+ *
+ *****************************************************************************/
+static void _CanTpDoIp_ProcessAddr(UINT8 conn)
+{
+    bl_CanTpDoIpConn_t *pConn = &gs_CanTpDoIpConn[conn];
+    const bl_Buffer_t *addr = &pConn->hdr[CANTP_DOIP_HEADER_SIZE];
+    UINT16 ta;
+    UINT8 node;
+
+    pConn->testerAddr = (UINT16)(((UINT16)addr[0] << 8) | addr[1]);
+    ta = (UINT16)(((UINT16)addr[2] << 8) | addr[3]);
+
+    node = _CanTpDoIp_FindNode(ta);
+    if (CANTP_DOIP_NONE == node)
+    {
+        pConn->ackCode = CANTP_DOIP_NACK_UNKNOWN_TA;
+        pConn->ackAddr = ta;
+        pConn->status = CANTP_DOIP_CONN_DISCARD;
+    }
+    else if (pConn->remain > CANTP_DOIP_MAX_MSG_SIZE)
+    {
+        pConn->ackCode = CANTP_DOIP_NACK_TOO_LARGE;
+        pConn->ackAddr = ta;
+        pConn->status = CANTP_DOIP_CONN_DISCARD;
+    }
+    else
+    {
+        pConn->node = node;
+        pConn->status = CANTP_DOIP_CONN_START;
+    }
+
+    return ;
+}
+
+/**************************************************************************//**
+ *
+ *  \details    Write the pending ACK or NACK of a connection. It is not
+ *              written in the middle of a response.
+ *
+ *  \param[in]  conn - the index of the connection.
+ *
+ *  \return None.
+ *
+ *  \since  V5.2.0
+ *
+ *****************************************************************************/
+static void _CanTpDoIp_SendAck(UINT8 conn)
+{
+    bl_CanTpDoIpConn_t *pConn = &gs_CanTpDoIpConn[conn];
+    UINT16 type;
+
+    if ((pConn->ackCode != CANTP_DOIP_NONE)
+        && (CANTP_DOIP_NONE == pConn->rspNode)
+        && (CANTP_DOIP_FREE_SIZE(pConn) >= CANTP_DOIP_ACK_SIZE))
+    {
+        type = (CANTP_DOIP_ACK_OK == pConn->ackCode)
+                ? CANTP_DOIP_TYPE_DIAG_ACK : CANTP_DOIP_TYPE_DIAG_NACK;
+
+        _CanTpDoIp_PushHeader(pConn,
+                                type,
+                                CANTP_DOIP_ADDR_SIZE + 1u,
+                                pConn->ackAddr);
+        _CanTpDoIp_Push(pConn, &pConn->ackCode, 1u);
+
+        pConn->ackCode = CANTP_DOIP_NONE;
+    }
+
+    return ;
+}
+
+/**************************************************************************//**
+ *
+ *  \details    Write the response buffer of a connection to the socket as
+ *              much as the socket accepts.
+ *
+ *  \param[in]  conn - the index of the connection.
+ *
+ *  \return None.
+ *
+ *  \since  V5.2.0
+ *
+ *****************************************************************************/
+static void _CanTpDoIp_Flush(UINT8 conn)
+{
+    bl_CanTpDoIpConn_t *pConn = &gs_CanTpDoIpConn[conn];
+    bl_BufferSize_t size;
+    bl_BufferSize_t writeSize;
+
+    while (pConn->count != 0u)
+    {
+        size = CANTP_DOIP_BUFFER_SIZE - pConn->head;
+        if (size > pConn->count)
+        {
+            size = pConn->count;
+        }
+
+        writeSize = CANTP_DOIP_WRITE(conn, &pConn->buffer[pConn->head], size);
+
+        pConn->head += writeSize;
+        if (pConn->head >= CANTP_DOIP_BUFFER_SIZE)
+        {
+            pConn->head = 0u;
+        }
+        pConn->count -= writeSize;
+
+        if (writeSize != size)
+        {
+            /*The socket is full, try again during the next period.*/
+            break;
+        }
+    }
+
+    return ;
+}
+
+/**************************************************************************//**
+ *
+ *  \details    Put the data into the response buffer of a connection. The
+ *              free size is checked by the caller.
+ *
+ *  \param[in/out]  conn - the pointer of a connection.
+ *  \param[in]      buffer - the data.
+ *  \param[in]      size - the size of the data.
+ *
+ *  \return None.
+ *
+ *  \since  V5.2.0
+ *
+ *****************************************************************************/
+static void _CanTpDoIp_Push(bl_CanTpDoIpConn_t *conn,
+                            const bl_Buffer_t *buffer,
+                            bl_BufferSize_t size)
+{
+    bl_BufferSize_t tail;
+    bl_BufferSize_t part;
+
+    BL_DEBUG_ASSERT_NO_RET(CANTP_DOIP_FREE_SIZE(conn) >= size);
+
+    tail = conn->head + conn->count;
+    if (tail >= CANTP_DOIP_BUFFER_SIZE)
+    {
+        tail -= CANTP_DOIP_BUFFER_SIZE;
+    }
+
+    part = CANTP_DOIP_BUFFER_SIZE - tail;
+    if (part > size)
+    {
+        part = size;
+    }
+
+    FblMemCpy(&conn->buffer[tail], buffer, (UINT16)part);
+    FblMemCpy(conn->buffer, &buffer[part], (UINT16)(size - part));
+    conn->count += size;
+
+    return ;
+}
+
+/**************************************************************************//**
+ *
+ *  \details    Put a generic header, the source address and the address of
+ *              the tester into the response buffer of a connection.
+ *
+ *  \param[in/out]  conn - the pointer of a connection.
+ *  \param[in]      type - the payload type.
+ *  \param[in]      length - the payload length.
+ *  \param[in]      sa - the source address.
+ *
+ *  \return None.
+ *
+ *  \since  V5.2.0
+ *
+ *****************************************************************************/
+static void _CanTpDoIp_PushHeader(bl_CanTpDoIpConn_t *conn,
+                                    UINT16 type,
+                                    UINT32 length,
+                                    UINT16 sa)
+{
+    bl_Buffer_t hdr[CANTP_DOIP_HEADER_SIZE + CANTP_DOIP_ADDR_SIZE];
+
+    hdr[0] = CANTP_DOIP_VERSION_2012;
+    hdr[1] = (bl_Buffer_t)(~CANTP_DOIP_VERSION_2012);
+    hdr[2] = (bl_Buffer_t)(type >> 8);
+    hdr[3] = (bl_Buffer_t)type;
+    hdr[4] = (bl_Buffer_t)(length >> 24);
+    hdr[5] = (bl_Buffer_t)(length >> 16);
+    hdr[6] = (bl_Buffer_t)(length >> 8);
+    hdr[7] = (bl_Buffer_t)length;
+    hdr[8] = (bl_Buffer_t)(sa >> 8);
+    hdr[9] = (bl_Buffer_t)sa;
+    hdr[10] = (bl_Buffer_t)(conn->testerAddr >> 8);
+    hdr[11] = (bl_Buffer_t)conn->testerAddr;
+
+    _CanTpDoIp_Push(conn, hdr, (bl_BufferSize_t)sizeof(hdr));
+
+    return ;
+}
+
+/**************************************************************************//**
+ *
+ *  \details    Find the node of a logical address.
+ *
+ *  \param[in]  addr - the logical address.
+ *
+ *  \return the index of the node, or CANTP_DOIP_NONE.
+ *
+ *  \since  V5.2.0
+ *
+ *****************************************************************************/
+static UINT8 _CanTpDoIp_FindNode(UINT16 addr)
+{
+    UINT8 node = CANTP_DOIP_NONE;
+    UINT8 i;
+
+    for (i = 0; i < CANTP_NUMBER_OF_DOIP_NODE; i++)
+    {
+        if (addr == g_CanTpDoIpCfg[i].logicalAddr)
+        {
+            node = i;
+            break;
+        }
+    }
+
+    return node;
+}
+
+#endif
+
+/*************************************************************************************************************
+                                          End Of File
+*************************************************************************************************************/
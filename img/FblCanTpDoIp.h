@@ -0,0 +1,120 @@
+/*************************************************************************************************************
+*    FileName   :    FblCanTpDoIp.h
+*    Description:    DoIP gateway of the CAN TP module header file.
+
+*    UpdateDate :    2026/10/18
+*    Version    :    1.0.0
+*    History    :
+        1. V1.0.0, 2026/10/18, Initial version.
+
+*************************************************************************************************************/
+#ifndef _FBLCANTPDOIP_H_
+#define _FBLCANTPDOIP_H_
+
+/*************************************************************************************************************
+                                          Header File Includes
+*************************************************************************************************************/
+#include "FblCanTp.h"
+#include "FblCanTpCfg.h"
+
+
+/*************************************************************************************************************
+                                                Macros
+*************************************************************************************************************/
+
+/*****************************************************************************
+ *  Macro Definitions
+ *****************************************************************************/
+/** \brief The handle or connection is not used by any node.*/
+#define CANTP_DOIP_NONE                 (0xFFu)
+
+/** \brief The protocol versions of the DoIP header.*/
+#define CANTP_DOIP_VERSION_2012         (0x02u)
+#define CANTP_DOIP_VERSION_2019         (0x03u)
+/** \brief The size of the DoIP generic header.*/
+#define CANTP_DOIP_HEADER_SIZE          (8u)
+/** \brief The size of the source and target address.*/
+#define CANTP_DOIP_ADDR_SIZE            (4u)
+
+/** \brief The payload types of the DoIP diagnostic messages.*/
+#define CANTP_DOIP_TYPE_DIAG_MSG        (0x8001u)
+#define CANTP_DOIP_TYPE_DIAG_ACK        (0x8002u)
+#define CANTP_DOIP_TYPE_DIAG_NACK       (0x8003u)
+
+/** \brief The codes of the diagnostic message ACK and NACK.*/
+#define CANTP_DOIP_ACK_OK               (0x00u)
+#define CANTP_DOIP_NACK_UNKNOWN_TA      (0x03u)
+#define CANTP_DOIP_NACK_TOO_LARGE       (0x04u)
+#define CANTP_DOIP_NACK_TP_ERROR        (0x08u)
+
+/*****************************************************************************
+ *  Structure Definitions
+ *****************************************************************************/
+/** \brief The configuration of a node reached by the DoIP gateway.*/
+struct _tag_CanTpDoIpCfg
+{
+    UINT16 logicalAddr;          /**< The DoIP logical address of the node.*/
+    bl_CanTpHandle_t rxHandle;  /**< The rx channel receiving the responses.*/
+    bl_CanTpHandle_t txHandle;  /**< The tx channel transmitting the requests.*/
+};
+
+/*****************************************************************************
+ *  Type Declarations
+ *****************************************************************************/
+/** \brief A alias of the struct _tag_CanTpDoIpCfg.*/
+typedef struct _tag_CanTpDoIpCfg bl_CanTpDoIpCfg_t;
+
+/*****************************************************************************
+ *  External Global Variable Declarations
+ *****************************************************************************/
+extern const bl_CanTpDoIpCfg_t g_CanTpDoIpCfg[CANTP_NUMBER_OF_DOIP_NODE];
+
+/*****************************************************************************
+ *  External Function Prototype Declarations
+ *****************************************************************************/
+/** \brief Initialize the DoIP gateway.*/
+extern void CanTpDoIp_Init(void);
+/** \brief The period function of the DoIP gateway.*/
+extern void CanTpDoIp_PeriodFunction(void);
+/** \brief Indicate a DoIP connection is opened.*/
+extern void CanTpDoIp_Connect(UINT8 conn);
+/** \brief Indicate a DoIP connection is closed.*/
+extern void CanTpDoIp_Disconnect(UINT8 conn);
+/** \brief Check if a connection can buffer the next block of a rx channel.*/
+extern UINT8 CanTpDoIp_RxReady(bl_CanTpHandle_t handle,
+                                bl_BufferSize_t size);
+/** \brief Start to receive a message.*/
+extern UINT8 CanTpDoIp_StartOfReception(bl_CanTpHandle_t handle,
+                                        bl_BufferSize_t size);
+/** \brief Copy the received data.*/
+extern UINT8 CanTpDoIp_CopyRxData(bl_CanTpHandle_t handle,
+                                    bl_BufferSize_t size,
+                                    const bl_Buffer_t *buffer);
+/** \brief Indicate a message is received.*/
+extern void CanTpDoIp_RxIndication(bl_CanTpHandle_t handle,
+                                    UINT8 taType,
+                                    bl_CanTpResult_t result);
+/** \brief Copy the transmitting data.*/
+extern UINT8 CanTpDoIp_CopyTxData(bl_CanTpHandle_t handle,
+                                    bl_BufferSize_t size,
+                                    bl_Buffer_t *buffer);
+/** \brief Confirm a message is transmitted.*/
+extern void CanTpDoIp_TxConfirmation(bl_CanTpHandle_t handle,
+                                        bl_CanTpResult_t result);
+
+/** \brief Read the data of a DoIP connection, provided by the socket driver.*/
+extern bl_BufferSize_t DoIp_SocketRead(UINT8 conn,
+                                        bl_Buffer_t *buffer,
+                                        bl_BufferSize_t size);
+/** \brief Write the data to a DoIP connection, provided by the socket driver.*/
+extern bl_BufferSize_t DoIp_SocketWrite(UINT8 conn,
+                                        const bl_Buffer_t *buffer,
+                                        bl_BufferSize_t size);
+/** \brief Close a DoIP connection, provided by the socket driver.*/
+extern void DoIp_SocketClose(UINT8 conn);
+
+/*************************************************************************************************************
+                                               End Of File
+*************************************************************************************************************/
+#endif
+
@@ -0,0 +1,429 @@
+/*************************************************************************************************************
+*    FileName   :    FblCanTpRoute.c
+*    Description:    Cut-through routing of the CAN TP module.
+*                    A route pairs a rx channel on a bus with a tx channel on
+*                    another bus. When the FF is received, the tx channel
+*                    starts to transmit the message at once, and the CF data
+*                    is forwarded through a sliding window while the message
+*                    is still arriving. The data is segmented again by the tx
+*                    channel for the frame size of the target bus. The FC of
+*                    the rx channel is held until the window can buffer the
+*                    next block, so the slower bus throttles the faster one.
+
+*    UpdateDate :    2026/10/18
+*    Version    :    1.0.0
+*    History    :
+        1. V1.0.0, 2026/10/18, Initial version.
+
+*************************************************************************************************************/
+
+/*************************************************************************************************************
+                                             Include Files
+*************************************************************************************************************/
+#include "FblCanTpRoute.h"
+#include "FblUdsDiag.h"
+#include "FblString.h"
+#if (CANTP_FUN_RX_STREAM == ON)
+#include "FblCanTpStream.h"
+#endif
+
+#if (CANTP_FUN_GATEWAY_ROUTING == ON)
+/*************************************************************************************************************
+                                     Local Function Declarations
+ ************************************************************************************************************/
+
+/*****************************************************************************
+ *  Internal Type Definitions
+ *****************************************************************************/
+/** \brief A alias of the struct _tag_CanTpRoute.*/
+typedef struct _tag_CanTpRoute bl_CanTpRoute_t;
+
+/*****************************************************************************
+ *  Internal Structure Definitions
+ *****************************************************************************/
+/** \brief The runtime data of a route.*/
+struct _tag_CanTpRoute
+{
+    UINT8 rxActive;   /**< The rx channel is receiving the message.*/
+    UINT8 txActive;   /**< The tx channel is transmitting the message.*/
+    UINT8 aborted;    /**< The rx or tx channel is failed.*/
+    bl_BufferSize_t head;  /**< The position of the first data in window.*/
+    bl_BufferSize_t count; /**< The size of the data in window.*/
+    bl_Buffer_t window[CANTP_ROUTE_WINDOW_SIZE]; /**< The sliding window.*/
+};
+
+/*****************************************************************************
+ *  Internal Function Declarations
+ *****************************************************************************/
+/** \brief Check if a route is transferring a message.*/
+static UINT8 _CanTpRoute_IsActive(const bl_CanTpRoute_t *route);
+
+/*****************************************************************************
+ *  Internal Variable Definitions
+ *****************************************************************************/
+/** \brief The runtime data of the routes.*/
+static bl_CanTpRoute_t gs_CanTpRoute[CANTP_NUMBER_OF_ROUTE];
+/** \brief The route used by each rx channel.*/
+static UINT8 gs_RxRoute[CANTP_NUMBER_OF_RX_CHANNEL];
+/** \brief The route used by each tx channel.*/
+static UINT8 gs_TxRoute[CANTP_NUMBER_OF_TX_CHANNEL];
+
+/*************************************************************************************************************
+                                          Function Definitions
+ ************************************************************************************************************/
+/**************************************************************************//**
+ *
+ *  \details    Initialize the routes.
+ *
+ *  \return None.
+ *
+ *  \since  V5.2.0
+ *
+ *****************************************************************************/
+void CanTpRoute_Init(void)
+{
+    bl_CanTpRoute_t *route;
+    UINT16 i;
+
+    for (i = 0; i < CANTP_NUMBER_OF_RX_CHANNEL; i++)
+    {
+        gs_RxRoute[i] = CANTP_ROUTE_NONE;
+    }
+
+    for (i = 0; i < CANTP_NUMBER_OF_TX_CHANNEL; i++)
+    {
+        gs_TxRoute[i] = CANTP_ROUTE_NONE;
+    }
+
+    for (i = 0; i < CANTP_NUMBER_OF_ROUTE; i++)
+    {
+        BL_DEBUG_ASSERT_NO_RET(g_CanTpRouteCfg[i].rxHandle
+                                < CANTP_NUMBER_OF_RX_CHANNEL);
+        BL_DEBUG_ASSERT_NO_RET(g_CanTpRouteCfg[i].txHandle
+                                < CANTP_NUMBER_OF_TX_CHANNEL);
+
+        gs_RxRoute[g_CanTpRouteCfg[i].rxHandle] = (UINT8)i;
+        gs_TxRoute[g_CanTpRouteCfg[i].txHandle] = (UINT8)i;
+
+        route = &gs_CanTpRoute[i];
+        route->rxActive = FALSE;
+        route->txActive = FALSE;
+        route->aborted = FALSE;
+        route->head = 0u;
+        route->count = 0u;
+    }
+
+    return ;
+}
+
+/**************************************************************************//**
+ *
+ *  \details    Check if the window of a route can buffer the next block
+ *              received by a rx channel.
+ *
+ *  \param[in]  handle - the rx handle.
+ *  \param[in]  size - the size of the data in the next block.
+ *
+ *  \return If the next block can be received returns TRUE, otherwise
+ *          returns FALSE.
+ *
+ *  \since  V5.2.0
+ *
+ *****************************************************************************/
+UINT8 CanTpRoute_RxReady(bl_CanTpHandle_t handle, bl_BufferSize_t size)
+{
+    const bl_CanTpRoute_t *route;
+    UINT8 ret = TRUE;
+
+    BL_DEBUG_ASSERT_PARAM(handle < CANTP_NUMBER_OF_RX_CHANNEL);
+
+    if (gs_RxRoute[handle] != CANTP_ROUTE_NONE)
+    {
+        route = &gs_CanTpRoute[gs_RxRoute[handle]];
+
+        if ((FALSE == route->aborted)
+            && ((CANTP_ROUTE_WINDOW_SIZE - route->count) < size))
+        {
+            ret = FALSE;
+        }
+    }
+
+    return ret;
+}
+
+/**************************************************************************//**
+ *
+ *  \details    Start to receive a message. If the rx channel is routed, the
+ *              tx channel of the route starts to transmit the message at
+ *              once.
+ *
+ *  \param[in]  handle - the rx handle.
+ *  \param[in]  size - the total size of the message.
+ *
+ *  \return If the message can be received returns ERR_OK. If the route is
+ *          busy returns ERR_ERROR, and the rx channel tries again.
+ *
+ *  \since  V5.2.0
+ *
+ *****************************************************************************/
+UINT8 CanTpRoute_StartOfReception(bl_CanTpHandle_t handle,
+                                    bl_BufferSize_t size)
+{
+    bl_CanTpRoute_t *route;
+    UINT8 ret = ERR_ERROR;
+
+    BL_DEBUG_ASSERT_PARAM(handle < CANTP_NUMBER_OF_RX_CHANNEL);
+
+    if (CANTP_ROUTE_NONE == gs_RxRoute[handle])
+    {
+        ret = CANTP_APP_START_OF_RECEPTION(handle, size);
+    }
+    else
+    {
+        route = &gs_CanTpRoute[gs_RxRoute[handle]];
+
+        if (FALSE == _CanTpRoute_IsActive(route))
+        {
+            route->head = 0u;
+            route->count = 0u;
+            route->aborted = FALSE;
+
+            ret = Cantp_Transmit(g_CanTpRouteCfg[gs_RxRoute[handle]].txHandle,
+                                    size);
+            if (ERR_OK == ret)
+            {
+                route->rxActive = TRUE;
+                route->txActive = TRUE;
+            }
+        }
+    }
+
+    return ret;
+}
+
+/**************************************************************************//**
+ *
+ *  \details    Copy the received data into the window of a route.
+ *
+ *  \param[in]  handle - the rx handle.
+ *  \param[in]  size - the size of the data.
+ *  \param[in]  buffer - the data.
+ *
+ *  \return If the data is buffered returns ERR_OK, otherwise returns
+ *          ERR_ERROR.
+ *
+ *  \since  V5.2.0
+ *
+ *****************************************************************************/
+UINT8 CanTpRoute_CopyRxData(bl_CanTpHandle_t handle,
+                            bl_BufferSize_t size,
+                            const bl_Buffer_t *buffer)
+{
+    bl_CanTpRoute_t *route;
+    bl_BufferSize_t tail;
+    bl_BufferSize_t part;
+    UINT8 ret = ERR_ERROR;
+
+    BL_DEBUG_ASSERT_PARAM(handle < CANTP_NUMBER_OF_RX_CHANNEL);
+
+    if (CANTP_ROUTE_NONE == gs_RxRoute[handle])
+    {
+        ret = CANTP_APP_COPY_RX_DATA(handle, size, buffer);
+    }
+    else
+    {
+        route = &gs_CanTpRoute[gs_RxRoute[handle]];
+
+        if ((FALSE == route->aborted)
+            && ((CANTP_ROUTE_WINDOW_SIZE - route->count) >= size))
+        {
+            tail = route->head + route->count;
+            if (tail >= CANTP_ROUTE_WINDOW_SIZE)
+            {
+                tail -= CANTP_ROUTE_WINDOW_SIZE;
+            }
+
+            part = CANTP_ROUTE_WINDOW_SIZE - tail;
+            if (part > size)
+            {
+                part = size;
+            }
+
+            FblMemCpy(&route->window[tail], buffer, (UINT16)part);
+            FblMemCpy(route->window, &buffer[part], (UINT16)(size - part));
+            route->count += size;
+
+            ret = ERR_OK;
+        }
+    }
+
+    return ret;
+}
+
+/**************************************************************************//**
+ *
+ *  \details    Indicate a message is received. If the message of a route is
+ *              failed, the tx channel of the route is stopped.
+ *
+ *  \param[in]  handle - the rx handle.
+ *  \param[in]  taType - the TA type of the rx channel.
+ *  \param[in]  result - the result of the reception.
+ *
+ *  \return None.
+ *
+ *  \since  V5.2.0
+ *
+ *****************************************************************************/
+void CanTpRoute_RxIndication(bl_CanTpHandle_t handle,
+                                UINT8 taType,
+                                bl_CanTpResult_t result)
+{
+    bl_CanTpRoute_t *route;
+
+    BL_DEBUG_ASSERT_NO_RET(handle < CANTP_NUMBER_OF_RX_CHANNEL);
+
+    if (CANTP_ROUTE_NONE == gs_RxRoute[handle])
+    {
+        CANTP_APP_RX_INDICATION(handle, taType, result);
+    }
+    else
+    {
+        route = &gs_CanTpRoute[gs_RxRoute[handle]];
+
+        if (route->rxActive != FALSE)
+        {
+            route->rxActive = FALSE;
+            if (result != ERR_OK)
+            {
+                route->aborted = TRUE;
+            }
+        }
+    }
+
+    return ;
+}
+
+/**************************************************************************//**
+ *
+ *  \details    Copy the transmitting data from the window of a route.
+ *
+ *  \param[in]  handle - the tx handle.
+ *  \param[in]  size - the size of the data.
+ *  \param[out] buffer - the data.
+ *
+ *  \return If the data is copied returns ERR_OK. If the data is not
+ *          received yet returns ERR_ERROR, and the tx channel tries again.
+ *
+ *  \since  V5.2.0
+ *
+ *****************************************************************************/
+UINT8 CanTpRoute_CopyTxData(bl_CanTpHandle_t handle,
+                            bl_BufferSize_t size,
+                            bl_Buffer_t *buffer)
+{
+    bl_CanTpRoute_t *route;
+    bl_BufferSize_t part;
+    UINT8 ret = ERR_ERROR;
+
+    BL_DEBUG_ASSERT_PARAM(handle < CANTP_NUMBER_OF_TX_CHANNEL);
+
+    if (CANTP_ROUTE_NONE == gs_TxRoute[handle])
+    {
+        ret = CANTP_APP_COPY_TX_DATA(handle, size, buffer);
+    }
+    else
+    {
+        route = &gs_CanTpRoute[gs_TxRoute[handle]];
+
+        if ((FALSE == route->aborted) && (route->count >= size))
+        {
+            part = CANTP_ROUTE_WINDOW_SIZE - route->head;
+            if (part > size)
+            {
+                part = size;
+            }
+
+            FblMemCpy(buffer, &route->window[route->head], (UINT16)part);
+            FblMemCpy(&buffer[part], route->window, (UINT16)(size - part));
+
+            route->head += size;
+            if (route->head >= CANTP_ROUTE_WINDOW_SIZE)
+            {
+                route->head -= CANTP_ROUTE_WINDOW_SIZE;
+            }
+            route->count -= size;
+
+            ret = ERR_OK;
+        }
+    }
+
+    return ret;
+}
+
+/**************************************************************************//**
+ *
+ *  \details    Confirm a message is transmitted. If the message of a route is
+ *              failed, the rx channel of the route is stopped.
+ *
+ *  \param[in]  handle - the tx handle.
+ *  \param[in]  result - the result of the transmission.
+ *
+ *  \return None.
+ *
+ *  \since  V5.2.0
+ *
+ *****************************************************************************/
+void CanTpRoute_TxConfirmation(bl_CanTpHandle_t handle,
+                                bl_CanTpResult_t result)
+{
+    bl_CanTpRoute_t *route;
+
+    BL_DEBUG_ASSERT_NO_RET(handle < CANTP_NUMBER_OF_TX_CHANNEL);
+
+    if (CANTP_ROUTE_NONE == gs_TxRoute[handle])
+    {
+        CANTP_APP_TX_CONFIRMATION(handle, result);
+    }
+    else
+    {
+        route = &gs_CanTpRoute[gs_TxRoute[handle]];
+
+        route->txActive = FALSE;
+        if (result != ERR_OK)
+        {
+            route->aborted = TRUE;
+        }
+    }
+
+    return ;
+}
+
+/**************************************************************************//**
+ *
+ *  \details    Check if a route is transferring a message.
+ *
+ *  \param[in]  route - the pointer of a route.
+ *
+ *  \return If the rx or tx channel of the route is busy returns TRUE,
+ *          otherwise returns FALSE.
+ *
+ *  \since  V5.2.0
+ *
+ *****************************************************************************/
+static UINT8 _CanTpRoute_IsActive(const bl_CanTpRoute_t *route)
+{
+    UINT8 ret = FALSE;
+
+    if ((route->rxActive != FALSE) || (route->txActive != FALSE))
+    {
+        ret = TRUE;
+    }
+
+    return ret;
+}
+
+#endif
+
+/*************************************************************************************************************
+                                          End Of File
+*************************************************************************************************************/
@@ -0,0 +1,83 @@
+/*************************************************************************************************************
+*    FileName   :    FblCanTpRoute.h
+*    Description:    Cut-through routing of the CAN TP module header file.
+
+*    UpdateDate :    2026/10/18
+*    Version    :    1.0.0
+*    History    :
+        1. V1.0.0, 2026/10/18, Initial version.
+
+*************************************************************************************************************/
+#ifndef _FBLCANTPROUTE_H_
+#define _FBLCANTPROUTE_H_
+
+/*************************************************************************************************************
+                                          Header File Includes
+*************************************************************************************************************/
+#include "FblCanTp.h"
+#include "FblCanTpCfg.h"
+
+
+/*************************************************************************************************************
+                                                Macros
+*************************************************************************************************************/
+
+/*****************************************************************************
+ *  Macro Definitions
+ *****************************************************************************/
+/** \brief The handle is not used by any route.*/
+#define CANTP_ROUTE_NONE                (0xFFu)
+
+/*****************************************************************************
+ *  Structure Definitions
+ *****************************************************************************/
+/** \brief The configuration of a route.*/
+struct _tag_CanTpRouteCfg
+{
+    bl_CanTpHandle_t rxHandle;  /**< The rx channel receiving the message.*/
+    bl_CanTpHandle_t txHandle;  /**< The tx channel transmitting the message.*/
+};
+
+/*****************************************************************************
+ *  Type Declarations
+ *****************************************************************************/
+/** \brief A alias of the struct _tag_CanTpRouteCfg.*/
+typedef struct _tag_CanTpRouteCfg bl_CanTpRouteCfg_t;
+
+/*****************************************************************************
+ *  External Global Variable Declarations
+ *****************************************************************************/
+extern const bl_CanTpRouteCfg_t g_CanTpRouteCfg[CANTP_NUMBER_OF_ROUTE];
+
+/*****************************************************************************
+ *  External Function Prototype Declarations
+ *****************************************************************************/
+/** \brief Initialize the routes.*/
+extern void CanTpRoute_Init(void);
+/** \brief Check if a route can buffer the next block of a rx channel.*/
+extern UINT8 CanTpRoute_RxReady(bl_CanTpHandle_t handle,
+                                bl_BufferSize_t size);
+/** \brief Start to receive a message.*/
+extern UINT8 CanTpRoute_StartOfReception(bl_CanTpHandle_t handle,
+                                            bl_BufferSize_t size);
+/** \brief Copy the received data.*/
+extern UINT8 CanTpRoute_CopyRxData(bl_CanTpHandle_t handle,
+                                    bl_BufferSize_t size,
+                                    const bl_Buffer_t *buffer);
+/** \brief Indicate a message is received.*/
+extern void CanTpRoute_RxIndication(bl_CanTpHandle_t handle,
+                                    UINT8 taType,
+                                    bl_CanTpResult_t result);
+/** \brief Copy the transmitting data.*/
+extern UINT8 CanTpRoute_CopyTxData(bl_CanTpHandle_t handle,
+                                    bl_BufferSize_t size,
+                                    bl_Buffer_t *buffer);
+/** \brief Confirm a message is transmitted.*/
+extern void CanTpRoute_TxConfirmation(bl_CanTpHandle_t handle,
+                                        bl_CanTpResult_t result);
+
+/*************************************************************************************************************
+                                               End Of File
+*************************************************************************************************************/
+#endif
+
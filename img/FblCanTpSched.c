@@ -0,0 +1,336 @@
+/*************************************************************************************************************
+*    FileName   :    FblCanTpSched.c
+*    Description:    Scheduler of the client sessions of the CAN TP module.
+*                    Several physical sessions (one for each ECU) run at once
+*                    on one bus. Each session keeps the STmin of its peer by
+*                    the cantp channel, the scheduler limits the frames of all
+*                    sessions in a period to the bus capacity and rotates the
+*                    first session in each period. A session waiting for a FC
+*                    or a response (e.g. the ECU is writing the flash) does
+*                    not use the budget, so the other sessions use the gap.
+
+*    UpdateDate :    2026/10/18
+*    Version    :    1.0.0
+*    History    :
+        1. V1.0.0, 2026/10/18, Initial version.
+
+*************************************************************************************************************/
+
+/*************************************************************************************************************
+                                             Include Files
+*************************************************************************************************************/
+#include "FblCanTpSched.h"
+
+#if (CANTP_FUN_CLIENT_SCHEDULER == ON)
+/*************************************************************************************************************
+                                     Local Function Declarations
+ ************************************************************************************************************/
+/** \brief The total frames used to calculate the bus share without overflow.*/
+#define CANTP_SCHED_MAX_SCALE_FRAMES    (0x00400000uL)
+
+/*****************************************************************************
+ *  Internal Variable Definitions
+ *****************************************************************************/
+/** \brief The frames can be transmitted during the current period.*/
+static UINT16 gs_FrameBudget;
+/** \brief The size of the pending request of each tx channel.*/
+static bl_BufferSize_t gs_PendingSize[CANTP_NUMBER_OF_TX_CHANNEL];
+/** \brief The bus statistics of each session.*/
+static bl_CanTpSchedStat_t gs_SchedStat[CANTP_SCHED_NUMBER_OF_STAT];
+
+/*************************************************************************************************************
+                                          Function Definitions
+ ************************************************************************************************************/
+/**************************************************************************//**
+ *
+ *  \details    Initialize the scheduler.
+ *
+ *  \return None.
+ *
+ *  \since  V5.2.0
+ *
+ *****************************************************************************/
+void CanTpSched_Init(void)
+{
+    UINT16 i;
+
+    gs_FrameBudget = CANTP_SCHED_FRAMES_PER_PERIOD;
+
+    for (i = 0; i < CANTP_NUMBER_OF_TX_CHANNEL; i++)
+    {
+        gs_PendingSize[i] = 0u;
+    }
+
+    CanTpSched_ResetStatistics();
+
+    return ;
+}
+
+/**************************************************************************//**
+ *
+ *  \details    Refill the frame budget of the bus and start the pending
+ *              requests. It is called at the beginning of the period function
+ *              of the cantp module.
+ *
+ *  \return None.
+ *
+ *  \since  V5.2.0
+ *
+ *****************************************************************************/
+void CanTpSched_PeriodFunction(void)
+{
+    UINT16 i;
+    UINT8 ret;
+
+    gs_FrameBudget = CANTP_SCHED_FRAMES_PER_PERIOD;
+
+    for (i = 0; i < CANTP_NUMBER_OF_TX_CHANNEL; i++)
+    {
+        if (gs_PendingSize[i] != 0u)
+        {
+            ret = Cantp_Transmit((bl_CanTpHandle_t)i, gs_PendingSize[i]);
+            if (ERR_OK == ret)
+            {
+                gs_PendingSize[i] = 0u;
+            }
+            else if (ERR_OVERFLOW == ret)
+            {
+                /*The request can not be transmitted by the channel.*/
+                gs_PendingSize[i] = 0u;
+                CANTP_UL_TX_CONFIRMATION((bl_CanTpHandle_t)i, ERR_ERROR);
+            }
+            else
+            {
+                /*The tx channel is busy, try again in the next period.*/
+            }
+        }
+    }
+
+    return ;
+}
+
+/**************************************************************************//**
+ *
+ *  \details    Transmit a request on a session. If the tx channel of the
+ *              session is busy, the request is saved and started as soon as
+ *              the tx channel is idle, so the next TransferData of a session
+ *              can be queued while the ECU is writing the flash.
+ *
+ *  \param[in]  handle - the tx handle of the session.
+ *  \param[in]  size - the size of the request.
+ *
+ *  \return If the request is started or saved returns ERR_OK. If a request
+ *          of the session is already saved, or the channel can not transmit
+ *          the request, returns ERR_ERROR.
+ *
+ *  \since  V5.2.0
+ *
+ *****************************************************************************/
+UINT8 CanTpSched_Transmit(bl_CanTpHandle_t handle, bl_BufferSize_t size)
+{
+    UINT8 ret = ERR_ERROR;
+
+    BL_DEBUG_ASSERT_PARAM(handle < CANTP_NUMBER_OF_TX_CHANNEL);
+    BL_DEBUG_ASSERT_PARAM(size != 0);
+
+    if (0u == gs_PendingSize[handle])
+    {
+        ret = Cantp_Transmit(handle, size);
+        if (ERR_OVERFLOW == ret)
+        {
+            /*The request can not be transmitted by the channel.*/
+            ret = ERR_ERROR;
+        }
+        else if (ret != ERR_OK)
+        {
+            gs_PendingSize[handle] = size;
+            ret = ERR_OK;
+        }
+        else
+        {
+            /*The request is started.*/
+        }
+    }
+
+    return ret;
+}
+
+/**************************************************************************//**
+ *
+ *  \details    Check if a channel is allowed to transmit a frame during the
+ *              current period. The budget is charged by
+ *              CanTpSched_FrameTransmitted when the frame is transmitted.
+ *
+ *  \param[in]  handle - the handle of the channel, it is also the handle of
+ *                       the session.
+ *
+ *  \return If the bus budget is enough returns TRUE, otherwise returns FALSE.
+ *
+ *  \since  V5.2.0
+ *
+ *****************************************************************************/
+UINT8 CanTpSched_GrantFrame(bl_CanTpHandle_t handle)
+{
+    UINT8 ret = FALSE;
+
+    BL_DEBUG_ASSERT_PARAM(handle < CANTP_SCHED_NUMBER_OF_STAT);
+
+    if (gs_FrameBudget != 0u)
+    {
+        ret = TRUE;
+    }
+    else
+    {
+        gs_SchedStat[handle].deferred += 1u;
+    }
+
+    return ret;
+}
+
+/**************************************************************************//**
+ *
+ *  \details    Indicate a frame of a session is transmitted by the CAN
+ *              driver, the frame uses the bus budget of the current period.
+ *
+ *  \param[in]  handle - the handle of the session.
+ *
+ *  \return None.
+ *
+ *  \since  V5.2.0
+ *
+ *****************************************************************************/
+void CanTpSched_FrameTransmitted(bl_CanTpHandle_t handle)
+{
+    BL_DEBUG_ASSERT_NO_RET(handle < CANTP_SCHED_NUMBER_OF_STAT);
+
+    if (gs_FrameBudget != 0u)
+    {
+        gs_FrameBudget -= 1u;
+    }
+
+    gs_SchedStat[handle].txFrames += 1u;
+
+    return ;
+}
+
+/**************************************************************************//**
+ *
+ *  \details    Indicate a frame of a session is received. The received frame
+ *              also uses the bus, so the bus budget is reduced.
+ *
+ *  \param[in]  handle - the handle of the session.
+ *
+ *  \return None.
+ *
+ *  \since  V5.2.0
+ *
+ *****************************************************************************/
+void CanTpSched_FrameReceived(bl_CanTpHandle_t handle)
+{
+    BL_DEBUG_ASSERT_NO_RET(handle < CANTP_SCHED_NUMBER_OF_STAT);
+
+    if (gs_FrameBudget != 0u)
+    {
+        gs_FrameBudget -= 1u;
+    }
+
+    gs_SchedStat[handle].rxFrames += 1u;
+
+    return ;
+}
+
+/**************************************************************************//**
+ *
+ *  \details    Get the share of the bus used by a session since the
+ *              statistics are cleared.
+ *
+ *  \param[in]  handle - the handle of the session.
+ *
+ *  \return the bus share in CANTP_SCHED_BUS_SHARE_UNIT.
+ *
+ *  \since  V5.2.0
+ *
+ *****************************************************************************/
+UINT16 CanTpSched_GetBusShare(bl_CanTpHandle_t handle)
+{
+    UINT32 total = 0u;
+    UINT32 frames;
+    UINT16 share = 0u;
+    UINT16 i;
+
+    BL_DEBUG_ASSERT_PARAM(handle < CANTP_SCHED_NUMBER_OF_STAT);
+
+    for (i = 0; i < CANTP_SCHED_NUMBER_OF_STAT; i++)
+    {
+        total += gs_SchedStat[i].txFrames + gs_SchedStat[i].rxFrames;
+    }
+
+    frames = gs_SchedStat[handle].txFrames + gs_SchedStat[handle].rxFrames;
+
+    if (total >= CANTP_SCHED_MAX_SCALE_FRAMES)
+    {
+        share = (UINT16)(frames / (total / CANTP_SCHED_BUS_SHARE_UNIT));
+    }
+    else if (total != 0u)
+    {
+        share = (UINT16)((frames * CANTP_SCHED_BUS_SHARE_UNIT) / total);
+    }
+    else
+    {
+        /*No frame is on the bus.*/
+    }
+
+    return share;
+}
+
+/**************************************************************************//**
+ *
+ *  \details    Get the bus statistics of a session.
+ *
+ *  \param[in]  handle - the handle of the session.
+ *  \param[out] stat - the bus statistics.
+ *
+ *  \return None.
+ *
+ *  \since  V5.2.0
+ *
+ *****************************************************************************/
+void CanTpSched_GetStatistics(bl_CanTpHandle_t handle,
+                                bl_CanTpSchedStat_t *stat)
+{
+    BL_DEBUG_ASSERT_NO_RET(handle < CANTP_SCHED_NUMBER_OF_STAT);
+    BL_DEBUG_ASSERT_NO_RET(stat != NULL_PTR);
+
+    *stat = gs_SchedStat[handle];
+
+    return ;
+}
+
+/**************************************************************************//**
+ *
+ *  \details    Clear the bus statistics of all sessions.
+ *
+ *  \return None.
+ *
+ *  \since  V5.2.0
+ *
+ *****************************************************************************/
+void CanTpSched_ResetStatistics(void)
+{
+    UINT16 i;
+
+    for (i = 0; i < CANTP_SCHED_NUMBER_OF_STAT; i++)
+    {
+        gs_SchedStat[i].txFrames = 0u;
+        gs_SchedStat[i].rxFrames = 0u;
+        gs_SchedStat[i].deferred = 0u;
+    }
+
+    return ;
+}
+
+#endif
+
+/*************************************************************************************************************
+                                          End Of File
+*************************************************************************************************************/
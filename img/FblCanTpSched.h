@@ -0,0 +1,79 @@
+/*************************************************************************************************************
+*    FileName   :    FblCanTpSched.h
+*    Description:    Scheduler of the client sessions of the CAN TP module header file.
+
+*    UpdateDate :    2026/10/18
+*    Version    :    1.0.0
+*    History    :
+        1. V1.0.0, 2026/10/18, Initial version.
+
+*************************************************************************************************************/
+#ifndef _FBLCANTPSCHED_H_
+#define _FBLCANTPSCHED_H_
+
+/*************************************************************************************************************
+                                          Header File Includes
+*************************************************************************************************************/
+#include "FblCanTp.h"
+#include "FblCanTpCfg.h"
+
+
+/*************************************************************************************************************
+                                                Macros
+*************************************************************************************************************/
+
+/*****************************************************************************
+ *  Macro Definitions
+ *****************************************************************************/
+/** \brief The number of the statistics, one for each tx channel.*/
+#define CANTP_SCHED_NUMBER_OF_STAT      (CANTP_NUMBER_OF_TX_CHANNEL)
+
+/** \brief The unit of the bus share.*/
+#define CANTP_SCHED_BUS_SHARE_UNIT      (1000u)
+
+/*****************************************************************************
+ *  Structure Definitions
+ *****************************************************************************/
+/** \brief The bus statistics of a session.*/
+struct _tag_CanTpSchedStat
+{
+    UINT32 txFrames;  /**< The frames transmitted by the session.*/
+    UINT32 rxFrames;  /**< The frames received by the session.*/
+    UINT32 deferred;  /**< The frames deferred because of the bus budget.*/
+};
+
+/*****************************************************************************
+ *  Type Declarations
+ *****************************************************************************/
+/** \brief A alias of the struct _tag_CanTpSchedStat.*/
+typedef struct _tag_CanTpSchedStat bl_CanTpSchedStat_t;
+
+/*****************************************************************************
+ *  External Function Prototype Declarations
+ *****************************************************************************/
+/** \brief Initialize the scheduler.*/
+extern void CanTpSched_Init(void);
+/** \brief The period function of the scheduler.*/
+extern void CanTpSched_PeriodFunction(void);
+/** \brief Transmit a request on a session.*/
+extern UINT8 CanTpSched_Transmit(bl_CanTpHandle_t handle,
+                                    bl_BufferSize_t size);
+/** \brief Check if a channel is allowed to transmit a frame.*/
+extern UINT8 CanTpSched_GrantFrame(bl_CanTpHandle_t handle);
+/** \brief Indicate a frame of a session is transmitted.*/
+extern void CanTpSched_FrameTransmitted(bl_CanTpHandle_t handle);
+/** \brief Indicate a frame of a session is received.*/
+extern void CanTpSched_FrameReceived(bl_CanTpHandle_t handle);
+/** \brief Get the bus share of a session.*/
+extern UINT16 CanTpSched_GetBusShare(bl_CanTpHandle_t handle);
+/** \brief Get the bus statistics of a session.*/
+extern void CanTpSched_GetStatistics(bl_CanTpHandle_t handle,
+                                        bl_CanTpSchedStat_t *stat);
+/** \brief Clear the bus statistics of all sessions.*/
+extern void CanTpSched_ResetStatistics(void);
+
+/*************************************************************************************************************
+                                               End Of File
+*************************************************************************************************************/
+#endif
+
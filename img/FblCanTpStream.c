@@ -0,0 +1,2165 @@
+/*************************************************************************************************************
+*    FileName   :    FblCanTpStream.c
+*    Description:    Streaming decompression stage of the CAN TP module.
+*                    The stage is between the cantp channels and the Diag.
+*                    The compressionMethod of a RequestDownload selects the
+*                    decoder of the download, and the data of each following
+*                    TransferData is decompressed while the CFs arrive. The
+*                    output is written by the programming callback, and only
+*                    the SID and the blockSequenceCounter are copied to the
+*                    Diag. The RAM used is the window of the decoder and the
+*                    output buffer.
+*                    A delta download is a patch of the installed image, its
+*                    commands insert new data or copy the data of the
+*                    installed image, so only the changes are transferred.
+*                    A block query asks if a block in the flash is same as
+*                    the block of the tester, by the index of the block
+*                    hashes in the flash, before the block is downloaded.
+*                    The CRC-32 and SHA-256 of the data of a download are
+*                    calculated while it is received, so the data does not
+*                    need to be read back from the flash.
+
+*    UpdateDate :    2026/10/18
+*    Version    :    1.0.0
+*    History    :
+        1. V1.0.0, 2026/10/18, Initial version.
+
+*************************************************************************************************************/
+
+/*************************************************************************************************************
+                                             Include Files
+*************************************************************************************************************/
+#include "FblCanTpStream.h"
+#include "FblUdsDiag.h"
+#include "FblString.h"
+
+#if (CANTP_FUN_RX_STREAM == ON)
+/*************************************************************************************************************
+                                     Local Function Declarations
+ ************************************************************************************************************/
+/** \brief The number of the decoders.*/
+#define CANTP_NUMBER_OF_STREAM_DECODER  (2u)
+
+/** \brief The kinds of the next byte of the LZSS data.*/
+#define CANTP_LZSS_STATE_FLAGS          (0u)
+#define CANTP_LZSS_STATE_ITEM           (1u)
+#define CANTP_LZSS_STATE_MATCH          (2u)
+/** \brief The flag bits of a flag byte are used up.*/
+#define CANTP_LZSS_FLAGS_USED           (0x100u)
+
+/** \brief The kinds of the next byte of the delta data.*/
+#define CANTP_DELTA_STATE_COMMAND       (0u)
+#define CANTP_DELTA_STATE_INSERT        (1u)
+#define CANTP_DELTA_STATE_COPY          (2u)
+#define CANTP_DELTA_STATE_SEEK          (3u)
+
+/** \brief The initial value of the CRC-32 register.*/
+#define CANTP_CRC32_INIT_VALUE          (0xFFFFFFFFuL)
+/** \brief The size of a block of the SHA-256.*/
+#define CANTP_SHA256_BLOCK_SIZE         (64u)
+/** \brief The SHA-256 functions.*/
+#define CANTP_SHA256_ROTR(x,n)          (((x) >> (n)) | ((x) << (32u - (n))))
+#define CANTP_SHA256_CH(x,y,z)          (((x) & (y)) ^ ((~(x)) & (z)))
+#define CANTP_SHA256_MAJ(x,y,z)         (((x) & (y)) ^ ((x) & (z)) ^ ((y) & (z)))
+#define CANTP_SHA256_EP0(x)             (CANTP_SHA256_ROTR(x,2u) \
+                                            ^ CANTP_SHA256_ROTR(x,13u) \
+                                            ^ CANTP_SHA256_ROTR(x,22u))
+#define CANTP_SHA256_EP1(x)             (CANTP_SHA256_ROTR(x,6u) \
+                                            ^ CANTP_SHA256_ROTR(x,11u) \
+                                            ^ CANTP_SHA256_ROTR(x,25u))
+#define CANTP_SHA256_SIG0(x)            (CANTP_SHA256_ROTR(x,7u) \
+                                            ^ CANTP_SHA256_ROTR(x,18u) ^ ((x) >> 3))
+#define CANTP_SHA256_SIG1(x)            (CANTP_SHA256_ROTR(x,17u) \
+                                            ^ CANTP_SHA256_ROTR(x,19u) ^ ((x) >> 10))
+
+/*****************************************************************************
+ *  Internal Type Definitions
+ *****************************************************************************/
+/** \brief A alias of the struct _tag_CanTpStreamDecoder.*/
+typedef struct _tag_CanTpStreamDecoder bl_CanTpStreamDecoder_t;
+/** \brief A alias of the struct _tag_CanTpStream.*/
+typedef struct _tag_CanTpStream bl_CanTpStream_t;
+/** \brief A alias of the struct _tag_CanTpLzss.*/
+typedef struct _tag_CanTpLzss bl_CanTpLzss_t;
+/** \brief A alias of the struct _tag_CanTpDelta.*/
+typedef struct _tag_CanTpDelta bl_CanTpDelta_t;
+#if (CANTP_FUN_STREAM_SHA256 == ON)
+/** \brief A alias of the struct _tag_CanTpSha256.*/
+typedef struct _tag_CanTpSha256 bl_CanTpSha256_t;
+#endif
+
+/*****************************************************************************
+ *  Internal Structure Definitions
+ *****************************************************************************/
+/** \brief The decoder of a compressionMethod.*/
+struct _tag_CanTpStreamDecoder
+{
+    UINT8 method;     /**< The compressionMethod of the decoder.*/
+    void (*Init)(void);   /**< Start to decode a download.*/
+    UINT8 (*Decode)(const bl_Buffer_t *buffer,
+                    bl_BufferSize_t size); /**< Decode the next data.*/
+    UINT8 (*IsComplete)(void);  /**< The data ends on a whole item.*/
+};
+
+#if (CANTP_FUN_STREAM_SHA256 == ON)
+/** \brief The running SHA-256 of the data.*/
+struct _tag_CanTpSha256
+{
+    UINT32 state[8];  /**< The hash value.*/
+    UINT32 count;     /**< The size of the data hashed.*/
+    bl_Buffer_t block[CANTP_SHA256_BLOCK_SIZE]; /**< The data of the
+                                                    incomplete block.*/
+};
+#endif
+
+/** \brief The runtime data of the stream.*/
+struct _tag_CanTpStream
+{
+    bl_CanTpHandle_t handle;  /**< The rx handle of the current message.*/
+    bl_BufferSize_t offset;   /**< The size of the message data copied.*/
+    bl_Buffer_t header[CANTP_STREAM_HEADER_SIZE]; /**< The SID and the first
+                                                      parameter.*/
+    UINT8 decoding;   /**< The message is decompressed.*/
+    UINT8 repeated;   /**< The message repeats the last TransferData.*/
+    UINT8 failed;     /**< The data of the download is lost.*/
+    UINT8 active;     /**< A download is requested and not exited.*/
+    UINT8 requested;  /**< A RequestDownload waits for the response.*/
+    UINT8 format;     /**< The dataFormatIdentifier of the RequestDownload.*/
+    bl_BufferSize_t rspCount; /**< The size of the response header saved.*/
+    bl_Buffer_t response[CANTP_STREAM_RESPONSE_SIZE]; /**< The SID, the
+                                                          request SID and the
+                                                          NRC of a response.*/
+    UINT8 lastBsc;    /**< The blockSequenceCounter of the last TransferData.*/
+    UINT8 prevBsc;    /**< The lastBsc before the TransferData waiting for
+                           the response.*/
+    UINT8 blockPending;   /**< A TransferData waits for the response.*/
+    UINT8 blockDecoded;   /**< The data of the TransferData is decoded.*/
+    const bl_CanTpStreamDecoder_t *decoder; /**< The decoder of the download.*/
+    bl_BufferSize_t outCount; /**< The size of the data in the output.*/
+    bl_Buffer_t output[CANTP_STREAM_OUTPUT_SIZE]; /**< The output buffer.*/
+#if (CANTP_FUN_STREAM_CRC32 == ON)
+    UINT32 crc;       /**< The CRC-32 register of the download.*/
+    UINT32 blockCrc;  /**< The CRC-32 register before the TransferData.*/
+#endif
+#if (CANTP_FUN_STREAM_SHA256 == ON)
+    bl_CanTpSha256_t sha;       /**< The SHA-256 of the download.*/
+    bl_CanTpSha256_t blockSha;  /**< The SHA-256 before the TransferData.*/
+#endif
+#if (CANTP_FUN_STREAM_DEDUP == ON)
+    UINT8 answerPending;  /**< The answer of a block query is transmitting.*/
+    bl_Buffer_t answer[CANTP_DEDUP_ANSWER_SIZE]; /**< The answer.*/
+#endif
+};
+
+/** \brief The runtime data of the LZSS decoder.*/
+struct _tag_CanTpLzss
+{
+    UINT8 state;      /**< The kind of the next byte.*/
+    UINT8 low;        /**< The first byte of a match.*/
+    UINT16 flags;     /**< The flag bits left, with the used marks above.*/
+    UINT16 pos;       /**< The position of the next byte in the window.*/
+    bl_Buffer_t window[CANTP_LZSS_WINDOW_SIZE]; /**< The decoded data.*/
+};
+
+/** \brief The runtime data of the delta decoder.*/
+struct _tag_CanTpDelta
+{
+    UINT8 state;      /**< The kind of the next byte.*/
+    UINT8 count;      /**< The bytes left of the current command.*/
+    UINT32 value;     /**< The parameter of the current command.*/
+    UINT32 oldPos;    /**< The position of the next copy in the installed
+                           image.*/
+};
+
+/*****************************************************************************
+ *  Internal Function Declarations
+ *****************************************************************************/
+/** \brief Save the header of a message and select its processing.*/
+static void _CanTpStream_CheckHeader(bl_CanTpStream_t *stream);
+/** \brief Get the decoder of a compressionMethod.*/
+static const bl_CanTpStreamDecoder_t *_CanTpStream_GetDecoder(UINT8 method);
+/** \brief Save the header of the response of the Diag.*/
+static void _CanTpStream_SaveResponse(bl_CanTpStream_t *stream,
+                                        bl_BufferSize_t size,
+                                        const bl_Buffer_t *buffer);
+/** \brief Process the response of the Diag when it is transmitted.*/
+static void _CanTpStream_CheckResponse(bl_CanTpStream_t *stream);
+/** \brief Start the download accepted by the Diag.*/
+static void _CanTpStream_StartDownload(bl_CanTpStream_t *stream);
+/** \brief Drop a TransferData which is failed or rejected.*/
+static void _CanTpStream_DropBlock(bl_CanTpStream_t *stream, UINT8 decoded);
+/** \brief Append a decoded byte to the output.*/
+static UINT8 _CanTpStream_Output(bl_Buffer_t data);
+/** \brief Write the data in the output by the programming callback.*/
+static UINT8 _CanTpStream_Flush(void);
+#if (CANTP_FUN_STREAM_DEDUP == ON)
+/** \brief Check if a block in the flash has the CRC-32.*/
+static UINT8 _CanTpStream_IsSameBlock(UINT16 block, UINT32 crc);
+#endif
+/** \brief Check if the message is a new block of the download.*/
+static UINT8 _CanTpStream_IsNewBlock(const bl_CanTpStream_t *stream);
+/** \brief Start the digests of a download.*/
+static void _CanTpStream_InitDigest(bl_CanTpStream_t *stream);
+/** \brief Update the digests by the data of a download.*/
+static void _CanTpStream_UpdateDigest(bl_CanTpStream_t *stream,
+                                        const bl_Buffer_t *buffer,
+                                        bl_BufferSize_t size);
+/** \brief Save or restore the digests before a TransferData.*/
+static void _CanTpStream_SaveDigest(bl_CanTpStream_t *stream, UINT8 restore);
+#if (CANTP_FUN_STREAM_SHA256 == ON)
+/** \brief Start a SHA-256.*/
+static void _CanTpStream_InitSha256(bl_CanTpSha256_t *sha);
+/** \brief Hash the data by a SHA-256.*/
+static void _CanTpStream_UpdateSha256(bl_CanTpSha256_t *sha,
+                                        const bl_Buffer_t *buffer,
+                                        bl_BufferSize_t size);
+/** \brief Hash a block by a SHA-256.*/
+static void _CanTpStream_TransformSha256(bl_CanTpSha256_t *sha,
+                                            const bl_Buffer_t *block);
+#endif
+/** \brief Start to decode the LZSS data.*/
+static void _CanTpStream_InitLzss(void);
+/** \brief Decode the next LZSS data.*/
+static UINT8 _CanTpStream_DecodeLzss(const bl_Buffer_t *buffer,
+                                        bl_BufferSize_t size);
+/** \brief Check if the LZSS data ends on a whole item.*/
+static UINT8 _CanTpStream_IsLzssComplete(void);
+/** \brief Start to decode the delta data.*/
+static void _CanTpStream_InitDelta(void);
+/** \brief Decode the next delta data.*/
+static UINT8 _CanTpStream_DecodeDelta(const bl_Buffer_t *buffer,
+                                        bl_BufferSize_t size);
+/** \brief Check if the delta data ends on a whole command.*/
+static UINT8 _CanTpStream_IsDeltaComplete(void);
+/** \brief Copy the data of the installed image to the output.*/
+static UINT8 _CanTpStream_CopyOld(UINT32 size);
+
+/*****************************************************************************
+ *  Internal Variable Definitions
+ *****************************************************************************/
+/** \brief The decoders of the stream.*/
+static const bl_CanTpStreamDecoder_t
+    gs_CanTpStreamDecoder[CANTP_NUMBER_OF_STREAM_DECODER] =
+{
+    {
+        CANTP_STREAM_METHOD_LZSS,
+        &_CanTpStream_InitLzss,
+        &_CanTpStream_DecodeLzss,
+        &_CanTpStream_IsLzssComplete
+    },
+    {
+        CANTP_STREAM_METHOD_DELTA,
+        &_CanTpStream_InitDelta,
+        &_CanTpStream_DecodeDelta,
+        &_CanTpStream_IsDeltaComplete
+    },
+};
+
+#if (CANTP_FUN_STREAM_CRC32 == ON)
+/** \brief The slice-by-8 tables of the reflected CRC-32, 0xEDB88320.*/
+static const UINT32 gs_CanTpCrc32Table[8][256] =
+{
+    {
+        0x00000000uL, 0x77073096uL, 0xEE0E612CuL, 0x990951BAuL,
+        0x076DC419uL, 0x706AF48FuL, 0xE963A535uL, 0x9E6495A3uL,
+        0x0EDB8832uL, 0x79DCB8A4uL, 0xE0D5E91EuL, 0x97D2D988uL,
+        0x09B64C2BuL, 0x7EB17CBDuL, 0xE7B82D07uL, 0x90BF1D91uL,
+        0x1DB71064uL, 0x6AB020F2uL, 0xF3B97148uL, 0x84BE41DEuL,
+        0x1ADAD47DuL, 0x6DDDE4EBuL, 0xF4D4B551uL, 0x83D385C7uL,
+        0x136C9856uL, 0x646BA8C0uL, 0xFD62F97AuL, 0x8A65C9ECuL,
+        0x14015C4FuL, 0x63066CD9uL, 0xFA0F3D63uL, 0x8D080DF5uL,
+        0x3B6E20C8uL, 0x4C69105EuL, 0xD56041E4uL, 0xA2677172uL,
+        0x3C03E4D1uL, 0x4B04D447uL, 0xD20D85FDuL, 0xA50AB56BuL,
+        0x35B5A8FAuL, 0x42B2986CuL, 0xDBBBC9D6uL, 0xACBCF940uL,
+        0x32D86CE3uL, 0x45DF5C75uL, 0xDCD60DCFuL, 0xABD13D59uL,
+        0x26D930ACuL, 0x51DE003AuL, 0xC8D75180uL, 0xBFD06116uL,
+        0x21B4F4B5uL, 0x56B3C423uL, 0xCFBA9599uL, 0xB8BDA50FuL,
+        0x2802B89EuL, 0x5F058808uL, 0xC60CD9B2uL, 0xB10BE924uL,
+        0x2F6F7C87uL, 0x58684C11uL, 0xC1611DABuL, 0xB6662D3DuL,
+        0x76DC4190uL, 0x01DB7106uL, 0x98D220BCuL, 0xEFD5102AuL,
+        0x71B18589uL, 0x06B6B51FuL, 0x9FBFE4A5uL, 0xE8B8D433uL,
+        0x7807C9A2uL, 0x0F00F934uL, 0x9609A88EuL, 0xE10E9818uL,
+        0x7F6A0DBBuL, 0x086D3D2DuL, 0x91646C97uL, 0xE6635C01uL,
+        0x6B6B51F4uL, 0x1C6C6162uL, 0x856530D8uL, 0xF262004EuL,
+        0x6C0695EDuL, 0x1B01A57BuL, 0x8208F4C1uL, 0xF50FC457uL,
+        0x65B0D9C6uL, 0x12B7E950uL, 0x8BBEB8EAuL, 0xFCB9887CuL,
+        0x62DD1DDFuL, 0x15DA2D49uL, 0x8CD37CF3uL, 0xFBD44C65uL,
+        0x4DB26158uL, 0x3AB551CEuL, 0xA3BC0074uL, 0xD4BB30E2uL,
+        0x4ADFA541uL, 0x3DD895D7uL, 0xA4D1C46DuL, 0xD3D6F4FBuL,
+        0x4369E96AuL, 0x346ED9FCuL, 0xAD678846uL, 0xDA60B8D0uL,
+        0x44042D73uL, 0x33031DE5uL, 0xAA0A4C5FuL, 0xDD0D7CC9uL,
+        0x5005713CuL, 0x270241AAuL, 0xBE0B1010uL, 0xC90C2086uL,
+        0x5768B525uL, 0x206F85B3uL, 0xB966D409uL, 0xCE61E49FuL,
+        0x5EDEF90EuL, 0x29D9C998uL, 0xB0D09822uL, 0xC7D7A8B4uL,
+        0x59B33D17uL, 0x2EB40D81uL, 0xB7BD5C3BuL, 0xC0BA6CADuL,
+        0xEDB88320uL, 0x9ABFB3B6uL, 0x03B6E20CuL, 0x74B1D29AuL,
+        0xEAD54739uL, 0x9DD277AFuL, 0x04DB2615uL, 0x73DC1683uL,
+        0xE3630B12uL, 0x94643B84uL, 0x0D6D6A3EuL, 0x7A6A5AA8uL,
+        0xE40ECF0BuL, 0x9309FF9DuL, 0x0A00AE27uL, 0x7D079EB1uL,
+        0xF00F9344uL, 0x8708A3D2uL, 0x1E01F268uL, 0x6906C2FEuL,
+        0xF762575DuL, 0x806567CBuL, 0x196C3671uL, 0x6E6B06E7uL,
+        0xFED41B76uL, 0x89D32BE0uL, 0x10DA7A5AuL, 0x67DD4ACCuL,
+        0xF9B9DF6FuL, 0x8EBEEFF9uL, 0x17B7BE43uL, 0x60B08ED5uL,
+        0xD6D6A3E8uL, 0xA1D1937EuL, 0x38D8C2C4uL, 0x4FDFF252uL,
+        0xD1BB67F1uL, 0xA6BC5767uL, 0x3FB506DDuL, 0x48B2364BuL,
+        0xD80D2BDAuL, 0xAF0A1B4CuL, 0x36034AF6uL, 0x41047A60uL,
+        0xDF60EFC3uL, 0xA867DF55uL, 0x316E8EEFuL, 0x4669BE79uL,
+        0xCB61B38CuL, 0xBC66831AuL, 0x256FD2A0uL, 0x5268E236uL,
+        0xCC0C7795uL, 0xBB0B4703uL, 0x220216B9uL, 0x5505262FuL,
+        0xC5BA3BBEuL, 0xB2BD0B28uL, 0x2BB45A92uL, 0x5CB36A04uL,
+        0xC2D7FFA7uL, 0xB5D0CF31uL, 0x2CD99E8BuL, 0x5BDEAE1DuL,
+        0x9B64C2B0uL, 0xEC63F226uL, 0x756AA39CuL, 0x026D930AuL,
+        0x9C0906A9uL, 0xEB0E363FuL, 0x72076785uL, 0x05005713uL,
+        0x95BF4A82uL, 0xE2B87A14uL, 0x7BB12BAEuL, 0x0CB61B38uL,
+        0x92D28E9BuL, 0xE5D5BE0DuL, 0x7CDCEFB7uL, 0x0BDBDF21uL,
+        0x86D3D2D4uL, 0xF1D4E242uL, 0x68DDB3F8uL, 0x1FDA836EuL,
+        0x81BE16CDuL, 0xF6B9265BuL, 0x6FB077E1uL, 0x18B74777uL,
+        0x88085AE6uL, 0xFF0F6A70uL, 0x66063BCAuL, 0x11010B5CuL,
+        0x8F659EFFuL, 0xF862AE69uL, 0x616BFFD3uL, 0x166CCF45uL,
+        0xA00AE278uL, 0xD70DD2EEuL, 0x4E048354uL, 0x3903B3C2uL,
+        0xA7672661uL, 0xD06016F7uL, 0x4969474DuL, 0x3E6E77DBuL,
+        0xAED16A4AuL, 0xD9D65ADCuL, 0x40DF0B66uL, 0x37D83BF0uL,
+        0xA9BCAE53uL, 0xDEBB9EC5uL, 0x47B2CF7FuL, 0x30B5FFE9uL,
+        0xBDBDF21CuL, 0xCABAC28AuL, 0x53B39330uL, 0x24B4A3A6uL,
+        0xBAD03605uL, 0xCDD70693uL, 0x54DE5729uL, 0x23D967BFuL,
+        0xB3667A2EuL, 0xC4614AB8uL, 0x5D681B02uL, 0x2A6F2B94uL,
+        0xB40BBE37uL, 0xC30C8EA1uL, 0x5A05DF1BuL, 0x2D02EF8DuL
+    },
+    {
+        0x00000000uL, 0x191B3141uL, 0x32366282uL, 0x2B2D53C3uL,
+        0x646CC504uL, 0x7D77F445uL, 0x565AA786uL, 0x4F4196C7uL,
+        0xC8D98A08uL, 0xD1C2BB49uL, 0xFAEFE88AuL, 0xE3F4D9CBuL,
+        0xACB54F0CuL, 0xB5AE7E4DuL, 0x9E832D8EuL, 0x87981CCFuL,
+        0x4AC21251uL, 0x53D92310uL, 0x78F470D3uL, 0x61EF4192uL,
+        0x2EAED755uL, 0x37B5E614uL, 0x1C98B5D7uL, 0x05838496uL,
+        0x821B9859uL, 0x9B00A918uL, 0xB02DFADBuL, 0xA936CB9AuL,
+        0xE6775D5DuL, 0xFF6C6C1CuL, 0xD4413FDFuL, 0xCD5A0E9EuL,
+        0x958424A2uL, 0x8C9F15E3uL, 0xA7B24620uL, 0xBEA97761uL,
+        0xF1E8E1A6uL, 0xE8F3D0E7uL, 0xC3DE8324uL, 0xDAC5B265uL,
+        0x5D5DAEAAuL, 0x44469FEBuL, 0x6F6BCC28uL, 0x7670FD69uL,
+        0x39316BAEuL, 0x202A5AEFuL, 0x0B07092CuL, 0x121C386DuL,
+        0xDF4636F3uL, 0xC65D07B2uL, 0xED705471uL, 0xF46B6530uL,
+        0xBB2AF3F7uL, 0xA231C2B6uL, 0x891C9175uL, 0x9007A034uL,
+        0x179FBCFBuL, 0x0E848DBAuL, 0x25A9DE79uL, 0x3CB2EF38uL,
+        0x73F379FFuL, 0x6AE848BEuL, 0x41C51B7DuL, 0x58DE2A3CuL,
+        0xF0794F05uL, 0xE9627E44uL, 0xC24F2D87uL, 0xDB541CC6uL,
+        0x94158A01uL, 0x8D0EBB40uL, 0xA623E883uL, 0xBF38D9C2uL,
+        0x38A0C50DuL, 0x21BBF44CuL, 0x0A96A78FuL, 0x138D96CEuL,
+        0x5CCC0009uL, 0x45D73148uL, 0x6EFA628BuL, 0x77E153CAuL,
+        0xBABB5D54uL, 0xA3A06C15uL, 0x888D3FD6uL, 0x91960E97uL,
+        0xDED79850uL, 0xC7CCA911uL, 0xECE1FAD2uL, 0xF5FACB93uL,
+        0x7262D75CuL, 0x6B79E61DuL, 0x4054B5DEuL, 0x594F849FuL,
+        0x160E1258uL, 0x0F152319uL, 0x243870DAuL, 0x3D23419BuL,
+        0x65FD6BA7uL, 0x7CE65AE6uL, 0x57CB0925uL, 0x4ED03864uL,
+        0x0191AEA3uL, 0x188A9FE2uL, 0x33A7CC21uL, 0x2ABCFD60uL,
+        0xAD24E1AFuL, 0xB43FD0EEuL, 0x9F12832DuL, 0x8609B26CuL,
+        0xC94824ABuL, 0xD05315EAuL, 0xFB7E4629uL, 0xE2657768uL,
+        0x2F3F79F6uL, 0x362448B7uL, 0x1D091B74uL, 0x04122A35uL,
+        0x4B53BCF2uL, 0x52488DB3uL, 0x7965DE70uL, 0x607EEF31uL,
+        0xE7E6F3FEuL, 0xFEFDC2BFuL, 0xD5D0917CuL, 0xCCCBA03DuL,
+        0x838A36FAuL, 0x9A9107BBuL, 0xB1BC5478uL, 0xA8A76539uL,
+        0x3B83984BuL, 0x2298A90AuL, 0x09B5FAC9uL, 0x10AECB88uL,
+        0x5FEF5D4FuL, 0x46F46C0EuL, 0x6DD93FCDuL, 0x74C20E8CuL,
+        0xF35A1243uL, 0xEA412302uL, 0xC16C70C1uL, 0xD8774180uL,
+        0x9736D747uL, 0x8E2DE606uL, 0xA500B5C5uL, 0xBC1B8484uL,
+        0x71418A1AuL, 0x685ABB5BuL, 0x4377E898uL, 0x5A6CD9D9uL,
+        0x152D4F1EuL, 0x0C367E5FuL, 0x271B2D9CuL, 0x3E001CDDuL,
+        0xB9980012uL, 0xA0833153uL, 0x8BAE6290uL, 0x92B553D1uL,
+        0xDDF4C516uL, 0xC4EFF457uL, 0xEFC2A794uL, 0xF6D996D5uL,
+        0xAE07BCE9uL, 0xB71C8DA8uL, 0x9C31DE6BuL, 0x852AEF2AuL,
+        0xCA6B79EDuL, 0xD37048ACuL, 0xF85D1B6FuL, 0xE1462A2EuL,
+        0x66DE36E1uL, 0x7FC507A0uL, 0x54E85463uL, 0x4DF36522uL,
+        0x02B2F3E5uL, 0x1BA9C2A4uL, 0x30849167uL, 0x299FA026uL,
+        0xE4C5AEB8uL, 0xFDDE9FF9uL, 0xD6F3CC3AuL, 0xCFE8FD7BuL,
+        0x80A96BBCuL, 0x99B25AFDuL, 0xB29F093EuL, 0xAB84387FuL,
+        0x2C1C24B0uL, 0x350715F1uL, 0x1E2A4632uL, 0x07317773uL,
+        0x4870E1B4uL, 0x516BD0F5uL, 0x7A468336uL, 0x635DB277uL,
+        0xCBFAD74EuL, 0xD2E1E60FuL, 0xF9CCB5CCuL, 0xE0D7848DuL,
+        0xAF96124AuL, 0xB68D230BuL, 0x9DA070C8uL, 0x84BB4189uL,
+        0x03235D46uL, 0x1A386C07uL, 0x31153FC4uL, 0x280E0E85uL,
+        0x674F9842uL, 0x7E54A903uL, 0x5579FAC0uL, 0x4C62CB81uL,
+        0x8138C51FuL, 0x9823F45EuL, 0xB30EA79DuL, 0xAA1596DCuL,
+        0xE554001BuL, 0xFC4F315AuL, 0xD7626299uL, 0xCE7953D8uL,
+        0x49E14F17uL, 0x50FA7E56uL, 0x7BD72D95uL, 0x62CC1CD4uL,
+        0x2D8D8A13uL, 0x3496BB52uL, 0x1FBBE891uL, 0x06A0D9D0uL,
+        0x5E7EF3ECuL, 0x4765C2ADuL, 0x6C48916EuL, 0x7553A02FuL,
+        0x3A1236E8uL, 0x230907A9uL, 0x0824546AuL, 0x113F652BuL,
+        0x96A779E4uL, 0x8FBC48A5uL, 0xA4911B66uL, 0xBD8A2A27uL,
+        0xF2CBBCE0uL, 0xEBD08DA1uL, 0xC0FDDE62uL, 0xD9E6EF23uL,
+        0x14BCE1BDuL, 0x0DA7D0FCuL, 0x268A833FuL, 0x3F91B27EuL,
+        0x70D024B9uL, 0x69CB15F8uL, 0x42E6463BuL, 0x5BFD777AuL,
+        0xDC656BB5uL, 0xC57E5AF4uL, 0xEE530937uL, 0xF7483876uL,
+        0xB809AEB1uL, 0xA1129FF0uL, 0x8A3FCC33uL, 0x9324FD72uL
+    },
+    {
+        0x00000000uL, 0x01C26A37uL, 0x0384D46EuL, 0x0246BE59uL,
+        0x0709A8DCuL, 0x06CBC2EBuL, 0x048D7CB2uL, 0x054F1685uL,
+        0x0E1351B8uL, 0x0FD13B8FuL, 0x0D9785D6uL, 0x0C55EFE1uL,
+        0x091AF964uL, 0x08D89353uL, 0x0A9E2D0AuL, 0x0B5C473DuL,
+        0x1C26A370uL, 0x1DE4C947uL, 0x1FA2771EuL, 0x1E601D29uL,
+        0x1B2F0BACuL, 0x1AED619BuL, 0x18ABDFC2uL, 0x1969B5F5uL,
+        0x1235F2C8uL, 0x13F798FFuL, 0x11B126A6uL, 0x10734C91uL,
+        0x153C5A14uL, 0x14FE3023uL, 0x16B88E7AuL, 0x177AE44DuL,
+        0x384D46E0uL, 0x398F2CD7uL, 0x3BC9928EuL, 0x3A0BF8B9uL,
+        0x3F44EE3CuL, 0x3E86840BuL, 0x3CC03A52uL, 0x3D025065uL,
+        0x365E1758uL, 0x379C7D6FuL, 0x35DAC336uL, 0x3418A901uL,
+        0x3157BF84uL, 0x3095D5B3uL, 0x32D36BEAuL, 0x331101DDuL,
+        0x246BE590uL, 0x25A98FA7uL, 0x27EF31FEuL, 0x262D5BC9uL,
+        0x23624D4CuL, 0x22A0277BuL, 0x20E69922uL, 0x2124F315uL,
+        0x2A78B428uL, 0x2BBADE1FuL, 0x29FC6046uL, 0x283E0A71uL,
+        0x2D711CF4uL, 0x2CB376C3uL, 0x2EF5C89AuL, 0x2F37A2ADuL,
+        0x709A8DC0uL, 0x7158E7F7uL, 0x731E59AEuL, 0x72DC3399uL,
+        0x7793251CuL, 0x76514F2BuL, 0x7417F172uL, 0x75D59B45uL,
+        0x7E89DC78uL, 0x7F4BB64FuL, 0x7D0D0816uL, 0x7CCF6221uL,
+        0x798074A4uL, 0x78421E93uL, 0x7A04A0CAuL, 0x7BC6CAFDuL,
+        0x6CBC2EB0uL, 0x6D7E4487uL, 0x6F38FADEuL, 0x6EFA90E9uL,
+        0x6BB5866CuL, 0x6A77EC5BuL, 0x68315202uL, 0x69F33835uL,
+        0x62AF7F08uL, 0x636D153FuL, 0x612BAB66uL, 0x60E9C151uL,
+        0x65A6D7D4uL, 0x6464BDE3uL, 0x662203BAuL, 0x67E0698DuL,
+        0x48D7CB20uL, 0x4915A117uL, 0x4B531F4EuL, 0x4A917579uL,
+        0x4FDE63FCuL, 0x4E1C09CBuL, 0x4C5AB792uL, 0x4D98DDA5uL,
+        0x46C49A98uL, 0x4706F0AFuL, 0x45404EF6uL, 0x448224C1uL,
+        0x41CD3244uL, 0x400F5873uL, 0x4249E62AuL, 0x438B8C1DuL,
+        0x54F16850uL, 0x55330267uL, 0x5775BC3EuL, 0x56B7D609uL,
+        0x53F8C08CuL, 0x523AAABBuL, 0x507C14E2uL, 0x51BE7ED5uL,
+        0x5AE239E8uL, 0x5B2053DFuL, 0x5966ED86uL, 0x58A487B1uL,
+        0x5DEB9134uL, 0x5C29FB03uL, 0x5E6F455AuL, 0x5FAD2F6DuL,
+        0xE1351B80uL, 0xE0F771B7uL, 0xE2B1CFEEuL, 0xE373A5D9uL,
+        0xE63CB35CuL, 0xE7FED96BuL, 0xE5B86732uL, 0xE47A0D05uL,
+        0xEF264A38uL, 0xEEE4200FuL, 0xECA29E56uL, 0xED60F461uL,
+        0xE82FE2E4uL, 0xE9ED88D3uL, 0xEBAB368AuL, 0xEA695CBDuL,
+        0xFD13B8F0uL, 0xFCD1D2C7uL, 0xFE976C9EuL, 0xFF5506A9uL,
+        0xFA1A102CuL, 0xFBD87A1BuL, 0xF99EC442uL, 0xF85CAE75uL,
+        0xF300E948uL, 0xF2C2837FuL, 0xF0843D26uL, 0xF1465711uL,
+        0xF4094194uL, 0xF5CB2BA3uL, 0xF78D95FAuL, 0xF64FFFCDuL,
+        0xD9785D60uL, 0xD8BA3757uL, 0xDAFC890EuL, 0xDB3EE339uL,
+        0xDE71F5BCuL, 0xDFB39F8BuL, 0xDDF521D2uL, 0xDC374BE5uL,
+        0xD76B0CD8uL, 0xD6A966EFuL, 0xD4EFD8B6uL, 0xD52DB281uL,
+        0xD062A404uL, 0xD1A0CE33uL, 0xD3E6706AuL, 0xD2241A5DuL,
+        0xC55EFE10uL, 0xC49C9427uL, 0xC6DA2A7EuL, 0xC7184049uL,
+        0xC25756CCuL, 0xC3953CFBuL, 0xC1D382A2uL, 0xC011E895uL,
+        0xCB4DAFA8uL, 0xCA8FC59FuL, 0xC8C97BC6uL, 0xC90B11F1uL,
+        0xCC440774uL, 0xCD866D43uL, 0xCFC0D31AuL, 0xCE02B92DuL,
+        0x91AF9640uL, 0x906DFC77uL, 0x922B422EuL, 0x93E92819uL,
+        0x96A63E9CuL, 0x976454ABuL, 0x9522EAF2uL, 0x94E080C5uL,
+        0x9FBCC7F8uL, 0x9E7EADCFuL, 0x9C381396uL, 0x9DFA79A1uL,
+        0x98B56F24uL, 0x99770513uL, 0x9B31BB4AuL, 0x9AF3D17DuL,
+        0x8D893530uL, 0x8C4B5F07uL, 0x8E0DE15EuL, 0x8FCF8B69uL,
+        0x8A809DECuL, 0x8B42F7DBuL, 0x89044982uL, 0x88C623B5uL,
+        0x839A6488uL, 0x82580EBFuL, 0x801EB0E6uL, 0x81DCDAD1uL,
+        0x8493CC54uL, 0x8551A663uL, 0x8717183AuL, 0x86D5720DuL,
+        0xA9E2D0A0uL, 0xA820BA97uL, 0xAA6604CEuL, 0xABA46EF9uL,
+        0xAEEB787CuL, 0xAF29124BuL, 0xAD6FAC12uL, 0xACADC625uL,
+        0xA7F18118uL, 0xA633EB2FuL, 0xA4755576uL, 0xA5B73F41uL,
+        0xA0F829C4uL, 0xA13A43F3uL, 0xA37CFDAAuL, 0xA2BE979DuL,
+        0xB5C473D0uL, 0xB40619E7uL, 0xB640A7BEuL, 0xB782CD89uL,
+        0xB2CDDB0CuL, 0xB30FB13BuL, 0xB1490F62uL, 0xB08B6555uL,
+        0xBBD72268uL, 0xBA15485FuL, 0xB853F606uL, 0xB9919C31uL,
+        0xBCDE8AB4uL, 0xBD1CE083uL, 0xBF5A5EDAuL, 0xBE9834EDuL
+    },
+    {
+        0x00000000uL, 0xB8BC6765uL, 0xAA09C88BuL, 0x12B5AFEEuL,
+        0x8F629757uL, 0x37DEF032uL, 0x256B5FDCuL, 0x9DD738B9uL,
+        0xC5B428EFuL, 0x7D084F8AuL, 0x6FBDE064uL, 0xD7018701uL,
+        0x4AD6BFB8uL, 0xF26AD8DDuL, 0xE0DF7733uL, 0x58631056uL,
+        0x5019579FuL, 0xE8A530FAuL, 0xFA109F14uL, 0x42ACF871uL,
+        0xDF7BC0C8uL, 0x67C7A7ADuL, 0x75720843uL, 0xCDCE6F26uL,
+        0x95AD7F70uL, 0x2D111815uL, 0x3FA4B7FBuL, 0x8718D09EuL,
+        0x1ACFE827uL, 0xA2738F42uL, 0xB0C620ACuL, 0x087A47C9uL,
+        0xA032AF3EuL, 0x188EC85BuL, 0x0A3B67B5uL, 0xB28700D0uL,
+        0x2F503869uL, 0x97EC5F0CuL, 0x8559F0E2uL, 0x3DE59787uL,
+        0x658687D1uL, 0xDD3AE0B4uL, 0xCF8F4F5AuL, 0x7733283FuL,
+        0xEAE41086uL, 0x525877E3uL, 0x40EDD80DuL, 0xF851BF68uL,
+        0xF02BF8A1uL, 0x48979FC4uL, 0x5A22302AuL, 0xE29E574FuL,
+        0x7F496FF6uL, 0xC7F50893uL, 0xD540A77DuL, 0x6DFCC018uL,
+        0x359FD04EuL, 0x8D23B72BuL, 0x9F9618C5uL, 0x272A7FA0uL,
+        0xBAFD4719uL, 0x0241207CuL, 0x10F48F92uL, 0xA848E8F7uL,
+        0x9B14583DuL, 0x23A83F58uL, 0x311D90B6uL, 0x89A1F7D3uL,
+        0x1476CF6AuL, 0xACCAA80FuL, 0xBE7F07E1uL, 0x06C36084uL,
+        0x5EA070D2uL, 0xE61C17B7uL, 0xF4A9B859uL, 0x4C15DF3CuL,
+        0xD1C2E785uL, 0x697E80E0uL, 0x7BCB2F0EuL, 0xC377486BuL,
+        0xCB0D0FA2uL, 0x73B168C7uL, 0x6104C729uL, 0xD9B8A04CuL,
+        0x446F98F5uL, 0xFCD3FF90uL, 0xEE66507EuL, 0x56DA371BuL,
+        0x0EB9274DuL, 0xB6054028uL, 0xA4B0EFC6uL, 0x1C0C88A3uL,
+        0x81DBB01AuL, 0x3967D77FuL, 0x2BD27891uL, 0x936E1FF4uL,
+        0x3B26F703uL, 0x839A9066uL, 0x912F3F88uL, 0x299358EDuL,
+        0xB4446054uL, 0x0CF80731uL, 0x1E4DA8DFuL, 0xA6F1CFBAuL,
+        0xFE92DFECuL, 0x462EB889uL, 0x549B1767uL, 0xEC277002uL,
+        0x71F048BBuL, 0xC94C2FDEuL, 0xDBF98030uL, 0x6345E755uL,
+        0x6B3FA09CuL, 0xD383C7F9uL, 0xC1366817uL, 0x798A0F72uL,
+        0xE45D37CBuL, 0x5CE150AEuL, 0x4E54FF40uL, 0xF6E89825uL,
+        0xAE8B8873uL, 0x1637EF16uL, 0x048240F8uL, 0xBC3E279DuL,
+        0x21E91F24uL, 0x99557841uL, 0x8BE0D7AFuL, 0x335CB0CAuL,
+        0xED59B63BuL, 0x55E5D15EuL, 0x47507EB0uL, 0xFFEC19D5uL,
+        0x623B216CuL, 0xDA874609uL, 0xC832E9E7uL, 0x708E8E82uL,
+        0x28ED9ED4uL, 0x9051F9B1uL, 0x82E4565FuL, 0x3A58313AuL,
+        0xA78F0983uL, 0x1F336EE6uL, 0x0D86C108uL, 0xB53AA66DuL,
+        0xBD40E1A4uL, 0x05FC86C1uL, 0x1749292FuL, 0xAFF54E4AuL,
+        0x322276F3uL, 0x8A9E1196uL, 0x982BBE78uL, 0x2097D91DuL,
+        0x78F4C94BuL, 0xC048AE2EuL, 0xD2FD01C0uL, 0x6A4166A5uL,
+        0xF7965E1CuL, 0x4F2A3979uL, 0x5D9F9697uL, 0xE523F1F2uL,
+        0x4D6B1905uL, 0xF5D77E60uL, 0xE762D18EuL, 0x5FDEB6EBuL,
+        0xC2098E52uL, 0x7AB5E937uL, 0x680046D9uL, 0xD0BC21BCuL,
+        0x88DF31EAuL, 0x3063568FuL, 0x22D6F961uL, 0x9A6A9E04uL,
+        0x07BDA6BDuL, 0xBF01C1D8uL, 0xADB46E36uL, 0x15080953uL,
+        0x1D724E9AuL, 0xA5CE29FFuL, 0xB77B8611uL, 0x0FC7E174uL,
+        0x9210D9CDuL, 0x2AACBEA8uL, 0x38191146uL, 0x80A57623uL,
+        0xD8C66675uL, 0x607A0110uL, 0x72CFAEFEuL, 0xCA73C99BuL,
+        0x57A4F122uL, 0xEF189647uL, 0xFDAD39A9uL, 0x45115ECCuL,
+        0x764DEE06uL, 0xCEF18963uL, 0xDC44268DuL, 0x64F841E8uL,
+        0xF92F7951uL, 0x41931E34uL, 0x5326B1DAuL, 0xEB9AD6BFuL,
+        0xB3F9C6E9uL, 0x0B45A18CuL, 0x19F00E62uL, 0xA14C6907uL,
+        0x3C9B51BEuL, 0x842736DBuL, 0x96929935uL, 0x2E2EFE50uL,
+        0x2654B999uL, 0x9EE8DEFCuL, 0x8C5D7112uL, 0x34E11677uL,
+        0xA9362ECEuL, 0x118A49ABuL, 0x033FE645uL, 0xBB838120uL,
+        0xE3E09176uL, 0x5B5CF613uL, 0x49E959FDuL, 0xF1553E98uL,
+        0x6C820621uL, 0xD43E6144uL, 0xC68BCEAAuL, 0x7E37A9CFuL,
+        0xD67F4138uL, 0x6EC3265DuL, 0x7C7689B3uL, 0xC4CAEED6uL,
+        0x591DD66FuL, 0xE1A1B10AuL, 0xF3141EE4uL, 0x4BA87981uL,
+        0x13CB69D7uL, 0xAB770EB2uL, 0xB9C2A15CuL, 0x017EC639uL,
+        0x9CA9FE80uL, 0x241599E5uL, 0x36A0360BuL, 0x8E1C516EuL,
+        0x866616A7uL, 0x3EDA71C2uL, 0x2C6FDE2CuL, 0x94D3B949uL,
+        0x090481F0uL, 0xB1B8E695uL, 0xA30D497BuL, 0x1BB12E1EuL,
+        0x43D23E48uL, 0xFB6E592DuL, 0xE9DBF6C3uL, 0x516791A6uL,
+        0xCCB0A91FuL, 0x740CCE7AuL, 0x66B96194uL, 0xDE0506F1uL
+    },
+    {
+        0x00000000uL, 0x3D6029B0uL, 0x7AC05360uL, 0x47A07AD0uL,
+        0xF580A6C0uL, 0xC8E08F70uL, 0x8F40F5A0uL, 0xB220DC10uL,
+        0x30704BC1uL, 0x0D106271uL, 0x4AB018A1uL, 0x77D03111uL,
+        0xC5F0ED01uL, 0xF890C4B1uL, 0xBF30BE61uL, 0x825097D1uL,
+        0x60E09782uL, 0x5D80BE32uL, 0x1A20C4E2uL, 0x2740ED52uL,
+        0x95603142uL, 0xA80018F2uL, 0xEFA06222uL, 0xD2C04B92uL,
+        0x5090DC43uL, 0x6DF0F5F3uL, 0x2A508F23uL, 0x1730A693uL,
+        0xA5107A83uL, 0x98705333uL, 0xDFD029E3uL, 0xE2B00053uL,
+        0xC1C12F04uL, 0xFCA106B4uL, 0xBB017C64uL, 0x866155D4uL,
+        0x344189C4uL, 0x0921A074uL, 0x4E81DAA4uL, 0x73E1F314uL,
+        0xF1B164C5uL, 0xCCD14D75uL, 0x8B7137A5uL, 0xB6111E15uL,
+        0x0431C205uL, 0x3951EBB5uL, 0x7EF19165uL, 0x4391B8D5uL,
+        0xA121B886uL, 0x9C419136uL, 0xDBE1EBE6uL, 0xE681C256uL,
+        0x54A11E46uL, 0x69C137F6uL, 0x2E614D26uL, 0x13016496uL,
+        0x9151F347uL, 0xAC31DAF7uL, 0xEB91A027uL, 0xD6F18997uL,
+        0x64D15587uL, 0x59B17C37uL, 0x1E1106E7uL, 0x23712F57uL,
+        0x58F35849uL, 0x659371F9uL, 0x22330B29uL, 0x1F532299uL,
+        0xAD73FE89uL, 0x9013D739uL, 0xD7B3ADE9uL, 0xEAD38459uL,
+        0x68831388uL, 0x55E33A38uL, 0x124340E8uL, 0x2F236958uL,
+        0x9D03B548uL, 0xA0639CF8uL, 0xE7C3E628uL, 0xDAA3CF98uL,
+        0x3813CFCBuL, 0x0573E67BuL, 0x42D39CABuL, 0x7FB3B51BuL,
+        0xCD93690BuL, 0xF0F340BBuL, 0xB7533A6BuL, 0x8A3313DBuL,
+        0x0863840AuL, 0x3503ADBAuL, 0x72A3D76AuL, 0x4FC3FEDAuL,
+        0xFDE322CAuL, 0xC0830B7AuL, 0x872371AAuL, 0xBA43581AuL,
+        0x9932774DuL, 0xA4525EFDuL, 0xE3F2242DuL, 0xDE920D9DuL,
+        0x6CB2D18DuL, 0x51D2F83DuL, 0x167282EDuL, 0x2B12AB5DuL,
+        0xA9423C8CuL, 0x9422153CuL, 0xD3826FECuL, 0xEEE2465CuL,
+        0x5CC29A4CuL, 0x61A2B3FCuL, 0x2602C92CuL, 0x1B62E09CuL,
+        0xF9D2E0CFuL, 0xC4B2C97FuL, 0x8312B3AFuL, 0xBE729A1FuL,
+        0x0C52460FuL, 0x31326FBFuL, 0x7692156FuL, 0x4BF23CDFuL,
+        0xC9A2AB0EuL, 0xF4C282BEuL, 0xB362F86EuL, 0x8E02D1DEuL,
+        0x3C220DCEuL, 0x0142247EuL, 0x46E25EAEuL, 0x7B82771EuL,
+        0xB1E6B092uL, 0x8C869922uL, 0xCB26E3F2uL, 0xF646CA42uL,
+        0x44661652uL, 0x79063FE2uL, 0x3EA64532uL, 0x03C66C82uL,
+        0x8196FB53uL, 0xBCF6D2E3uL, 0xFB56A833uL, 0xC6368183uL,
+        0x74165D93uL, 0x49767423uL, 0x0ED60EF3uL, 0x33B62743uL,
+        0xD1062710uL, 0xEC660EA0uL, 0xABC67470uL, 0x96A65DC0uL,
+        0x248681D0uL, 0x19E6A860uL, 0x5E46D2B0uL, 0x6326FB00uL,
+        0xE1766CD1uL, 0xDC164561uL, 0x9BB63FB1uL, 0xA6D61601uL,
+        0x14F6CA11uL, 0x2996E3A1uL, 0x6E369971uL, 0x5356B0C1uL,
+        0x70279F96uL, 0x4D47B626uL, 0x0AE7CCF6uL, 0x3787E546uL,
+        0x85A73956uL, 0xB8C710E6uL, 0xFF676A36uL, 0xC2074386uL,
+        0x4057D457uL, 0x7D37FDE7uL, 0x3A978737uL, 0x07F7AE87uL,
+        0xB5D77297uL, 0x88B75B27uL, 0xCF1721F7uL, 0xF2770847uL,
+        0x10C70814uL, 0x2DA721A4uL, 0x6A075B74uL, 0x576772C4uL,
+        0xE547AED4uL, 0xD8278764uL, 0x9F87FDB4uL, 0xA2E7D404uL,
+        0x20B743D5uL, 0x1DD76A65uL, 0x5A7710B5uL, 0x67173905uL,
+        0xD537E515uL, 0xE857CCA5uL, 0xAFF7B675uL, 0x92979FC5uL,
+        0xE915E8DBuL, 0xD475C16BuL, 0x93D5BBBBuL, 0xAEB5920BuL,
+        0x1C954E1BuL, 0x21F567ABuL, 0x66551D7BuL, 0x5B3534CBuL,
+        0xD965A31AuL, 0xE4058AAAuL, 0xA3A5F07AuL, 0x9EC5D9CAuL,
+        0x2CE505DAuL, 0x11852C6AuL, 0x562556BAuL, 0x6B457F0AuL,
+        0x89F57F59uL, 0xB49556E9uL, 0xF3352C39uL, 0xCE550589uL,
+        0x7C75D999uL, 0x4115F029uL, 0x06B58AF9uL, 0x3BD5A349uL,
+        0xB9853498uL, 0x84E51D28uL, 0xC34567F8uL, 0xFE254E48uL,
+        0x4C059258uL, 0x7165BBE8uL, 0x36C5C138uL, 0x0BA5E888uL,
+        0x28D4C7DFuL, 0x15B4EE6FuL, 0x521494BFuL, 0x6F74BD0FuL,
+        0xDD54611FuL, 0xE03448AFuL, 0xA794327FuL, 0x9AF41BCFuL,
+        0x18A48C1EuL, 0x25C4A5AEuL, 0x6264DF7EuL, 0x5F04F6CEuL,
+        0xED242ADEuL, 0xD044036EuL, 0x97E479BEuL, 0xAA84500EuL,
+        0x4834505DuL, 0x755479EDuL, 0x32F4033DuL, 0x0F942A8DuL,
+        0xBDB4F69DuL, 0x80D4DF2DuL, 0xC774A5FDuL, 0xFA148C4DuL,
+        0x78441B9CuL, 0x4524322CuL, 0x028448FCuL, 0x3FE4614CuL,
+        0x8DC4BD5CuL, 0xB0A494ECuL, 0xF704EE3CuL, 0xCA64C78CuL
+    },
+    {
+        0x00000000uL, 0xCB5CD3A5uL, 0x4DC8A10BuL, 0x869472AEuL,
+        0x9B914216uL, 0x50CD91B3uL, 0xD659E31DuL, 0x1D0530B8uL,
+        0xEC53826DuL, 0x270F51C8uL, 0xA19B2366uL, 0x6AC7F0C3uL,
+        0x77C2C07BuL, 0xBC9E13DEuL, 0x3A0A6170uL, 0xF156B2D5uL,
+        0x03D6029BuL, 0xC88AD13EuL, 0x4E1EA390uL, 0x85427035uL,
+        0x9847408DuL, 0x531B9328uL, 0xD58FE186uL, 0x1ED33223uL,
+        0xEF8580F6uL, 0x24D95353uL, 0xA24D21FDuL, 0x6911F258uL,
+        0x7414C2E0uL, 0xBF481145uL, 0x39DC63EBuL, 0xF280B04EuL,
+        0x07AC0536uL, 0xCCF0D693uL, 0x4A64A43DuL, 0x81387798uL,
+        0x9C3D4720uL, 0x57619485uL, 0xD1F5E62BuL, 0x1AA9358EuL,
+        0xEBFF875BuL, 0x20A354FEuL, 0xA6372650uL, 0x6D6BF5F5uL,
+        0x706EC54DuL, 0xBB3216E8uL, 0x3DA66446uL, 0xF6FAB7E3uL,
+        0x047A07ADuL, 0xCF26D408uL, 0x49B2A6A6uL, 0x82EE7503uL,
+        0x9FEB45BBuL, 0x54B7961EuL, 0xD223E4B0uL, 0x197F3715uL,
+        0xE82985C0uL, 0x23755665uL, 0xA5E124CBuL, 0x6EBDF76EuL,
+        0x73B8C7D6uL, 0xB8E41473uL, 0x3E7066DDuL, 0xF52CB578uL,
+        0x0F580A6CuL, 0xC404D9C9uL, 0x4290AB67uL, 0x89CC78C2uL,
+        0x94C9487AuL, 0x5F959BDFuL, 0xD901E971uL, 0x125D3AD4uL,
+        0xE30B8801uL, 0x28575BA4uL, 0xAEC3290AuL, 0x659FFAAFuL,
+        0x789ACA17uL, 0xB3C619B2uL, 0x35526B1CuL, 0xFE0EB8B9uL,
+        0x0C8E08F7uL, 0xC7D2DB52uL, 0x4146A9FCuL, 0x8A1A7A59uL,
+        0x971F4AE1uL, 0x5C439944uL, 0xDAD7EBEAuL, 0x118B384FuL,
+        0xE0DD8A9AuL, 0x2B81593FuL, 0xAD152B91uL, 0x6649F834uL,
+        0x7B4CC88CuL, 0xB0101B29uL, 0x36846987uL, 0xFDD8BA22uL,
+        0x08F40F5AuL, 0xC3A8DCFFuL, 0x453CAE51uL, 0x8E607DF4uL,
+        0x93654D4CuL, 0x58399EE9uL, 0xDEADEC47uL, 0x15F13FE2uL,
+        0xE4A78D37uL, 0x2FFB5E92uL, 0xA96F2C3CuL, 0x6233FF99uL,
+        0x7F36CF21uL, 0xB46A1C84uL, 0x32FE6E2AuL, 0xF9A2BD8FuL,
+        0x0B220DC1uL, 0xC07EDE64uL, 0x46EAACCAuL, 0x8DB67F6FuL,
+        0x90B34FD7uL, 0x5BEF9C72uL, 0xDD7BEEDCuL, 0x16273D79uL,
+        0xE7718FACuL, 0x2C2D5C09uL, 0xAAB92EA7uL, 0x61E5FD02uL,
+        0x7CE0CDBAuL, 0xB7BC1E1FuL, 0x31286CB1uL, 0xFA74BF14uL,
+        0x1EB014D8uL, 0xD5ECC77DuL, 0x5378B5D3uL, 0x98246676uL,
+        0x852156CEuL, 0x4E7D856BuL, 0xC8E9F7C5uL, 0x03B52460uL,
+        0xF2E396B5uL, 0x39BF4510uL, 0xBF2B37BEuL, 0x7477E41BuL,
+        0x6972D4A3uL, 0xA22E0706uL, 0x24BA75A8uL, 0xEFE6A60DuL,
+        0x1D661643uL, 0xD63AC5E6uL, 0x50AEB748uL, 0x9BF264EDuL,
+        0x86F75455uL, 0x4DAB87F0uL, 0xCB3FF55EuL, 0x006326FBuL,
+        0xF135942EuL, 0x3A69478BuL, 0xBCFD3525uL, 0x77A1E680uL,
+        0x6AA4D638uL, 0xA1F8059DuL, 0x276C7733uL, 0xEC30A496uL,
+        0x191C11EEuL, 0xD240C24BuL, 0x54D4B0E5uL, 0x9F886340uL,
+        0x828D53F8uL, 0x49D1805DuL, 0xCF45F2F3uL, 0x04192156uL,
+        0xF54F9383uL, 0x3E134026uL, 0xB8873288uL, 0x73DBE12DuL,
+        0x6EDED195uL, 0xA5820230uL, 0x2316709EuL, 0xE84AA33BuL,
+        0x1ACA1375uL, 0xD196C0D0uL, 0x5702B27EuL, 0x9C5E61DBuL,
+        0x815B5163uL, 0x4A0782C6uL, 0xCC93F068uL, 0x07CF23CDuL,
+        0xF6999118uL, 0x3DC542BDuL, 0xBB513013uL, 0x700DE3B6uL,
+        0x6D08D30EuL, 0xA65400ABuL, 0x20C07205uL, 0xEB9CA1A0uL,
+        0x11E81EB4uL, 0xDAB4CD11uL, 0x5C20BFBFuL, 0x977C6C1AuL,
+        0x8A795CA2uL, 0x41258F07uL, 0xC7B1FDA9uL, 0x0CED2E0CuL,
+        0xFDBB9CD9uL, 0x36E74F7CuL, 0xB0733DD2uL, 0x7B2FEE77uL,
+        0x662ADECFuL, 0xAD760D6AuL, 0x2BE27FC4uL, 0xE0BEAC61uL,
+        0x123E1C2FuL, 0xD962CF8AuL, 0x5FF6BD24uL, 0x94AA6E81uL,
+        0x89AF5E39uL, 0x42F38D9CuL, 0xC467FF32uL, 0x0F3B2C97uL,
+        0xFE6D9E42uL, 0x35314DE7uL, 0xB3A53F49uL, 0x78F9ECECuL,
+        0x65FCDC54uL, 0xAEA00FF1uL, 0x28347D5FuL, 0xE368AEFAuL,
+        0x16441B82uL, 0xDD18C827uL, 0x5B8CBA89uL, 0x90D0692CuL,
+        0x8DD55994uL, 0x46898A31uL, 0xC01DF89FuL, 0x0B412B3AuL,
+        0xFA1799EFuL, 0x314B4A4AuL, 0xB7DF38E4uL, 0x7C83EB41uL,
+        0x6186DBF9uL, 0xAADA085CuL, 0x2C4E7AF2uL, 0xE712A957uL,
+        0x15921919uL, 0xDECECABCuL, 0x585AB812uL, 0x93066BB7uL,
+        0x8E035B0FuL, 0x455F88AAuL, 0xC3CBFA04uL, 0x089729A1uL,
+        0xF9C19B74uL, 0x329D48D1uL, 0xB4093A7FuL, 0x7F55E9DAuL,
+        0x6250D962uL, 0xA90C0AC7uL, 0x2F987869uL, 0xE4C4ABCCuL
+    },
+    {
+        0x00000000uL, 0xA6770BB4uL, 0x979F1129uL, 0x31E81A9DuL,
+        0xF44F2413uL, 0x52382FA7uL, 0x63D0353AuL, 0xC5A73E8EuL,
+        0x33EF4E67uL, 0x959845D3uL, 0xA4705F4EuL, 0x020754FAuL,
+        0xC7A06A74uL, 0x61D761C0uL, 0x503F7B5DuL, 0xF64870E9uL,
+        0x67DE9CCEuL, 0xC1A9977AuL, 0xF0418DE7uL, 0x56368653uL,
+        0x9391B8DDuL, 0x35E6B369uL, 0x040EA9F4uL, 0xA279A240uL,
+        0x5431D2A9uL, 0xF246D91DuL, 0xC3AEC380uL, 0x65D9C834uL,
+        0xA07EF6BAuL, 0x0609FD0EuL, 0x37E1E793uL, 0x9196EC27uL,
+        0xCFBD399CuL, 0x69CA3228uL, 0x582228B5uL, 0xFE552301uL,
+        0x3BF21D8FuL, 0x9D85163BuL, 0xAC6D0CA6uL, 0x0A1A0712uL,
+        0xFC5277FBuL, 0x5A257C4FuL, 0x6BCD66D2uL, 0xCDBA6D66uL,
+        0x081D53E8uL, 0xAE6A585CuL, 0x9F8242C1uL, 0x39F54975uL,
+        0xA863A552uL, 0x0E14AEE6uL, 0x3FFCB47BuL, 0x998BBFCFuL,
+        0x5C2C8141uL, 0xFA5B8AF5uL, 0xCBB39068uL, 0x6DC49BDCuL,
+        0x9B8CEB35uL, 0x3DFBE081uL, 0x0C13FA1CuL, 0xAA64F1A8uL,
+        0x6FC3CF26uL, 0xC9B4C492uL, 0xF85CDE0FuL, 0x5E2BD5BBuL,
+        0x440B7579uL, 0xE27C7ECDuL, 0xD3946450uL, 0x75E36FE4uL,
+        0xB044516AuL, 0x16335ADEuL, 0x27DB4043uL, 0x81AC4BF7uL,
+        0x77E43B1EuL, 0xD19330AAuL, 0xE07B2A37uL, 0x460C2183uL,
+        0x83AB1F0DuL, 0x25DC14B9uL, 0x14340E24uL, 0xB2430590uL,
+        0x23D5E9B7uL, 0x85A2E203uL, 0xB44AF89EuL, 0x123DF32AuL,
+        0xD79ACDA4uL, 0x71EDC610uL, 0x4005DC8DuL, 0xE672D739uL,
+        0x103AA7D0uL, 0xB64DAC64uL, 0x87A5B6F9uL, 0x21D2BD4DuL,
+        0xE47583C3uL, 0x42028877uL, 0x73EA92EAuL, 0xD59D995EuL,
+        0x8BB64CE5uL, 0x2DC14751uL, 0x1C295DCCuL, 0xBA5E5678uL,
+        0x7FF968F6uL, 0xD98E6342uL, 0xE86679DFuL, 0x4E11726BuL,
+        0xB8590282uL, 0x1E2E0936uL, 0x2FC613ABuL, 0x89B1181FuL,
+        0x4C162691uL, 0xEA612D25uL, 0xDB8937B8uL, 0x7DFE3C0CuL,
+        0xEC68D02BuL, 0x4A1FDB9FuL, 0x7BF7C102uL, 0xDD80CAB6uL,
+        0x1827F438uL, 0xBE50FF8CuL, 0x8FB8E511uL, 0x29CFEEA5uL,
+        0xDF879E4CuL, 0x79F095F8uL, 0x48188F65uL, 0xEE6F84D1uL,
+        0x2BC8BA5FuL, 0x8DBFB1EBuL, 0xBC57AB76uL, 0x1A20A0C2uL,
+        0x8816EAF2uL, 0x2E61E146uL, 0x1F89FBDBuL, 0xB9FEF06FuL,
+        0x7C59CEE1uL, 0xDA2EC555uL, 0xEBC6DFC8uL, 0x4DB1D47CuL,
+        0xBBF9A495uL, 0x1D8EAF21uL, 0x2C66B5BCuL, 0x8A11BE08uL,
+        0x4FB68086uL, 0xE9C18B32uL, 0xD82991AFuL, 0x7E5E9A1BuL,
+        0xEFC8763CuL, 0x49BF7D88uL, 0x78576715uL, 0xDE206CA1uL,
+        0x1B87522FuL, 0xBDF0599BuL, 0x8C184306uL, 0x2A6F48B2uL,
+        0xDC27385BuL, 0x7A5033EFuL, 0x4BB82972uL, 0xEDCF22C6uL,
+        0x28681C48uL, 0x8E1F17FCuL, 0xBFF70D61uL, 0x198006D5uL,
+        0x47ABD36EuL, 0xE1DCD8DAuL, 0xD034C247uL, 0x7643C9F3uL,
+        0xB3E4F77DuL, 0x1593FCC9uL, 0x247BE654uL, 0x820CEDE0uL,
+        0x74449D09uL, 0xD23396BDuL, 0xE3DB8C20uL, 0x45AC8794uL,
+        0x800BB91AuL, 0x267CB2AEuL, 0x1794A833uL, 0xB1E3A387uL,
+        0x20754FA0uL, 0x86024414uL, 0xB7EA5E89uL, 0x119D553DuL,
+        0xD43A6BB3uL, 0x724D6007uL, 0x43A57A9AuL, 0xE5D2712EuL,
+        0x139A01C7uL, 0xB5ED0A73uL, 0x840510EEuL, 0x22721B5AuL,
+        0xE7D525D4uL, 0x41A22E60uL, 0x704A34FDuL, 0xD63D3F49uL,
+        0xCC1D9F8BuL, 0x6A6A943FuL, 0x5B828EA2uL, 0xFDF58516uL,
+        0x3852BB98uL, 0x9E25B02CuL, 0xAFCDAAB1uL, 0x09BAA105uL,
+        0xFFF2D1ECuL, 0x5985DA58uL, 0x686DC0C5uL, 0xCE1ACB71uL,
+        0x0BBDF5FFuL, 0xADCAFE4BuL, 0x9C22E4D6uL, 0x3A55EF62uL,
+        0xABC30345uL, 0x0DB408F1uL, 0x3C5C126CuL, 0x9A2B19D8uL,
+        0x5F8C2756uL, 0xF9FB2CE2uL, 0xC813367FuL, 0x6E643DCBuL,
+        0x982C4D22uL, 0x3E5B4696uL, 0x0FB35C0BuL, 0xA9C457BFuL,
+        0x6C636931uL, 0xCA146285uL, 0xFBFC7818uL, 0x5D8B73ACuL,
+        0x03A0A617uL, 0xA5D7ADA3uL, 0x943FB73EuL, 0x3248BC8AuL,
+        0xF7EF8204uL, 0x519889B0uL, 0x6070932DuL, 0xC6079899uL,
+        0x304FE870uL, 0x9638E3C4uL, 0xA7D0F959uL, 0x01A7F2EDuL,
+        0xC400CC63uL, 0x6277C7D7uL, 0x539FDD4AuL, 0xF5E8D6FEuL,
+        0x647E3AD9uL, 0xC209316DuL, 0xF3E12BF0uL, 0x55962044uL,
+        0x90311ECAuL, 0x3646157EuL, 0x07AE0FE3uL, 0xA1D90457uL,
+        0x579174BEuL, 0xF1E67F0AuL, 0xC00E6597uL, 0x66796E23uL,
+        0xA3DE50ADuL, 0x05A95B19uL, 0x34414184uL, 0x92364A30uL
+    },
+    {
+        0x00000000uL, 0xCCAA009EuL, 0x4225077DuL, 0x8E8F07E3uL,
+        0x844A0EFAuL, 0x48E00E64uL, 0xC66F0987uL, 0x0AC50919uL,
+        0xD3E51BB5uL, 0x1F4F1B2BuL, 0x91C01CC8uL, 0x5D6A1C56uL,
+        0x57AF154FuL, 0x9B0515D1uL, 0x158A1232uL, 0xD92012ACuL,
+        0x7CBB312BuL, 0xB01131B5uL, 0x3E9E3656uL, 0xF23436C8uL,
+        0xF8F13FD1uL, 0x345B3F4FuL, 0xBAD438ACuL, 0x767E3832uL,
+        0xAF5E2A9EuL, 0x63F42A00uL, 0xED7B2DE3uL, 0x21D12D7DuL,
+        0x2B142464uL, 0xE7BE24FAuL, 0x69312319uL, 0xA59B2387uL,
+        0xF9766256uL, 0x35DC62C8uL, 0xBB53652BuL, 0x77F965B5uL,
+        0x7D3C6CACuL, 0xB1966C32uL, 0x3F196BD1uL, 0xF3B36B4FuL,
+        0x2A9379E3uL, 0xE639797DuL, 0x68B67E9EuL, 0xA41C7E00uL,
+        0xAED97719uL, 0x62737787uL, 0xECFC7064uL, 0x205670FAuL,
+        0x85CD537DuL, 0x496753E3uL, 0xC7E85400uL, 0x0B42549EuL,
+        0x01875D87uL, 0xCD2D5D19uL, 0x43A25AFAuL, 0x8F085A64uL,
+        0x562848C8uL, 0x9A824856uL, 0x140D4FB5uL, 0xD8A74F2BuL,
+        0xD2624632uL, 0x1EC846ACuL, 0x9047414FuL, 0x5CED41D1uL,
+        0x299DC2EDuL, 0xE537C273uL, 0x6BB8C590uL, 0xA712C50EuL,
+        0xADD7CC17uL, 0x617DCC89uL, 0xEFF2CB6AuL, 0x2358CBF4uL,
+        0xFA78D958uL, 0x36D2D9C6uL, 0xB85DDE25uL, 0x74F7DEBBuL,
+        0x7E32D7A2uL, 0xB298D73CuL, 0x3C17D0DFuL, 0xF0BDD041uL,
+        0x5526F3C6uL, 0x998CF358uL, 0x1703F4BBuL, 0xDBA9F425uL,
+        0xD16CFD3CuL, 0x1DC6FDA2uL, 0x9349FA41uL, 0x5FE3FADFuL,
+        0x86C3E873uL, 0x4A69E8EDuL, 0xC4E6EF0EuL, 0x084CEF90uL,
+        0x0289E689uL, 0xCE23E617uL, 0x40ACE1F4uL, 0x8C06E16AuL,
+        0xD0EBA0BBuL, 0x1C41A025uL, 0x92CEA7C6uL, 0x5E64A758uL,
+        0x54A1AE41uL, 0x980BAEDFuL, 0x1684A93CuL, 0xDA2EA9A2uL,
+        0x030EBB0EuL, 0xCFA4BB90uL, 0x412BBC73uL, 0x8D81BCEDuL,
+        0x8744B5F4uL, 0x4BEEB56AuL, 0xC561B289uL, 0x09CBB217uL,
+        0xAC509190uL, 0x60FA910EuL, 0xEE7596EDuL, 0x22DF9673uL,
+        0x281A9F6AuL, 0xE4B09FF4uL, 0x6A3F9817uL, 0xA6959889uL,
+        0x7FB58A25uL, 0xB31F8ABBuL, 0x3D908D58uL, 0xF13A8DC6uL,
+        0xFBFF84DFuL, 0x37558441uL, 0xB9DA83A2uL, 0x7570833CuL,
+        0x533B85DAuL, 0x9F918544uL, 0x111E82A7uL, 0xDDB48239uL,
+        0xD7718B20uL, 0x1BDB8BBEuL, 0x95548C5DuL, 0x59FE8CC3uL,
+        0x80DE9E6FuL, 0x4C749EF1uL, 0xC2FB9912uL, 0x0E51998CuL,
+        0x04949095uL, 0xC83E900BuL, 0x46B197E8uL, 0x8A1B9776uL,
+        0x2F80B4F1uL, 0xE32AB46FuL, 0x6DA5B38CuL, 0xA10FB312uL,
+        0xABCABA0BuL, 0x6760BA95uL, 0xE9EFBD76uL, 0x2545BDE8uL,
+        0xFC65AF44uL, 0x30CFAFDAuL, 0xBE40A839uL, 0x72EAA8A7uL,
+        0x782FA1BEuL, 0xB485A120uL, 0x3A0AA6C3uL, 0xF6A0A65DuL,
+        0xAA4DE78CuL, 0x66E7E712uL, 0xE868E0F1uL, 0x24C2E06FuL,
+        0x2E07E976uL, 0xE2ADE9E8uL, 0x6C22EE0BuL, 0xA088EE95uL,
+        0x79A8FC39uL, 0xB502FCA7uL, 0x3B8DFB44uL, 0xF727FBDAuL,
+        0xFDE2F2C3uL, 0x3148F25DuL, 0xBFC7F5BEuL, 0x736DF520uL,
+        0xD6F6D6A7uL, 0x1A5CD639uL, 0x94D3D1DAuL, 0x5879D144uL,
+        0x52BCD85DuL, 0x9E16D8C3uL, 0x1099DF20uL, 0xDC33DFBEuL,
+        0x0513CD12uL, 0xC9B9CD8CuL, 0x4736CA6FuL, 0x8B9CCAF1uL,
+        0x8159C3E8uL, 0x4DF3C376uL, 0xC37CC495uL, 0x0FD6C40BuL,
+        0x7AA64737uL, 0xB60C47A9uL, 0x3883404AuL, 0xF42940D4uL,
+        0xFEEC49CDuL, 0x32464953uL, 0xBCC94EB0uL, 0x70634E2EuL,
+        0xA9435C82uL, 0x65E95C1CuL, 0xEB665BFFuL, 0x27CC5B61uL,
+        0x2D095278uL, 0xE1A352E6uL, 0x6F2C5505uL, 0xA386559BuL,
+        0x061D761CuL, 0xCAB77682uL, 0x44387161uL, 0x889271FFuL,
+        0x825778E6uL, 0x4EFD7878uL, 0xC0727F9BuL, 0x0CD87F05uL,
+        0xD5F86DA9uL, 0x19526D37uL, 0x97DD6AD4uL, 0x5B776A4AuL,
+        0x51B26353uL, 0x9D1863CDuL, 0x1397642EuL, 0xDF3D64B0uL,
+        0x83D02561uL, 0x4F7A25FFuL, 0xC1F5221CuL, 0x0D5F2282uL,
+        0x079A2B9BuL, 0xCB302B05uL, 0x45BF2CE6uL, 0x89152C78uL,
+        0x50353ED4uL, 0x9C9F3E4AuL, 0x121039A9uL, 0xDEBA3937uL,
+        0xD47F302EuL, 0x18D530B0uL, 0x965A3753uL, 0x5AF037CDuL,
+        0xFF6B144AuL, 0x33C114D4uL, 0xBD4E1337uL, 0x71E413A9uL,
+        0x7B211AB0uL, 0xB78B1A2EuL, 0x39041DCDuL, 0xF5AE1D53uL,
+        0x2C8E0FFFuL, 0xE0240F61uL, 0x6EAB0882uL, 0xA201081CuL,
+        0xA8C40105uL, 0x646E019BuL, 0xEAE10678uL, 0x264B06E6uL
+    }
+};
+#endif
+
+#if (CANTP_FUN_STREAM_SHA256 == ON)
+/** \brief The round constants of the SHA-256.*/
+static const UINT32 gs_CanTpSha256K[64] =
+{
+    0x428A2F98uL, 0x71374491uL, 0xB5C0FBCFuL, 0xE9B5DBA5uL,
+    0x3956C25BuL, 0x59F111F1uL, 0x923F82A4uL, 0xAB1C5ED5uL,
+    0xD807AA98uL, 0x12835B01uL, 0x243185BEuL, 0x550C7DC3uL,
+    0x72BE5D74uL, 0x80DEB1FEuL, 0x9BDC06A7uL, 0xC19BF174uL,
+    0xE49B69C1uL, 0xEFBE4786uL, 0x0FC19DC6uL, 0x240CA1CCuL,
+    0x2DE92C6FuL, 0x4A7484AAuL, 0x5CB0A9DCuL, 0x76F988DAuL,
+    0x983E5152uL, 0xA831C66DuL, 0xB00327C8uL, 0xBF597FC7uL,
+    0xC6E00BF3uL, 0xD5A79147uL, 0x06CA6351uL, 0x14292967uL,
+    0x27B70A85uL, 0x2E1B2138uL, 0x4D2C6DFCuL, 0x53380D13uL,
+    0x650A7354uL, 0x766A0ABBuL, 0x81C2C92EuL, 0x92722C85uL,
+    0xA2BFE8A1uL, 0xA81A664BuL, 0xC24B8B70uL, 0xC76C51A3uL,
+    0xD192E819uL, 0xD6990624uL, 0xF40E3585uL, 0x106AA070uL,
+    0x19A4C116uL, 0x1E376C08uL, 0x2748774CuL, 0x34B0BCB5uL,
+    0x391C0CB3uL, 0x4ED8AA4AuL, 0x5B9CCA4FuL, 0x682E6FF3uL,
+    0x748F82EEuL, 0x78A5636FuL, 0x84C87814uL, 0x8CC70208uL,
+    0x90BEFFFAuL, 0xA4506CEBuL, 0xBEF9A3F7uL, 0xC67178F2uL
+};
+#endif
+
+/** \brief The runtime data of the stream.*/
+static bl_CanTpStream_t gs_CanTpStream;
+/** \brief The runtime data of the LZSS decoder.*/
+static bl_CanTpLzss_t gs_CanTpLzss;
+/** \brief The runtime data of the delta decoder.*/
+static bl_CanTpDelta_t gs_CanTpDelta;
+
+/*************************************************************************************************************
+                                          Function Definitions
+ ************************************************************************************************************/
+/**************************************************************************//**
+ *
+ *  \details    Initialize the stream, the downloads are not compressed.
+ *
+ *  \return None.
+ *
+ *  \since  V5.2.0
+ *
+ *****************************************************************************/
+void CanTpStream_Init(void)
+{
+    bl_CanTpStream_t *stream = &gs_CanTpStream;
+
+    stream->handle = CANTP_STREAM_HANDLE_NONE;
+    stream->offset = 0u;
+    stream->decoding = FALSE;
+    stream->repeated = FALSE;
+    stream->failed = FALSE;
+    stream->active = FALSE;
+    stream->requested = FALSE;
+    stream->format = 0u;
+    stream->rspCount = 0u;
+    stream->lastBsc = 0u;
+    stream->prevBsc = 0u;
+    stream->blockPending = FALSE;
+    stream->blockDecoded = FALSE;
+    stream->decoder = NULL_PTR;
+    stream->outCount = 0u;
+    _CanTpStream_InitDigest(stream);
+#if (CANTP_FUN_STREAM_DEDUP == ON)
+    stream->answerPending = FALSE;
+#endif
+
+    return ;
+}
+
+/**************************************************************************//**
+ *
+ *  \details    Start to receive a message. The message is followed by the
+ *              stream if no other message is received, otherwise it is
+ *              passed to the Diag as it is.
+ *
+ *  \param[in]  handle - the rx handle.
+ *  \param[in]  size - the total size of the message.
+ *
+ *  \return the result of the Diag.
+ *
+ *  \since  V5.2.0
+ *
+ *****************************************************************************/
+UINT8 CanTpStream_StartOfReception(bl_CanTpHandle_t handle,
+                                    bl_BufferSize_t size)
+{
+    bl_CanTpStream_t *stream = &gs_CanTpStream;
+    UINT8 ret;
+
+    ret = Diag_StartOfReception(size);
+
+    if ((ERR_OK == ret)
+        && ((CANTP_STREAM_HANDLE_NONE == stream->handle)
+            || (handle == stream->handle)))
+    {
+        stream->handle = handle;
+        stream->offset = 0u;
+        stream->decoding = FALSE;
+        stream->repeated = FALSE;
+    }
+
+    return ret;
+}
+
+/**************************************************************************//**
+ *
+ *  \details    Copy the received data. The data of a compressed
+ *              TransferData after its header is decoded, the other data is
+ *              copied to the Diag.
+ *
+ *  \param[in]  handle - the rx handle.
+ *  \param[in]  size - the size of the data.
+ *  \param[in]  buffer - the data.
+ *
+ *  \return If the data is copied or decoded returns ERR_OK, otherwise
+ *          returns ERR_ERROR.
+ *
+ *  \since  V5.2.0
+ *
+ *****************************************************************************/
+UINT8 CanTpStream_CopyRxData(bl_CanTpHandle_t handle,
+                                bl_BufferSize_t size,
+                                const bl_Buffer_t *buffer)
+{
+    bl_CanTpStream_t *stream = &gs_CanTpStream;
+    bl_BufferSize_t headerSize = 0u;
+    UINT8 ret = ERR_OK;
+
+    if (handle != stream->handle)
+    {
+        return Diag_CopyRxData(size, buffer);
+    }
+
+    while ((headerSize < size)
+        && (stream->offset < CANTP_STREAM_HEADER_SIZE))
+    {
+        stream->header[stream->offset] = buffer[headerSize];
+        stream->offset++;
+        headerSize++;
+        _CanTpStream_CheckHeader(stream);
+    }
+
+    if (FALSE == stream->decoding)
+    {
+        ret = Diag_CopyRxData(size, buffer);
+
+        if ((ERR_OK == ret) && (headerSize < size)
+            && (_CanTpStream_IsNewBlock(stream) != FALSE))
+        {
+            _CanTpStream_UpdateDigest(stream,
+                                        &buffer[headerSize],
+                                        size - headerSize);
+        }
+    }
+    else
+    {
+        if (headerSize > 0u)
+        {
+            ret = Diag_CopyRxData(headerSize, buffer);
+        }
+
+        if ((ERR_OK == ret) && (headerSize < size)
+            && (FALSE == stream->repeated))
+        {
+            if (stream->failed != FALSE)
+            {
+                ret = ERR_ERROR;
+            }
+            else
+            {
+                ret = stream->decoder->Decode(&buffer[headerSize],
+                                                size - headerSize);
+            }
+        }
+    }
+
+    stream->offset += size - headerSize;
+
+    return ret;
+}
+
+/**************************************************************************//**
+ *
+ *  \details    Indicate a message is received. The output of a compressed
+ *              TransferData is written before the Diag is indicated, and a
+ *              RequestTransferExit fails if the data ends in a match. A
+ *              RequestDownload is saved, the download is started when the
+ *              Diag accepts it. A TransferData waits for the response of
+ *              the Diag, it is dropped if the Diag rejects it.
+ *
+ *  \param[in]  handle - the rx handle.
+ *  \param[in]  taType - the TA type of the rx channel.
+ *  \param[in]  result - the result of the reception.
+ *
+ *  \return None.
+ *
+ *  \since  V5.2.0
+ *
+ *****************************************************************************/
+void CanTpStream_RxIndication(bl_CanTpHandle_t handle,
+                                UINT8 taType,
+                                bl_CanTpResult_t result)
+{
+    bl_CanTpStream_t *stream = &gs_CanTpStream;
+
+    if (handle == stream->handle)
+    {
+        stream->handle = CANTP_STREAM_HANDLE_NONE;
+
+        if (_CanTpStream_IsNewBlock(stream) != FALSE)
+        {
+            if ((ERR_OK == result) && (stream->decoding != FALSE))
+            {
+                result = _CanTpStream_Flush();
+            }
+
+            if (ERR_OK == result)
+            {
+                stream->prevBsc = stream->lastBsc;
+                stream->lastBsc = stream->header[1];
+                stream->blockPending = TRUE;
+                stream->blockDecoded = (UINT8)((stream->decoding != FALSE)
+                    && (stream->offset > CANTP_STREAM_HEADER_SIZE));
+            }
+            else
+            {
+                _CanTpStream_DropBlock(stream,
+                    (UINT8)((stream->decoding != FALSE)
+                        && (stream->offset > CANTP_STREAM_HEADER_SIZE)));
+            }
+        }
+        else if ((CANTP_STREAM_SID_REQUEST_DOWNLOAD == stream->header[0])
+            && (stream->offset >= CANTP_STREAM_HEADER_SIZE)
+            && (ERR_OK == result))
+        {
+            stream->requested = TRUE;
+            stream->format = stream->header[1];
+        }
+        else if ((CANTP_STREAM_SID_TRANSFER_EXIT == stream->header[0])
+            && (stream->offset > 0u)
+            && (stream->active != FALSE))
+        {
+            if ((stream->decoder != NULL_PTR)
+                && ((stream->failed != FALSE)
+                    || (FALSE == stream->decoder->IsComplete())))
+            {
+                result = ERR_ERROR;
+            }
+            stream->decoder = NULL_PTR;
+            stream->active = FALSE;
+        }
+        else
+        {
+            /*Other messages are not changed.*/
+        }
+    }
+
+    Diag_RxIndication(taType, result);
+
+    return ;
+}
+
+/**************************************************************************//**
+ *
+ *  \details    Copy the transmitting data, the answer of a block query or
+ *              the response of the Diag. The header of the response is
+ *              saved for the confirmation.
+ *
+ *  \param[in]  handle - the tx handle.
+ *  \param[in]  size - the size of the data.
+ *  \param[out] buffer - the buffer of the data.
+ *
+ *  \return the result of the Diag, or ERR_OK for the answer.
+ *
+ *  \since  V5.2.0
+ *
+ *****************************************************************************/
+UINT8 CanTpStream_CopyTxData(bl_CanTpHandle_t handle,
+                                bl_BufferSize_t size,
+                                bl_Buffer_t *buffer)
+{
+    bl_CanTpStream_t *stream = &gs_CanTpStream;
+    UINT8 ret;
+
+#if (CANTP_FUN_STREAM_DEDUP == ON)
+    if ((stream->answerPending != FALSE)
+        && (CANTP_DEDUP_TX_HANDLE == handle))
+    {
+        BL_DEBUG_ASSERT_PARAM(size <= CANTP_DEDUP_ANSWER_SIZE);
+
+        FblMemCpy(buffer, stream->answer, (UINT16)size);
+
+        return ERR_OK;
+    }
+#else
+    (void)handle;
+#endif
+
+    ret = Diag_CopyTxData(size, buffer);
+    if (ERR_OK == ret)
+    {
+        _CanTpStream_SaveResponse(stream, size, buffer);
+    }
+
+    return ret;
+}
+
+/**************************************************************************//**
+ *
+ *  \details    Confirm a message is transmitted, the Diag is not confirmed
+ *              for the answer of a block query. The response of the Diag
+ *              is checked before the Diag is confirmed.
+ *
+ *  \param[in]  handle - the tx handle.
+ *  \param[in]  result - the result of the transmission.
+ *
+ *  \return None.
+ *
+ *  \since  V5.2.0
+ *
+ *****************************************************************************/
+void CanTpStream_TxConfirmation(bl_CanTpHandle_t handle,
+                                bl_CanTpResult_t result)
+{
+    bl_CanTpStream_t *stream = &gs_CanTpStream;
+
+#if (CANTP_FUN_STREAM_DEDUP == ON)
+    if ((stream->answerPending != FALSE)
+        && (CANTP_DEDUP_TX_HANDLE == handle))
+    {
+        stream->answerPending = FALSE;
+
+        return ;
+    }
+#else
+    (void)handle;
+#endif
+
+    _CanTpStream_CheckResponse(stream);
+
+    Diag_TxConfirmation(result);
+
+    return ;
+}
+
+#if (CANTP_FUN_STREAM_DEDUP == ON)
+/**************************************************************************//**
+ *
+ *  \details    Answer a block query received in a SF, before the Diag gets
+ *              the SF. If the last answer is still transmitting, the query
+ *              is dropped and the tester asks again.
+ *
+ *  \param[in]  size - the size of the SF data.
+ *  \param[in]  buffer - the SF data.
+ *
+ *  \return If the SF is a block query returns TRUE, otherwise returns
+ *          FALSE and the SF is given to the Diag.
+ *
+ *  \since  V5.2.0
+ *
+ *****************************************************************************/
+UINT8 CanTpStream_RxBlockQuery(bl_BufferSize_t size,
+                                const bl_Buffer_t *buffer)
+{
+    bl_CanTpStream_t *stream = &gs_CanTpStream;
+    UINT16 block;
+    UINT32 crc;
+
+    if ((size != CANTP_DEDUP_QUERY_SIZE) || (buffer[0] != CANTP_DEDUP_SID))
+    {
+        return FALSE;
+    }
+
+    if (FALSE == stream->answerPending)
+    {
+        block = (UINT16)(((UINT16)buffer[1] << 8) | buffer[2]);
+        crc = ((UINT32)buffer[3] << 24) | ((UINT32)buffer[4] << 16)
+                | ((UINT32)buffer[5] << 8) | (UINT32)buffer[6];
+
+        stream->answer[0] = (bl_Buffer_t)(CANTP_DEDUP_SID + 0x40u);
+        stream->answer[1] = buffer[1];
+        stream->answer[2] = buffer[2];
+        stream->answer[3] = (bl_Buffer_t)((_CanTpStream_IsSameBlock(block, crc)
+                                            != FALSE) ? CANTP_DEDUP_SKIP
+                                                      : CANTP_DEDUP_SEND);
+
+        if (ERR_OK == Cantp_Transmit(CANTP_DEDUP_TX_HANDLE,
+                                        CANTP_DEDUP_ANSWER_SIZE))
+        {
+            stream->answerPending = TRUE;
+        }
+    }
+
+    return TRUE;
+}
+#endif
+
+#if (CANTP_FUN_STREAM_CRC32 == ON)
+/**************************************************************************//**
+ *
+ *  \details    Get the CRC-32 of the data of the current or last download.
+ *              The data of a compressed download is the decompressed data.
+ *
+ *  \return the CRC-32.
+ *
+ *  \since  V5.2.0
+ *
+ *****************************************************************************/
+UINT32 CanTpStream_GetCrc32(void)
+{
+    return gs_CanTpStream.crc ^ CANTP_CRC32_INIT_VALUE;
+}
+
+/**************************************************************************//**
+ *
+ *  \details    Update a CRC-32 register by the data, 8 bytes are processed
+ *              by each step of the slice-by-8 tables. The register is not
+ *              inverted at the beginning or the end.
+ *
+ *  \param[in]  crc - the CRC-32 register.
+ *  \param[in]  buffer - the data.
+ *  \param[in]  size - the size of the data.
+ *
+ *  \return the updated CRC-32 register.
+ *
+ *  \since  V5.2.0
+ *
+ *****************************************************************************/
+UINT32 CanTpStream_UpdateCrc32(UINT32 crc,
+                                const bl_Buffer_t *buffer,
+                                bl_BufferSize_t size)
+{
+    const UINT32 (*table)[256] = gs_CanTpCrc32Table;
+
+    while (size >= 8u)
+    {
+        crc ^= (UINT32)buffer[0] | ((UINT32)buffer[1] << 8)
+                | ((UINT32)buffer[2] << 16) | ((UINT32)buffer[3] << 24);
+        crc = table[7][crc & 0xFFu] ^ table[6][(crc >> 8) & 0xFFu]
+                ^ table[5][(crc >> 16) & 0xFFu] ^ table[4][crc >> 24]
+                ^ table[3][buffer[4]] ^ table[2][buffer[5]]
+                ^ table[1][buffer[6]] ^ table[0][buffer[7]];
+        buffer = &buffer[8];
+        size -= 8u;
+    }
+
+    while (size > 0u)
+    {
+        crc = (crc >> 8) ^ table[0][(crc ^ buffer[0]) & 0xFFu];
+        buffer = &buffer[1];
+        size--;
+    }
+
+    return crc;
+}
+#endif
+
+#if (CANTP_FUN_STREAM_SHA256 == ON)
+/**************************************************************************//**
+ *
+ *  \details    Get the SHA-256 of the data of the current or last download.
+ *              The running hash is not changed by the padding.
+ *
+ *  \param[out] digest - the buffer of the 32 bytes digest.
+ *
+ *  \return None.
+ *
+ *  \since  V5.2.0
+ *
+ *****************************************************************************/
+void CanTpStream_GetSha256(bl_Buffer_t *digest)
+{
+    bl_CanTpSha256_t sha = gs_CanTpStream.sha;
+    bl_Buffer_t pad[CANTP_SHA256_BLOCK_SIZE + 8u];
+    bl_BufferSize_t padSize;
+    UINT32 count = sha.count;
+    UINT16 i;
+
+    BL_DEBUG_ASSERT_NO_RET(digest != NULL_PTR);
+
+    /*Pad to 56 bytes of a block, then append the bit size.*/
+    padSize = (bl_BufferSize_t)(((count % CANTP_SHA256_BLOCK_SIZE) < 56u)
+                ? (56u - (count % CANTP_SHA256_BLOCK_SIZE))
+                : (120u - (count % CANTP_SHA256_BLOCK_SIZE)));
+    Bl_MemSet(pad, 0x00u, (UINT16)sizeof(pad));
+    pad[0] = 0x80u;
+    pad[padSize + 3u] = (bl_Buffer_t)(count >> 29);
+    pad[padSize + 4u] = (bl_Buffer_t)(count >> 21);
+    pad[padSize + 5u] = (bl_Buffer_t)(count >> 13);
+    pad[padSize + 6u] = (bl_Buffer_t)(count >> 5);
+    pad[padSize + 7u] = (bl_Buffer_t)(count << 3);
+    _CanTpStream_UpdateSha256(&sha, pad, padSize + 8u);
+
+    for (i = 0; i < 8u; i++)
+    {
+        digest[4u * i] = (bl_Buffer_t)(sha.state[i] >> 24);
+        digest[(4u * i) + 1u] = (bl_Buffer_t)(sha.state[i] >> 16);
+        digest[(4u * i) + 2u] = (bl_Buffer_t)(sha.state[i] >> 8);
+        digest[(4u * i) + 3u] = (bl_Buffer_t)(sha.state[i]);
+    }
+
+    return ;
+}
+#endif
+
+/**************************************************************************//**
+ *
+ *  \details    Process the header of a message when a byte of it is saved.
+ *              The SID selects if the message is decoded.
+ *
+ *  \param[in/out]  stream - the pointer of the stream.
+ *
+ *  \return None.
+ *
+ *  \since  V5.2.0
+ *
+ *****************************************************************************/
+static void _CanTpStream_CheckHeader(bl_CanTpStream_t *stream)
+{
+    UINT8 sid = stream->header[0];
+
+    if (1u == stream->offset)
+    {
+        stream->decoding = (UINT8)((CANTP_STREAM_SID_TRANSFER_DATA == sid)
+                                    && (stream->decoder != NULL_PTR));
+    }
+    else if ((CANTP_STREAM_SID_TRANSFER_DATA == sid)
+        && (stream->active != FALSE))
+    {
+        stream->repeated = (UINT8)(stream->header[1] == stream->lastBsc);
+        if (FALSE == stream->repeated)
+        {
+            _CanTpStream_SaveDigest(stream, FALSE);
+        }
+    }
+    else
+    {
+        /*Other messages are not changed.*/
+    }
+
+    return ;
+}
+
+/**************************************************************************//**
+ *
+ *  \details    Get the decoder of a compressionMethod.
+ *
+ *  \param[in]  method - the compressionMethod.
+ *
+ *  \return the decoder, or NULL_PTR if the data is not compressed or the
+ *          method is not supported.
+ *
+ *  \since  V5.2.0
+ *
+ *****************************************************************************/
+static const bl_CanTpStreamDecoder_t *_CanTpStream_GetDecoder(UINT8 method)
+{
+    const bl_CanTpStreamDecoder_t *decoder = NULL_PTR;
+    UINT16 i;
+
+    for (i = 0; i < CANTP_NUMBER_OF_STREAM_DECODER; i++)
+    {
+        if ((method != CANTP_STREAM_METHOD_NONE)
+            && (method == gs_CanTpStreamDecoder[i].method))
+        {
+            decoder = &gs_CanTpStreamDecoder[i];
+            break;
+        }
+    }
+
+    return decoder;
+}
+
+/**************************************************************************//**
+ *
+ *  \details    Save the first bytes of the response of the Diag, the SID,
+ *              the SID of the request and the NRC of a negative response.
+ *
+ *  \param[in/out]  stream - the pointer of the stream.
+ *  \param[in]  size - the size of the data copied.
+ *  \param[in]  buffer - the data copied.
+ *
+ *  \return None.
+ *
+ *  \since  V5.2.0
+ *
+ *****************************************************************************/
+static void _CanTpStream_SaveResponse(bl_CanTpStream_t *stream,
+                                        bl_BufferSize_t size,
+                                        const bl_Buffer_t *buffer)
+{
+    bl_BufferSize_t i = 0u;
+
+    while ((i < size) && (stream->rspCount < CANTP_STREAM_RESPONSE_SIZE))
+    {
+        stream->response[stream->rspCount] = buffer[i];
+        stream->rspCount++;
+        i++;
+    }
+
+    return ;
+}
+
+/**************************************************************************//**
+ *
+ *  \details    Process the response of the Diag when it is transmitted. A
+ *              positive response of the RequestDownload starts the
+ *              download, the Diag is in the download even if the response
+ *              is lost. A final negative response drops the
+ *              RequestDownload or the TransferData, the response pending
+ *              does not.
+ *
+ *  \param[in/out]  stream - the pointer of the stream.
+ *
+ *  \return None.
+ *
+ *  \since  V5.2.0
+ *
+ *****************************************************************************/
+static void _CanTpStream_CheckResponse(bl_CanTpStream_t *stream)
+{
+    UINT8 sid = stream->response[0];
+    UINT8 rejected = FALSE;
+
+    if ((CANTP_STREAM_SID_NEGATIVE_RESPONSE == sid)
+        && (CANTP_STREAM_RESPONSE_SIZE == stream->rspCount)
+        && (stream->response[2] != CANTP_STREAM_NRC_RESPONSE_PENDING))
+    {
+        rejected = TRUE;
+        sid = stream->response[1];
+    }
+
+    if ((stream->requested != FALSE) && (stream->rspCount > 0u))
+    {
+        if (CANTP_STREAM_POSITIVE_SID(CANTP_STREAM_SID_REQUEST_DOWNLOAD)
+            == sid)
+        {
+            stream->requested = FALSE;
+            _CanTpStream_StartDownload(stream);
+        }
+        else if ((rejected != FALSE)
+            && (CANTP_STREAM_SID_REQUEST_DOWNLOAD == sid))
+        {
+            stream->requested = FALSE;
+        }
+        else
+        {
+            /*Other responses are not changed.*/
+        }
+    }
+
+    if ((stream->blockPending != FALSE) && (stream->rspCount > 0u))
+    {
+        if (CANTP_STREAM_POSITIVE_SID(CANTP_STREAM_SID_TRANSFER_DATA) == sid)
+        {
+            stream->blockPending = FALSE;
+        }
+        else if ((rejected != FALSE)
+            && (CANTP_STREAM_SID_TRANSFER_DATA == sid))
+        {
+            /*The block is sent again with the same blockSequenceCounter.*/
+            stream->blockPending = FALSE;
+            stream->lastBsc = stream->prevBsc;
+            _CanTpStream_DropBlock(stream, stream->blockDecoded);
+        }
+        else
+        {
+            /*Other responses are not changed.*/
+        }
+    }
+
+    stream->rspCount = 0u;
+
+    return ;
+}
+
+/**************************************************************************//**
+ *
+ *  \details    Start the download accepted by the Diag, the
+ *              dataFormatIdentifier of the RequestDownload selects the
+ *              decoder.
+ *
+ *  \param[in/out]  stream - the pointer of the stream.
+ *
+ *  \return None.
+ *
+ *  \since  V5.2.0
+ *
+ *****************************************************************************/
+static void _CanTpStream_StartDownload(bl_CanTpStream_t *stream)
+{
+    /*The compressionMethod is the high half of dataFormatIdentifier.*/
+    stream->decoder = _CanTpStream_GetDecoder(
+                        (UINT8)(GET_HIGH_HALF(stream->format) >> 4));
+    stream->failed = FALSE;
+    stream->active = TRUE;
+    stream->lastBsc = 0u;
+    stream->blockPending = FALSE;
+    stream->outCount = 0u;
+    _CanTpStream_InitDigest(stream);
+
+    if (stream->decoder != NULL_PTR)
+    {
+        stream->decoder->Init();
+    }
+
+    return ;
+}
+
+/**************************************************************************//**
+ *
+ *  \details    Drop a TransferData which is failed by the transport or
+ *              rejected by the Diag. The tester sends it again, so its data
+ *              is hashed again.
+ *
+ *  \param[in/out]  stream - the pointer of the stream.
+ *  \param[in]  decoded - the data of the TransferData is decoded.
+ *
+ *  \return None.
+ *
+ *  \since  V5.2.0
+ *
+ *****************************************************************************/
+static void _CanTpStream_DropBlock(bl_CanTpStream_t *stream, UINT8 decoded)
+{
+    _CanTpStream_SaveDigest(stream, TRUE);
+
+    if (decoded != FALSE)
+    {
+        /*The decoder can not go back, a repeated block is lost.*/
+        stream->failed = TRUE;
+    }
+
+    return ;
+}
+
+/**************************************************************************//**
+ *
+ *  \details    Append a decoded byte to the output, the output is written
+ *              when it is full.
+ *
+ *  \param[in]  data - the decoded byte.
+ *
+ *  \return If the byte is buffered returns ERR_OK, otherwise returns
+ *          ERR_ERROR.
+ *
+ *  \since  V5.2.0
+ *
+ *****************************************************************************/
+static UINT8 _CanTpStream_Output(bl_Buffer_t data)
+{
+    bl_CanTpStream_t *stream = &gs_CanTpStream;
+    UINT8 ret = ERR_OK;
+
+    if (CANTP_STREAM_OUTPUT_SIZE == stream->outCount)
+    {
+        ret = _CanTpStream_Flush();
+    }
+
+    if (ERR_OK == ret)
+    {
+        stream->output[stream->outCount] = data;
+        stream->outCount++;
+    }
+
+    return ret;
+}
+
+/**************************************************************************//**
+ *
+ *  \details    Write the data in the output by the programming callback.
+ *
+ *  \return the result of the programming callback.
+ *
+ *  \since  V5.2.0
+ *
+ *****************************************************************************/
+static UINT8 _CanTpStream_Flush(void)
+{
+    bl_CanTpStream_t *stream = &gs_CanTpStream;
+    UINT8 ret = ERR_OK;
+
+    if (stream->outCount > 0u)
+    {
+        _CanTpStream_UpdateDigest(stream, stream->output, stream->outCount);
+        ret = CANTP_STREAM_WRITE(stream->output, stream->outCount);
+        stream->outCount = 0u;
+    }
+
+    return ret;
+}
+
+#if (CANTP_FUN_STREAM_DEDUP == ON)
+/**************************************************************************//**
+ *
+ *  \details    Check if a block in the flash has the CRC-32 by the index. A
+ *              block which is not in the index or not hashed is sent.
+ *
+ *  \param[in]  block - the number of the block.
+ *  \param[in]  crc - the CRC-32 of the block of the tester.
+ *
+ *  \return TRUE or FALSE.
+ *
+ *  \since  V5.2.0
+ *
+ *****************************************************************************/
+static UINT8 _CanTpStream_IsSameBlock(UINT16 block, UINT32 crc)
+{
+    const bl_CanTpDedupIndex_t *index = CANTP_DEDUP_INDEX;
+
+    return (UINT8)((CANTP_DEDUP_INDEX_MAGIC == index->magic)
+                    && (block < index->count)
+                    && (block < CANTP_DEDUP_NUMBER_OF_BLOCK)
+                    && (index->crc[block] != CANTP_DEDUP_CRC_UNKNOWN)
+                    && (index->crc[block] == crc));
+}
+#endif
+
+/**************************************************************************//**
+ *
+ *  \details    Check if a message is a TransferData of the download which is
+ *              not repeated, its data is hashed.
+ *
+ *  \param[in]  stream - the pointer of the stream.
+ *
+ *  \return TRUE or FALSE.
+ *
+ *  \since  V5.2.0
+ *
+ *****************************************************************************/
+static UINT8 _CanTpStream_IsNewBlock(const bl_CanTpStream_t *stream)
+{
+    return (UINT8)((stream->active != FALSE)
+                    && (stream->offset >= CANTP_STREAM_HEADER_SIZE)
+                    && (CANTP_STREAM_SID_TRANSFER_DATA == stream->header[0])
+                    && (FALSE == stream->repeated));
+}
+
+/**************************************************************************//**
+ *
+ *  \details    Start the digests of a download.
+ *
+ *  \param[in/out]  stream - the pointer of the stream.
+ *
+ *  \return None.
+ *
+ *  \since  V5.2.0
+ *
+ *****************************************************************************/
+static void _CanTpStream_InitDigest(bl_CanTpStream_t *stream)
+{
+#if (CANTP_FUN_STREAM_CRC32 == ON)
+    stream->crc = CANTP_CRC32_INIT_VALUE;
+#endif
+#if (CANTP_FUN_STREAM_SHA256 == ON)
+    _CanTpStream_InitSha256(&stream->sha);
+#endif
+    (void)stream;
+
+    return ;
+}
+
+/**************************************************************************//**
+ *
+ *  \details    Update the digests by the data of a download, while the data
+ *              is received or decompressed.
+ *
+ *  \param[in/out]  stream - the pointer of the stream.
+ *  \param[in]  buffer - the data.
+ *  \param[in]  size - the size of the data.
+ *
+ *  \return None.
+ *
+ *  \since  V5.2.0
+ *
+ *****************************************************************************/
+static void _CanTpStream_UpdateDigest(bl_CanTpStream_t *stream,
+                                        const bl_Buffer_t *buffer,
+                                        bl_BufferSize_t size)
+{
+#if (CANTP_FUN_STREAM_CRC32 == ON)
+    stream->crc = CANTP_STREAM_CRC32_UPDATE(stream->crc, buffer, size);
+#endif
+#if (CANTP_FUN_STREAM_SHA256 == ON)
+    _CanTpStream_UpdateSha256(&stream->sha, buffer, size);
+#endif
+    (void)stream;
+    (void)buffer;
+    (void)size;
+
+    return ;
+}
+
+/**************************************************************************//**
+ *
+ *  \details    Save the digests before the data of a TransferData, or
+ *              restore them when the TransferData is failed.
+ *
+ *  \param[in/out]  stream - the pointer of the stream.
+ *  \param[in]  restore - restore the saved digests.
+ *
+ *  \return None.
+ *
+ *  \since  V5.2.0
+ *
+ *****************************************************************************/
+static void _CanTpStream_SaveDigest(bl_CanTpStream_t *stream, UINT8 restore)
+{
+    if (FALSE == restore)
+    {
+#if (CANTP_FUN_STREAM_CRC32 == ON)
+        stream->blockCrc = stream->crc;
+#endif
+#if (CANTP_FUN_STREAM_SHA256 == ON)
+        stream->blockSha = stream->sha;
+#endif
+    }
+    else
+    {
+#if (CANTP_FUN_STREAM_CRC32 == ON)
+        stream->crc = stream->blockCrc;
+#endif
+#if (CANTP_FUN_STREAM_SHA256 == ON)
+        stream->sha = stream->blockSha;
+#endif
+    }
+    (void)stream;
+
+    return ;
+}
+
+#if (CANTP_FUN_STREAM_SHA256 == ON)
+/**************************************************************************//**
+ *
+ *  \details    Start a SHA-256 by the initial hash value.
+ *
+ *  \param[out] sha - the pointer of the SHA-256.
+ *
+ *  \return None.
+ *
+ *  \since  V5.2.0
+ *
+ *****************************************************************************/
+static void _CanTpStream_InitSha256(bl_CanTpSha256_t *sha)
+{
+    sha->state[0] = 0x6A09E667uL;
+    sha->state[1] = 0xBB67AE85uL;
+    sha->state[2] = 0x3C6EF372uL;
+    sha->state[3] = 0xA54FF53AuL;
+    sha->state[4] = 0x510E527FuL;
+    sha->state[5] = 0x9B05688CuL;
+    sha->state[6] = 0x1F83D9ABuL;
+    sha->state[7] = 0x5BE0CD19uL;
+    sha->count = 0uL;
+
+    return ;
+}
+
+/**************************************************************************//**
+ *
+ *  \details    Hash the data by a SHA-256, the data of an incomplete block
+ *              is kept until the next data is received.
+ *
+ *  \param[in/out]  sha - the pointer of the SHA-256.
+ *  \param[in]  buffer - the data.
+ *  \param[in]  size - the size of the data.
+ *
+ *  \return None.
+ *
+ *  \since  V5.2.0
+ *
+ *****************************************************************************/
+static void _CanTpStream_UpdateSha256(bl_CanTpSha256_t *sha,
+                                        const bl_Buffer_t *buffer,
+                                        bl_BufferSize_t size)
+{
+    bl_BufferSize_t used = (bl_BufferSize_t)(sha->count % CANTP_SHA256_BLOCK_SIZE);
+    bl_BufferSize_t part;
+
+    sha->count += size;
+
+    if (used > 0u)
+    {
+        part = CANTP_SHA256_BLOCK_SIZE - used;
+        if (part > size)
+        {
+            part = size;
+        }
+
+        FblMemCpy(&sha->block[used], buffer, (UINT16)part);
+        buffer = &buffer[part];
+        size -= part;
+
+        if ((used + part) < CANTP_SHA256_BLOCK_SIZE)
+        {
+            return ;
+        }
+
+        _CanTpStream_TransformSha256(sha, sha->block);
+    }
+
+    while (size >= CANTP_SHA256_BLOCK_SIZE)
+    {
+        _CanTpStream_TransformSha256(sha, buffer);
+        buffer = &buffer[CANTP_SHA256_BLOCK_SIZE];
+        size -= CANTP_SHA256_BLOCK_SIZE;
+    }
+
+    FblMemCpy(sha->block, buffer, (UINT16)size);
+
+    return ;
+}
+
+/**************************************************************************//**
+ *
+ *  \details    Hash a block of 64 bytes by a SHA-256.
+ *
+ *  \param[in/out]  sha - the pointer of the SHA-256.
+ *  \param[in]  block - the block.
+ *
+ *  \return None.
+ *
+ *  \since  V5.2.0
+ *
+ *****************************************************************************/
+static void _CanTpStream_TransformSha256(bl_CanTpSha256_t *sha,
+                                            const bl_Buffer_t *block)
+{
+    UINT32 w[64];
+    UINT32 v[8];
+    UINT32 t1;
+    UINT32 t2;
+    UINT16 i;
+
+    for (i = 0; i < 16u; i++)
+    {
+        w[i] = ((UINT32)block[4u * i] << 24) | ((UINT32)block[(4u * i) + 1u] << 16)
+                | ((UINT32)block[(4u * i) + 2u] << 8) | (UINT32)block[(4u * i) + 3u];
+    }
+
+    for (i = 16u; i < 64u; i++)
+    {
+        w[i] = CANTP_SHA256_SIG1(w[i - 2u]) + w[i - 7u]
+                + CANTP_SHA256_SIG0(w[i - 15u]) + w[i - 16u];
+    }
+
+    for (i = 0; i < 8u; i++)
+    {
+        v[i] = sha->state[i];
+    }
+
+    for (i = 0; i < 64u; i++)
+    {
+        t1 = v[7] + CANTP_SHA256_EP1(v[4]) + CANTP_SHA256_CH(v[4],v[5],v[6])
+                + gs_CanTpSha256K[i] + w[i];
+        t2 = CANTP_SHA256_EP0(v[0]) + CANTP_SHA256_MAJ(v[0],v[1],v[2]);
+        v[7] = v[6];
+        v[6] = v[5];
+        v[5] = v[4];
+        v[4] = v[3] + t1;
+        v[3] = v[2];
+        v[2] = v[1];
+        v[1] = v[0];
+        v[0] = t1 + t2;
+    }
+
+    for (i = 0; i < 8u; i++)
+    {
+        sha->state[i] += v[i];
+    }
+
+    return ;
+}
+#endif
+
+/**************************************************************************//**
+ *
+ *  \details    Start to decode the LZSS data of a download.
+ *
+ *  \return None.
+ *
+ *  \since  V5.2.0
+ *
+ *****************************************************************************/
+static void _CanTpStream_InitLzss(void)
+{
+    bl_CanTpLzss_t *lzss = &gs_CanTpLzss;
+
+    lzss->state = CANTP_LZSS_STATE_FLAGS;
+    lzss->low = 0u;
+    lzss->flags = 0u;
+    lzss->pos = (UINT16)(CANTP_LZSS_WINDOW_SIZE - CANTP_LZSS_MAX_MATCH);
+    Bl_MemSet(lzss->window,
+                CANTP_LZSS_FILL_VALUE,
+                (UINT16)CANTP_LZSS_WINDOW_SIZE);
+
+    return ;
+}
+
+/**************************************************************************//**
+ *
+ *  \details    Decode the next LZSS data. The data can be split at any
+ *              byte, the state is kept until the next data is received.
+ *
+ *  \param[in]  buffer - the compressed data.
+ *  \param[in]  size - the size of the compressed data.
+ *
+ *  \return If the decoded data is buffered returns ERR_OK, otherwise
+ *          returns ERR_ERROR.
+ *
+ *  \since  V5.2.0
+ *
+ *****************************************************************************/
+static UINT8 _CanTpStream_DecodeLzss(const bl_Buffer_t *buffer,
+                                        bl_BufferSize_t size)
+{
+    bl_CanTpLzss_t *lzss = &gs_CanTpLzss;
+    bl_BufferSize_t i;
+    UINT16 matchPos;
+    UINT16 matchSize;
+    UINT16 k;
+    bl_Buffer_t data;
+    UINT8 ret = ERR_OK;
+
+    for (i = 0; (i < size) && (ERR_OK == ret); i++)
+    {
+        data = buffer[i];
+
+        if (CANTP_LZSS_STATE_FLAGS == lzss->state)
+        {
+            /*The high byte marks the 8 flag bits which are not used.*/
+            lzss->flags = (UINT16)(data | 0xFF00u);
+            lzss->state = CANTP_LZSS_STATE_ITEM;
+            continue;
+        }
+
+        if ((CANTP_LZSS_STATE_ITEM == lzss->state)
+            && (0u == (lzss->flags & 0x01u)))
+        {
+            lzss->low = data;
+            lzss->state = CANTP_LZSS_STATE_MATCH;
+            continue;
+        }
+
+        if (CANTP_LZSS_STATE_ITEM == lzss->state)
+        {
+            /*A literal byte.*/
+            ret = _CanTpStream_Output(data);
+            lzss->window[lzss->pos] = data;
+            lzss->pos = (UINT16)((lzss->pos + 1u) & (CANTP_LZSS_WINDOW_SIZE - 1u));
+        }
+        else
+        {
+            /*A match copies the data already in the window.*/
+            matchPos = (UINT16)(lzss->low | ((UINT16)GET_HIGH_HALF(data) << 4));
+            matchSize = (UINT16)(GET_LOW_HALF(data) + CANTP_LZSS_THRESHOLD + 1u);
+
+            for (k = 0; (k < matchSize) && (ERR_OK == ret); k++)
+            {
+                data = lzss->window[(matchPos + k) & (CANTP_LZSS_WINDOW_SIZE - 1u)];
+                ret = _CanTpStream_Output(data);
+                lzss->window[lzss->pos] = data;
+                lzss->pos = (UINT16)((lzss->pos + 1u) & (CANTP_LZSS_WINDOW_SIZE - 1u));
+            }
+        }
+
+        lzss->flags >>= 1;
+        if (0u == (lzss->flags & CANTP_LZSS_FLAGS_USED))
+        {
+            lzss->state = CANTP_LZSS_STATE_FLAGS;
+        }
+        else
+        {
+            lzss->state = CANTP_LZSS_STATE_ITEM;
+        }
+    }
+
+    return ret;
+}
+
+/**************************************************************************//**
+ *
+ *  \details    Check if the LZSS data ends on a whole item, a match shall
+ *              not be split by the end of the download.
+ *
+ *  \return TRUE or FALSE.
+ *
+ *  \since  V5.2.0
+ *
+ *****************************************************************************/
+static UINT8 _CanTpStream_IsLzssComplete(void)
+{
+    return (UINT8)(gs_CanTpLzss.state != CANTP_LZSS_STATE_MATCH);
+}
+
+/**************************************************************************//**
+ *
+ *  \details    Start to decode the delta data of a download, the first copy
+ *              starts at the beginning of the installed image.
+ *
+ *  \return None.
+ *
+ *  \since  V5.2.0
+ *
+ *****************************************************************************/
+static void _CanTpStream_InitDelta(void)
+{
+    bl_CanTpDelta_t *delta = &gs_CanTpDelta;
+
+    delta->state = CANTP_DELTA_STATE_COMMAND;
+    delta->count = 0u;
+    delta->value = 0uL;
+    delta->oldPos = 0uL;
+
+    return ;
+}
+
+/**************************************************************************//**
+ *
+ *  \details    Decode the next delta data. Each command is one byte:
+ *              0x00-0x7F inserts the next 1-128 bytes, 0x80-0xFD copies
+ *              1-126 bytes of the installed image, 0xFE copies the number
+ *              of bytes in the next 2 bytes, and 0xFF moves the position in
+ *              the installed image by the signed offset in the next 4
+ *              bytes. The parameters are big endian. The data can be split
+ *              at any byte.
+ *
+ *  \param[in]  buffer - the delta data.
+ *  \param[in]  size - the size of the delta data.
+ *
+ *  \return If the decoded data is buffered returns ERR_OK, otherwise
+ *          returns ERR_ERROR.
+ *
+ *  \since  V5.2.0
+ *
+ *****************************************************************************/
+static UINT8 _CanTpStream_DecodeDelta(const bl_Buffer_t *buffer,
+                                        bl_BufferSize_t size)
+{
+    bl_CanTpDelta_t *delta = &gs_CanTpDelta;
+    bl_BufferSize_t i;
+    bl_Buffer_t data;
+    UINT8 ret = ERR_OK;
+
+    for (i = 0; (i < size) && (ERR_OK == ret); i++)
+    {
+        data = buffer[i];
+
+        switch (delta->state)
+        {
+        case CANTP_DELTA_STATE_COMMAND:
+            delta->value = 0uL;
+            if (data <= 0x7Fu)
+            {
+                delta->count = (UINT8)(data + 1u);
+                delta->state = CANTP_DELTA_STATE_INSERT;
+            }
+            else if (data <= 0xFDu)
+            {
+                ret = _CanTpStream_CopyOld((UINT32)data - 0x7Fu);
+            }
+            else if (0xFEu == data)
+            {
+                delta->count = 2u;
+                delta->state = CANTP_DELTA_STATE_COPY;
+            }
+            else
+            {
+                delta->count = 4u;
+                delta->state = CANTP_DELTA_STATE_SEEK;
+            }
+            break;
+        case CANTP_DELTA_STATE_INSERT:
+            ret = _CanTpStream_Output(data);
+            delta->count--;
+            if (0u == delta->count)
+            {
+                delta->state = CANTP_DELTA_STATE_COMMAND;
+            }
+            break;
+        default:
+            /*The parameter of a long copy or a seek.*/
+            delta->value = (delta->value << 8) | data;
+            delta->count--;
+            if (0u == delta->count)
+            {
+                if (CANTP_DELTA_STATE_SEEK == delta->state)
+                {
+                    /*The offset is signed, it wraps as the position.*/
+                    delta->oldPos += delta->value;
+                }
+                else if (0uL == delta->value)
+                {
+                    ret = ERR_ERROR;
+                }
+                else
+                {
+                    ret = _CanTpStream_CopyOld(delta->value);
+                }
+                delta->state = CANTP_DELTA_STATE_COMMAND;
+            }
+            break;
+        }
+    }
+
+    return ret;
+}
+
+/**************************************************************************//**
+ *
+ *  \details    Check if the delta data ends on a whole command.
+ *
+ *  \return TRUE or FALSE.
+ *
+ *  \since  V5.2.0
+ *
+ *****************************************************************************/
+static UINT8 _CanTpStream_IsDeltaComplete(void)
+{
+    return (UINT8)(CANTP_DELTA_STATE_COMMAND == gs_CanTpDelta.state);
+}
+
+/**************************************************************************//**
+ *
+ *  \details    Copy the data of the installed image to the output at the
+ *              current position, the data is read into the free part of
+ *              the output directly.
+ *
+ *  \param[in]  size - the size of the data.
+ *
+ *  \return If the data is buffered returns ERR_OK, otherwise returns
+ *          ERR_ERROR.
+ *
+ *  \since  V5.2.0
+ *
+ *****************************************************************************/
+static UINT8 _CanTpStream_CopyOld(UINT32 size)
+{
+    bl_CanTpStream_t *stream = &gs_CanTpStream;
+    bl_CanTpDelta_t *delta = &gs_CanTpDelta;
+    bl_BufferSize_t part;
+    UINT8 ret = ERR_OK;
+
+    while ((size > 0uL) && (ERR_OK == ret))
+    {
+        if (CANTP_STREAM_OUTPUT_SIZE == stream->outCount)
+        {
+            ret = _CanTpStream_Flush();
+            continue;
+        }
+
+        part = CANTP_STREAM_OUTPUT_SIZE - stream->outCount;
+        if (part > size)
+        {
+            part = (bl_BufferSize_t)size;
+        }
+
+        ret = CANTP_STREAM_READ_OLD(delta->oldPos,
+                                    &stream->output[stream->outCount],
+                                    part);
+        stream->outCount += part;
+        delta->oldPos += part;
+        size -= part;
+    }
+
+    return ret;
+}
+#endif
+
+/*************************************************************************************************************
+                                               End Of File
+*************************************************************************************************************/
+
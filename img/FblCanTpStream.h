@@ -0,0 +1,151 @@
+/*************************************************************************************************************
+*    FileName   :    FblCanTpStream.h
+*    Description:    Streaming decompression stage of the CAN TP module header file.
+
+*    UpdateDate :    2026/10/18
+*    Version    :    1.0.0
+*    History    :
+        1. V1.0.0, 2026/10/18, Initial version.
+
+*************************************************************************************************************/
+#ifndef _FBLCANTPSTREAM_H_
+#define _FBLCANTPSTREAM_H_
+
+/*************************************************************************************************************
+                                          Header File Includes
+*************************************************************************************************************/
+#include "FblCanTp.h"
+#include "FblCanTpCfg.h"
+
+
+/*************************************************************************************************************
+                                                Macros
+*************************************************************************************************************/
+
+/*****************************************************************************
+ *  Macro Definitions
+ *****************************************************************************/
+/** \brief No message is received by the stream.*/
+#define CANTP_STREAM_HANDLE_NONE        (0xFFFFu)
+/** \brief The compressionMethod of the uncompressed data.*/
+#define CANTP_STREAM_METHOD_NONE        (0x0u)
+
+/** \brief The SIDs of the download services.*/
+#define CANTP_STREAM_SID_REQUEST_DOWNLOAD   (0x34u)
+#define CANTP_STREAM_SID_TRANSFER_DATA      (0x36u)
+#define CANTP_STREAM_SID_TRANSFER_EXIT      (0x37u)
+/** \brief The SID of a positive response is the SID of the request with
+    bit 6 set, a negative response is [0x7F, SID, NRC].*/
+#define CANTP_STREAM_POSITIVE_SID(sid)      ((UINT8)((sid) | 0x40u))
+#define CANTP_STREAM_SID_NEGATIVE_RESPONSE  (0x7Fu)
+#define CANTP_STREAM_NRC_RESPONSE_PENDING   (0x78u)
+/** \brief The size of the response header watched by the stream.*/
+#define CANTP_STREAM_RESPONSE_SIZE      (3u)
+/** \brief The size of the SID and the first parameter of a request, the
+    dataFormatIdentifier or the blockSequenceCounter.*/
+#define CANTP_STREAM_HEADER_SIZE        (2u)
+
+/** \brief The LZSS format, a flag byte is followed by 8 items, each flag bit
+    from the LSB selects a literal byte(1) or a match(0) of two bytes, with
+    a 12-bit window position and a 4-bit length.*/
+#define CANTP_LZSS_WINDOW_SIZE          (4096u)
+#define CANTP_LZSS_MAX_MATCH            (18u)
+#define CANTP_LZSS_THRESHOLD            (2u)
+/** \brief The initial contents of the window.*/
+#define CANTP_LZSS_FILL_VALUE           (0x20u)
+
+/** \brief The block query is [SID, block(2), CRC-32(4)] in a SF, and the
+    answer is [SID + 0x40, block(2), CANTP_DEDUP_SKIP or CANTP_DEDUP_SEND].*/
+#define CANTP_DEDUP_QUERY_SIZE          (7u)
+#define CANTP_DEDUP_ANSWER_SIZE         (4u)
+#define CANTP_DEDUP_SKIP                (0x00u)
+#define CANTP_DEDUP_SEND                (0x01u)
+/** \brief The index is valid.*/
+#define CANTP_DEDUP_INDEX_MAGIC         (0x44445550uL)
+/** \brief The hash of a block is not known, the erased value of the flash.*/
+#define CANTP_DEDUP_CRC_UNKNOWN         (0xFFFFFFFFuL)
+
+/** \brief The size of the SHA-256 digest.*/
+#define CANTP_SHA256_DIGEST_SIZE        (32u)
+
+/*****************************************************************************
+ *  Structure Definitions
+ *****************************************************************************/
+/** \brief The index of the block hashes resident in the flash. The block n
+    is at baseAddress + n * blockSize, and its CRC-32 is programmed by the
+    programming module after the block is written.*/
+struct _tag_CanTpDedupIndex
+{
+    UINT32 magic;       /**< CANTP_DEDUP_INDEX_MAGIC if the index is valid.*/
+    UINT32 baseAddress; /**< The address of the first block.*/
+    UINT32 blockSize;   /**< The size of each block.*/
+    UINT32 count;       /**< The number of the blocks.*/
+    UINT32 crc[CANTP_DEDUP_NUMBER_OF_BLOCK]; /**< The CRC-32 of each block,
+                                                  or CANTP_DEDUP_CRC_UNKNOWN.*/
+};
+
+/*****************************************************************************
+ *  Type Declarations
+ *****************************************************************************/
+/** \brief A alias of the struct _tag_CanTpDedupIndex.*/
+typedef struct _tag_CanTpDedupIndex bl_CanTpDedupIndex_t;
+
+/*****************************************************************************
+ *  External Global Variable Declarations
+ *****************************************************************************/
+
+/*****************************************************************************
+ *  External Function Prototype Declarations
+ *****************************************************************************/
+/** \brief Initialize the stream.*/
+extern void CanTpStream_Init(void);
+/** \brief Start to receive a message.*/
+extern UINT8 CanTpStream_StartOfReception(bl_CanTpHandle_t handle,
+                                            bl_BufferSize_t size);
+/** \brief Copy the received data.*/
+extern UINT8 CanTpStream_CopyRxData(bl_CanTpHandle_t handle,
+                                    bl_BufferSize_t size,
+                                    const bl_Buffer_t *buffer);
+/** \brief Indicate a message is received.*/
+extern void CanTpStream_RxIndication(bl_CanTpHandle_t handle,
+                                        UINT8 taType,
+                                        bl_CanTpResult_t result);
+/** \brief Copy the transmitting data.*/
+extern UINT8 CanTpStream_CopyTxData(bl_CanTpHandle_t handle,
+                                    bl_BufferSize_t size,
+                                    bl_Buffer_t *buffer);
+/** \brief Confirm a message is transmitted.*/
+extern void CanTpStream_TxConfirmation(bl_CanTpHandle_t handle,
+                                        bl_CanTpResult_t result);
+#if (CANTP_FUN_STREAM_DEDUP == ON)
+/** \brief Answer a block query received in a SF.*/
+extern UINT8 CanTpStream_RxBlockQuery(bl_BufferSize_t size,
+                                        const bl_Buffer_t *buffer);
+#endif
+
+#if (CANTP_FUN_STREAM_CRC32 == ON)
+/** \brief Get the CRC-32 of the data of the download.*/
+extern UINT32 CanTpStream_GetCrc32(void);
+/** \brief Update a CRC-32 register by the slice-by-8 tables.*/
+extern UINT32 CanTpStream_UpdateCrc32(UINT32 crc,
+                                        const bl_Buffer_t *buffer,
+                                        bl_BufferSize_t size);
+#endif
+#if (CANTP_FUN_STREAM_SHA256 == ON)
+/** \brief Get the SHA-256 of the data of the download.*/
+extern void CanTpStream_GetSha256(bl_Buffer_t *digest);
+#endif
+
+/** \brief Write the decompressed data, provided by the programming module.*/
+extern UINT8 Diag_WriteStreamData(const bl_Buffer_t *buffer,
+                                    bl_BufferSize_t size);
+/** \brief Read the installed image, provided by the programming module.*/
+extern UINT8 Diag_ReadInstalledImage(UINT32 pos,
+                                        bl_Buffer_t *buffer,
+                                        bl_BufferSize_t size);
+
+/*************************************************************************************************************
+                                               End Of File
+*************************************************************************************************************/
+#endif
+